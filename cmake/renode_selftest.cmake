@@ -0,0 +1,27 @@
+# 在 Renode 中无界面运行 selftest.elf，按 USART1 日志最后的 SELFTEST PASS / FAIL 判定结果。
+# 由顶层 CMakeLists.txt 的 selftest_renode 目标调用：
+#   cmake -DRENODE=<renode> -DRESC=<selftest.resc> -DELF=<selftest.elf> -DLOG=<日志> [-DRUN_TIME=00:00:05] -P renode_selftest.cmake
+
+if(NOT DEFINED RUN_TIME)
+    set(RUN_TIME "00:00:05")
+endif()
+
+file(REMOVE ${LOG})
+
+execute_process(
+    COMMAND ${RENODE} --disable-xwt --console --plain
+            -e "$elf=@${ELF}; $log=@${LOG}; include @${RESC}; emulation RunFor \"${RUN_TIME}\"; quit"
+    TIMEOUT 300
+    RESULT_VARIABLE RENODE_RESULT
+)
+
+if(NOT EXISTS ${LOG})
+    message(FATAL_ERROR "selftest: no USART1 output (renode exit: ${RENODE_RESULT})")
+endif()
+
+file(READ ${LOG} SELFTEST_OUTPUT)
+message("${SELFTEST_OUTPUT}")
+
+if(NOT SELFTEST_OUTPUT MATCHES "SELFTEST PASS")
+    message(FATAL_ERROR "selftest: failed or did not finish within ${RUN_TIME} of emulated time")
+endif()
@@ -76,7 +76,8 @@
 #if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx)\
  || defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx)\
  || defined(STM32F469xx) || defined(STM32F479xx) || defined(STM32F412Zx) || defined(STM32F412Vx)
-/* #define DATA_IN_ExtSRAM */
+/* 本板: IS62WV51216 (1MB, 16-bit) 挂在 FSMC Bank1 NE3 (0x68000000)，供 LCD 帧缓冲使用 */
+#define DATA_IN_ExtSRAM
 #endif /* STM32F40xxx || STM32F41xxx || STM32F42xxx || STM32F43xxx || STM32F469xx || STM32F479xx ||\
           STM32F412Zx || STM32F412Vx */
  
@@ -645,30 +646,36 @@ void SystemInit_ExtMemCtl(void)
 
 #if defined(DATA_IN_ExtSRAM)
 /*-- GPIOs Configuration -----------------------------------------------------*/
+  /* 引脚按本板原理图（IS62WV51216 @ NE3）配置，只占用 SRAM 实际使用的引脚：
+     PD0/1/8/9/10/14/15 + PE7..15 = D0..D15, PD4 = NOE, PD5 = NWE,
+     PF0..5 = A0..5, PF12..15 = A6..9, PG0..5 = A10..15, PD11..13 = A16..18,
+     PE0/1 = NBL0/1, PG10 = NE3
+     其余引脚（LCD 复位 PD3、按键 PE2..4、LED/蜂鸣器 PF8..10、LCD 的 NE4 PG12）保持复位态，
+     由各自模块初始化。 */
    /* Enable GPIOD, GPIOE, GPIOF and GPIOG interface clock */
   RCC->AHB1ENR   |= 0x00000078;
   /* Delay after an RCC peripheral clock enabling */
   tmp = READ_BIT(RCC->AHB1ENR, RCC_AHB1ENR_GPIODEN);
   
   /* Connect PDx pins to FMC Alternate function */
-  GPIOD->AFR[0]  = 0x00CCC0CC;
+  GPIOD->AFR[0]  = 0x00CC00CC;
   GPIOD->AFR[1]  = 0xCCCCCCCC;
   /* Configure PDx pins in Alternate function mode */  
-  GPIOD->MODER   = 0xAAAA0A8A;
+  GPIOD->MODER   = 0xAAAA0A0A;
   /* Configure PDx pins speed to 100 MHz */  
-  GPIOD->OSPEEDR = 0xFFFF0FCF;
+  GPIOD->OSPEEDR = 0xFFFF0F0F;
   /* Configure PDx pins Output type to push-pull */  
   GPIOD->OTYPER  = 0x00000000;
   /* No pull-up, pull-down for PDx pins */ 
   GPIOD->PUPDR   = 0x00000000;
 
   /* Connect PEx pins to FMC Alternate function */
-  GPIOE->AFR[0]  = 0xC00CC0CC;
+  GPIOE->AFR[0]  = 0xC00000CC;
   GPIOE->AFR[1]  = 0xCCCCCCCC;
   /* Configure PEx pins in Alternate function mode */ 
-  GPIOE->MODER   = 0xAAAA828A;
+  GPIOE->MODER   = 0xAAAA800A;
   /* Configure PEx pins speed to 100 MHz */ 
-  GPIOE->OSPEEDR = 0xFFFFC3CF;
+  GPIOE->OSPEEDR = 0xFFFFC00F;
   /* Configure PEx pins Output type to push-pull */  
   GPIOE->OTYPER  = 0x00000000;
   /* No pull-up, pull-down for PEx pins */ 
@@ -688,11 +695,11 @@ void SystemInit_ExtMemCtl(void)
 
   /* Connect PGx pins to FMC Alternate function */
   GPIOG->AFR[0]  = 0x00CCCCCC;
-  GPIOG->AFR[1]  = 0x000000C0;
+  GPIOG->AFR[1]  = 0x00000C00;
   /* Configure PGx pins in Alternate function mode */ 
-  GPIOG->MODER   = 0x00085AAA;
+  GPIOG->MODER   = 0x00200AAA;
   /* Configure PGx pins speed to 100 MHz */ 
-  GPIOG->OSPEEDR = 0x000CAFFF;
+  GPIOG->OSPEEDR = 0x00300FFF;
   /* Configure PGx pins Output type to push-pull */  
   GPIOG->OTYPER  = 0x00000000;
   /* No pull-up, pull-down for PGx pins */ 
@@ -722,10 +729,13 @@ void SystemInit_ExtMemCtl(void)
    || defined(STM32F412Zx) || defined(STM32F412Vx)
   /* Delay after an RCC peripheral clock enabling */
   tmp = READ_BIT(RCC->AHB3ENR, RCC_AHB3ENR_FSMCEN);
-  /* Configure and enable Bank1_SRAM2 */
-  FSMC_Bank1->BTCR[2]  = 0x00001011;
-  FSMC_Bank1->BTCR[3]  = 0x00000201;
-  FSMC_Bank1E->BWTR[2] = 0x0FFFFFFF;
+  /* Configure and enable Bank1_SRAM3 (NE3):
+     BCR3: MBKEN | MWID=16-bit | WREN，Mode 1，EXTMOD=0（读写共用 BTR3）
+     BTR3: ADDSET=2, DATAST=8 -> 10 HCLK @168MHz = 59.5ns >= tRC/tWC(55ns)
+     注意：此时仍运行在 HSI 16MHz，时序按最终 168MHz 选取 */
+  FSMC_Bank1->BTCR[4]  = 0x00001011;
+  FSMC_Bank1->BTCR[5]  = 0x00000802;
+  FSMC_Bank1E->BWTR[4] = 0x0FFFFFFF;
 #endif /* STM32F405xx || STM32F415xx || STM32F407xx || STM32F417xx || STM32F412Zx || STM32F412Vx */
 
 #endif /* DATA_IN_ExtSRAM */
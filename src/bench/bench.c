@@ -0,0 +1,38 @@
+#include "bench/bench.h"
+
+#include "stm32f4xx.h"
+
+#include "timebase/timebase.h"
+
+void bench_init(void)
+{
+    /* 与 timebase 共用 CYCCNT：只使能、不清零（测量都是差值，清零会让 64-bit 时间跳变） */
+    time_init();
+}
+
+uint32_t bench_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+uint32_t bench_mpix_x100(uint32_t pixels, uint32_t cycles)
+{
+    if (cycles == 0U)
+    {
+        return 0U;
+    }
+
+    /* MPix/s = pixels * HCLK / cycles / 1e6，×100 => pixels * (HCLK / 10000) / cycles */
+    const uint64_t num = (uint64_t)pixels * (uint64_t)(SystemCoreClock / 10000U);
+    return (uint32_t)(num / (uint64_t)cycles);
+}
+
+uint32_t bench_rate_per_s(uint32_t items, uint32_t cycles)
+{
+    if (cycles == 0U)
+    {
+        return 0U;
+    }
+
+    return (uint32_t)(((uint64_t)items * (uint64_t)SystemCoreClock) / (uint64_t)cycles);
+}
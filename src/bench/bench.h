@@ -0,0 +1,38 @@
+#ifndef BENCH_BENCH_H
+#define BENCH_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief 基于 DWT CYCCNT 的周期计数工具（Cortex-M4 内核自带，1 cycle = 1/HCLK）。
+ *
+ * 32-bit 计数器在 168MHz 下约 25.5s 回绕，单次测量区间需小于该值。
+ */
+
+/** 使能 DWT 周期计数器（TRCENA + CYCCNTENA），可重复调用。 */
+void bench_init(void);
+
+/** 读取当前周期计数。 */
+uint32_t bench_cycles(void);
+
+/**
+ * @brief 由像素数与耗时换算吞吐率。
+ * @return MPix/s × 100（定点，避免浮点），cycles 为 0 时返回 0。
+ */
+uint32_t bench_mpix_x100(uint32_t pixels, uint32_t cycles);
+
+/**
+ * @brief 通用速率换算：items 个操作耗时 cycles，返回每秒操作数（像素/秒、字符/秒...）。
+ * @return cycles 为 0 时返回 0。
+ */
+uint32_t bench_rate_per_s(uint32_t items, uint32_t cycles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_BENCH_H */
@@ -0,0 +1,158 @@
+#include "bench/bench_blend.h"
+
+#include <stdbool.h>
+
+#include "bench/bench.h"
+#include "gfx/blend.h"
+
+#define BENCH_BLEND_SEED   (0x2468ACEUL)
+#define BENCH_BLEND_TRIALS (64U)
+
+/* 多留 1 个像素，用于 dst/src 错开半字的对齐组合 */
+static lcd_color565_t bench_blend_src[BENCH_BLEND_MAX_PIXELS + 1U];
+static lcd_color565_t bench_blend_dst_simd[BENCH_BLEND_MAX_PIXELS + 1U];
+static lcd_color565_t bench_blend_dst_ref[BENCH_BLEND_MAX_PIXELS + 1U];
+static uint8_t bench_blend_alpha[BENCH_BLEND_MAX_PIXELS + 1U];
+
+static uint32_t bench_blend_rng;
+
+static uint32_t bench_blend_rand(void)
+{
+    bench_blend_rng = (bench_blend_rng * 1664525UL) + 1013904223UL;
+    return bench_blend_rng >> 8;
+}
+
+typedef enum
+{
+    BENCH_BLEND_OVER = 0,
+    BENCH_BLEND_CONST,
+    BENCH_BLEND_FADE,
+    BENCH_BLEND_ADD,
+} bench_blend_kind_t;
+
+static void bench_blend_fill(void)
+{
+    for (uint32_t i = 0U; i < (BENCH_BLEND_MAX_PIXELS + 1U); i++)
+    {
+        const lcd_color565_t d = (lcd_color565_t)bench_blend_rand();
+        bench_blend_src[i] = (lcd_color565_t)bench_blend_rand();
+        bench_blend_alpha[i] = (uint8_t)bench_blend_rand();
+        bench_blend_dst_simd[i] = d;
+        bench_blend_dst_ref[i] = d;
+    }
+}
+
+static void bench_blend_run(bench_blend_kind_t kind, bool ref, lcd_color565_t *dst, const lcd_color565_t *src,
+                            const uint8_t *alpha, uint32_t n)
+{
+    /* 常数参数取自 alpha[0]/src[0]，两条路径一致 */
+    switch (kind)
+    {
+    case BENCH_BLEND_OVER:
+        if (ref)
+        {
+            gfx_blend_span_over_ref(dst, src, alpha, n);
+        }
+        else
+        {
+            gfx_blend_span_over(dst, src, alpha, n);
+        }
+        break;
+    case BENCH_BLEND_CONST:
+        if (ref)
+        {
+            gfx_blend_span_const_ref(dst, src, alpha[0], n);
+        }
+        else
+        {
+            gfx_blend_span_const(dst, src, alpha[0], n);
+        }
+        break;
+    case BENCH_BLEND_FADE:
+        if (ref)
+        {
+            gfx_blend_span_fade_ref(dst, src[0], alpha[0], n);
+        }
+        else
+        {
+            gfx_blend_span_fade(dst, src[0], alpha[0], n);
+        }
+        break;
+    case BENCH_BLEND_ADD:
+    default:
+        if (ref)
+        {
+            gfx_blend_span_add_ref(dst, src, n);
+        }
+        else
+        {
+            gfx_blend_span_add(dst, src, n);
+        }
+        break;
+    }
+}
+
+static uint32_t bench_blend_check(bench_blend_kind_t kind, uint32_t max_pixels)
+{
+    uint32_t bad = 0U;
+
+    for (uint32_t t = 0U; t < BENCH_BLEND_TRIALS; t++)
+    {
+        const uint32_t doff = t & 1U;
+        const uint32_t soff = (t >> 1) & 1U;
+        const uint32_t n = bench_blend_rand() % (max_pixels + 1U);
+
+        bench_blend_fill();
+        bench_blend_run(kind, false, &bench_blend_dst_simd[doff], &bench_blend_src[soff], bench_blend_alpha, n);
+        bench_blend_run(kind, true, &bench_blend_dst_ref[doff], &bench_blend_src[soff], bench_blend_alpha, n);
+
+        /* 整个缓冲区比对：同时检查越界写 */
+        for (uint32_t i = 0U; i < (BENCH_BLEND_MAX_PIXELS + 1U); i++)
+        {
+            if (bench_blend_dst_simd[i] != bench_blend_dst_ref[i])
+            {
+                bad++;
+            }
+        }
+    }
+
+    return bad;
+}
+
+static void bench_blend_item(bench_blend_item_t *item, bench_blend_kind_t kind, uint32_t pixels)
+{
+    uint32_t t0;
+
+    bench_blend_rng = BENCH_BLEND_SEED;
+    item->mismatches = bench_blend_check(kind, pixels);
+
+    bench_blend_fill();
+    t0 = bench_cycles();
+    bench_blend_run(kind, false, bench_blend_dst_simd, bench_blend_src, bench_blend_alpha, pixels);
+    item->simd_cycles = bench_cycles() - t0;
+
+    t0 = bench_cycles();
+    bench_blend_run(kind, true, bench_blend_dst_ref, bench_blend_src, bench_blend_alpha, pixels);
+    item->ref_cycles = bench_cycles() - t0;
+
+    item->pixels = pixels;
+    item->simd_cpp_x100 = (item->simd_cycles * 100U) / pixels;
+    item->ref_cpp_x100 = (item->ref_cycles * 100U) / pixels;
+}
+
+void bench_blend_kernels(bench_blend_result_t *out, uint32_t pixels)
+{
+    if ((out == 0) || (pixels == 0U))
+    {
+        return;
+    }
+    if (pixels > BENCH_BLEND_MAX_PIXELS)
+    {
+        pixels = BENCH_BLEND_MAX_PIXELS;
+    }
+
+    bench_blend_item(&out->over, BENCH_BLEND_OVER, pixels);
+    bench_blend_item(&out->cnst, BENCH_BLEND_CONST, pixels);
+    bench_blend_item(&out->fade, BENCH_BLEND_FADE, pixels);
+    bench_blend_item(&out->add, BENCH_BLEND_ADD, pixels);
+}
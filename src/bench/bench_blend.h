@@ -0,0 +1,46 @@
+#ifndef BENCH_BENCH_BLEND_H
+#define BENCH_BENCH_BLEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief RGB565 合成内核（src/gfx/blend.h）：字内核 vs 逐像素参考实现。
+ *
+ * 先在随机数据、随机长度、四种 dst/src 对齐组合下比对两者输出（mismatches 应为 0），
+ * 再对 pixels 个像素分别计时，给出 cycles/pixel。不访问 LCD，只需先调用 bench_init()。
+ * 详见: src/bench/bench.md
+ */
+
+/** 单次测量的最大像素数（静态缓冲区位于 SRAM）。 */
+#define BENCH_BLEND_MAX_PIXELS (1024U)
+
+typedef struct
+{
+    uint32_t pixels;
+    uint32_t simd_cycles;      /* gfx_blend_span_*() */
+    uint32_t ref_cycles;       /* gfx_blend_span_*_ref() */
+    uint32_t simd_cpp_x100;    /* cycles/pixel × 100 */
+    uint32_t ref_cpp_x100;     /* cycles/pixel × 100 */
+    uint32_t mismatches;       /* 等价性校验中结果不同的像素数 */
+} bench_blend_item_t;
+
+typedef struct
+{
+    bench_blend_item_t over;   /* 逐像素 alpha，均匀随机 0..255（无整字跳过/拷贝） */
+    bench_blend_item_t cnst;   /* 常数 alpha */
+    bench_blend_item_t fade;   /* 向纯色淡化 */
+    bench_blend_item_t add;    /* 饱和加色 */
+} bench_blend_result_t;
+
+/** @brief pixels 超过 BENCH_BLEND_MAX_PIXELS 时按最大值计。 */
+void bench_blend_kernels(bench_blend_result_t *out, uint32_t pixels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_BENCH_BLEND_H */
@@ -0,0 +1,93 @@
+#include "bench/bench_conv.h"
+
+#include <stdbool.h>
+
+#include "bench/bench.h"
+#include "gfx/convert.h"
+
+/* 按 ARGB8888 的大小分配，RGB888 / GRAY8 复用同一块字节 */
+static uint32_t bench_conv_src[BENCH_CONV_MAX_PIXELS];
+static lcd_color565_t bench_conv_dst[BENCH_CONV_MAX_PIXELS];
+static uint8_t bench_conv_alpha[BENCH_CONV_MAX_PIXELS];
+
+typedef enum
+{
+    BENCH_CONV_RGB888 = 0,
+    BENCH_CONV_ARGB8888,
+    BENCH_CONV_GRAY8,
+} bench_conv_kind_t;
+
+static void bench_conv_item(bench_conv_item_t *item, bench_conv_kind_t kind, bool dither, uint32_t pixels)
+{
+    const uint8_t *bytes = (const uint8_t *)(const void *)bench_conv_src;
+    uint32_t t0;
+
+    /* 起点坐标 (1, 1)：抖动相位不从 0 开始 */
+    t0 = bench_cycles();
+    switch (kind)
+    {
+    case BENCH_CONV_RGB888:
+        if (dither)
+        {
+            gfx_conv_rgb888_dither(bench_conv_dst, bytes, pixels, 1U, 1U);
+        }
+        else
+        {
+            gfx_conv_rgb888(bench_conv_dst, bytes, pixels);
+        }
+        break;
+    case BENCH_CONV_ARGB8888:
+        if (dither)
+        {
+            gfx_conv_argb8888_dither(bench_conv_dst, bench_conv_alpha, bench_conv_src, pixels, 1U, 1U);
+        }
+        else
+        {
+            gfx_conv_argb8888(bench_conv_dst, bench_conv_alpha, bench_conv_src, pixels);
+        }
+        break;
+    case BENCH_CONV_GRAY8:
+    default:
+        if (dither)
+        {
+            gfx_conv_gray8_dither(bench_conv_dst, bytes, pixels, 1U, 1U);
+        }
+        else
+        {
+            gfx_conv_gray8(bench_conv_dst, bytes, pixels);
+        }
+        break;
+    }
+    item->cycles = bench_cycles() - t0;
+
+    item->pixels = pixels;
+    item->mpix_x100 = bench_mpix_x100(pixels, item->cycles);
+    item->cpp_x100 = (item->cycles * 100U) / pixels;
+}
+
+void bench_conv_formats(bench_conv_result_t *out, uint32_t pixels)
+{
+    uint32_t seed = 0x13579BDUL;
+
+    if ((out == 0) || (pixels == 0U))
+    {
+        return;
+    }
+    if (pixels > BENCH_CONV_MAX_PIXELS)
+    {
+        pixels = BENCH_CONV_MAX_PIXELS;
+    }
+
+    for (uint32_t i = 0U; i < BENCH_CONV_MAX_PIXELS; i++)
+    {
+        seed = (seed * 1664525UL) + 1013904223UL;
+        bench_conv_src[i] = seed;
+    }
+
+    bench_conv_item(&out->rgb888, BENCH_CONV_RGB888, false, pixels);
+    bench_conv_item(&out->rgb888_dither, BENCH_CONV_RGB888, true, pixels);
+    bench_conv_item(&out->argb8888, BENCH_CONV_ARGB8888, false, pixels);
+    bench_conv_item(&out->argb8888_dither, BENCH_CONV_ARGB8888, true, pixels);
+    bench_conv_item(&out->gray8, BENCH_CONV_GRAY8, false, pixels);
+    bench_conv_item(&out->gray8_dither, BENCH_CONV_GRAY8, true, pixels);
+}
@@ -0,0 +1,45 @@
+#ifndef BENCH_BENCH_CONV_H
+#define BENCH_BENCH_CONV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief 像素格式转换吞吐率（src/gfx/convert.h），每种源格式分别测截断与有序抖动两种模式。
+ *
+ * 源/目的缓冲区均在 SRAM，不访问 LCD，只需先调用 bench_init()。
+ * 详见: src/bench/bench.md
+ */
+
+/** 单次测量的最大像素数。 */
+#define BENCH_CONV_MAX_PIXELS (1024U)
+
+typedef struct
+{
+    uint32_t pixels;
+    uint32_t cycles;
+    uint32_t mpix_x100;      /* MPix/s × 100 */
+    uint32_t cpp_x100;       /* cycles/pixel × 100 */
+} bench_conv_item_t;
+
+typedef struct
+{
+    bench_conv_item_t rgb888;
+    bench_conv_item_t rgb888_dither;
+    bench_conv_item_t argb8888;         /* 同时输出 alpha */
+    bench_conv_item_t argb8888_dither;
+    bench_conv_item_t gray8;
+    bench_conv_item_t gray8_dither;
+} bench_conv_result_t;
+
+/** @brief pixels 超过 BENCH_CONV_MAX_PIXELS 时按最大值计。 */
+void bench_conv_formats(bench_conv_result_t *out, uint32_t pixels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_BENCH_CONV_H */
@@ -0,0 +1,133 @@
+#include "bench/bench_font.h"
+
+#include "bench/bench.h"
+#include "gfx/blend.h"
+#include "lcd/lcd.h"
+
+#define BENCH_FONT_FG (0xFFFFU)
+#define BENCH_FONT_BG (0x0010U)
+
+/* 典型状态栏文本，循环铺满一行：23 个不同字形，少于默认槽数 */
+static const char bench_font_sample[] = "CPU 168MHz  FPS 60.0  T=23.5C  RX 1024B  ";
+
+/* 一行文本（按最窄 6 像素字宽分配）与逐字形基准用的字形缓冲区（SRAM，DMA 可达） */
+static char bench_font_text_buf[(LCD_PANEL_LONG_SIDE / 6U) + 1U];
+static lcd_color565_t bench_font_glyph[FONT_CACHE_MAX_PIXELS];
+
+typedef enum
+{
+    BENCH_FONT_LINE = 0,
+    BENCH_FONT_LINE_COLD,
+    BENCH_FONT_PER_GLYPH,
+    BENCH_FONT_EXPAND_LUT,
+    BENCH_FONT_EXPAND_BLEND,
+} bench_font_kind_t;
+
+/* 不查表、逐像素 gfx_blend565() 的字形展开，对照 font_render_glyph() 的颜色表 */
+static void bench_font_expand_blend(lcd_color565_t *dst, const font_t *font, char ch)
+{
+    const uint8_t *bits = &font->bitmap[(uint32_t)((uint8_t)ch - font->first) * font->glyph_bytes];
+    const uint32_t n = (uint32_t)font->width * font->height;
+
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        uint32_t q;
+
+        if (font->bpp == 4U)
+        {
+            q = ((i & 1U) != 0U) ? (bits[i >> 1] & 0x0FU) : (bits[i >> 1] >> 4);
+        }
+        else
+        {
+            q = ((bits[i >> 3] >> (7U - (i & 7U))) & 1U) * 15U;
+        }
+        dst[i] = gfx_blend565(BENCH_FONT_FG, BENCH_FONT_BG, (uint8_t)(q * 17U));
+    }
+}
+
+static void bench_font_item(bench_font_item_t *item, bench_font_kind_t kind, const font_t *font, uint32_t passes)
+{
+    const uint32_t cols = lcd_width() / font->width;
+    const uint32_t rows = lcd_height() / font->height;
+    uint32_t t0;
+
+    t0 = bench_cycles();
+    for (uint32_t p = 0U; p < passes; p++)
+    {
+        for (uint32_t r = 0U; r < rows; r++)
+        {
+            const uint16_t y = (uint16_t)(r * font->height);
+
+            switch (kind)
+            {
+            case BENCH_FONT_PER_GLYPH:
+                for (uint32_t c = 0U; c < cols; c++)
+                {
+                    font_render_glyph(bench_font_glyph, font, bench_font_text_buf[c], BENCH_FONT_FG, BENCH_FONT_BG);
+                    lcd_blit((uint16_t)(c * font->width), y, font->width, font->height, bench_font_glyph);
+                }
+                break;
+            case BENCH_FONT_EXPAND_LUT:
+                for (uint32_t c = 0U; c < cols; c++)
+                {
+                    font_render_glyph(bench_font_glyph, font, bench_font_text_buf[c], BENCH_FONT_FG, BENCH_FONT_BG);
+                }
+                break;
+            case BENCH_FONT_EXPAND_BLEND:
+                for (uint32_t c = 0U; c < cols; c++)
+                {
+                    bench_font_expand_blend(bench_font_glyph, font, bench_font_text_buf[c]);
+                }
+                break;
+            case BENCH_FONT_LINE_COLD:
+                font_cache_clear();
+                font_draw_string(0U, y, bench_font_text_buf, font, BENCH_FONT_FG, BENCH_FONT_BG);
+                break;
+            case BENCH_FONT_LINE:
+            default:
+                font_draw_string(0U, y, bench_font_text_buf, font, BENCH_FONT_FG, BENCH_FONT_BG);
+                break;
+            }
+        }
+    }
+    item->cycles = bench_cycles() - t0;
+
+    item->chars = passes * rows * cols;
+    item->chars_per_s = bench_rate_per_s(item->chars, item->cycles);
+}
+
+void bench_font_text(bench_font_result_t *out, const font_t *font, uint32_t passes)
+{
+    uint32_t cols;
+
+    if ((out == 0) || (font == 0) || (font->width < 6U)
+        || (((uint32_t)font->width * font->height) > FONT_CACHE_MAX_PIXELS))
+    {
+        return;
+    }
+    if (passes == 0U)
+    {
+        passes = 1U;
+    }
+
+    cols = lcd_width() / font->width;
+    for (uint32_t c = 0U; c < cols; c++)
+    {
+        bench_font_text_buf[c] = bench_font_sample[c % (sizeof(bench_font_sample) - 1U)];
+    }
+    bench_font_text_buf[cols] = '\0';
+
+    lcd_clear(BENCH_FONT_BG);
+
+    bench_font_item(&out->per_glyph, BENCH_FONT_PER_GLYPH, font, passes);
+    bench_font_item(&out->line_cold, BENCH_FONT_LINE_COLD, font, passes);
+    bench_font_item(&out->expand_lut, BENCH_FONT_EXPAND_LUT, font, passes);
+    bench_font_item(&out->expand_blend, BENCH_FONT_EXPAND_BLEND, font, passes);
+
+    /* 预热后再计时 */
+    font_cache_clear();
+    font_draw_string(0U, 0U, bench_font_text_buf, font, BENCH_FONT_FG, BENCH_FONT_BG);
+    font_cache_reset_stats();
+    bench_font_item(&out->line_cached, BENCH_FONT_LINE, font, passes);
+    font_cache_get_stats(&out->cached_stats);
+}
@@ -0,0 +1,45 @@
+#ifndef BENCH_BENCH_FONT_H
+#define BENCH_BENCH_FONT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "font/font.h"
+
+/**
+ * @brief 文本渲染吞吐率（字符/秒）：按行推送 + 字形缓存 vs 每字形一次窗口，
+ *        以及字形展开时颜色表 vs 逐像素混合。
+ *
+ * 每一项都用同一段可打印 ASCII 文本把整个屏幕写满 passes 遍。
+ * 需先完成 lcd_panel_init() 与 bench_init()。
+ * 详见: src/bench/bench.md
+ */
+
+typedef struct
+{
+    uint32_t chars;           /* 绘制的字符数 */
+    uint32_t cycles;
+    uint32_t chars_per_s;
+} bench_font_item_t;
+
+typedef struct
+{
+    bench_font_item_t line_cached;   /* font_draw_string()，缓存已预热 */
+    bench_font_item_t line_cold;     /* font_draw_string()，每行前清空缓存 */
+    bench_font_item_t per_glyph;     /* font_render_glyph() + 每字形一次 lcd_blit() */
+    bench_font_item_t expand_lut;    /* 仅 font_render_glyph()：颜色表展开，不访问 LCD */
+    bench_font_item_t expand_blend;  /* 仅展开：逐像素 gfx_blend565()，不访问 LCD */
+    font_cache_stats_t cached_stats; /* line_cached 期间的缓存统计 */
+} bench_font_result_t;
+
+/** @brief 会覆盖整个屏幕内容；passes 为 0 时按 1 计。 */
+void bench_font_text(bench_font_result_t *out, const font_t *font, uint32_t passes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_BENCH_FONT_H */
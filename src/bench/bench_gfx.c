@@ -0,0 +1,296 @@
+#include "bench/bench_gfx.h"
+
+#include "bench/bench.h"
+#include "gfx/gfx.h"
+#include "lcd/lcd.h"
+
+#define BENCH_GFX_SEED (0x1234567UL)
+
+/* 线性同余随机数：两条路径用同一种子得到相同图元 */
+static uint32_t bench_gfx_rng;
+
+static int16_t bench_gfx_rand(int32_t lo, int32_t hi)
+{
+    bench_gfx_rng = (bench_gfx_rng * 1664525UL) + 1013904223UL;
+    return (int16_t)(lo + (int32_t)((bench_gfx_rng >> 16) % (uint32_t)(hi - lo + 1)));
+}
+
+static lcd_color565_t bench_gfx_color(void)
+{
+    return (lcd_color565_t)bench_gfx_rand(1, 0xFFFF);
+}
+
+/* ----------------------------- 朴素逐点实现（对照组） ----------------------------- */
+
+static void bench_gfx_plot(int32_t x, int32_t y, lcd_color565_t c)
+{
+    if ((x >= 0) && (y >= 0))
+    {
+        lcd_draw_pixel((uint16_t)x, (uint16_t)y, c);
+    }
+}
+
+static void naive_line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, lcd_color565_t c)
+{
+    const int32_t dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+    const int32_t dy = (y1 > y0) ? (y0 - y1) : (y1 - y0);
+    const int32_t sx = (x0 < x1) ? 1 : -1;
+    const int32_t sy = (y0 < y1) ? 1 : -1;
+    int32_t err = dx + dy;
+
+    for (;;)
+    {
+        bench_gfx_plot(x0, y0, c);
+        if ((x0 == x1) && (y0 == y1))
+        {
+            break;
+        }
+        const int32_t e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+static void naive_circle(int32_t cx, int32_t cy, int32_t r, lcd_color565_t c)
+{
+    int32_t x = r;
+    int32_t y = 0;
+    int32_t err = 1 - r;
+
+    while (x >= y)
+    {
+        bench_gfx_plot(cx + x, cy + y, c);
+        bench_gfx_plot(cx - x, cy + y, c);
+        bench_gfx_plot(cx + x, cy - y, c);
+        bench_gfx_plot(cx - x, cy - y, c);
+        bench_gfx_plot(cx + y, cy + x, c);
+        bench_gfx_plot(cx - y, cy + x, c);
+        bench_gfx_plot(cx + y, cy - x, c);
+        bench_gfx_plot(cx - y, cy - x, c);
+
+        y++;
+        if (err < 0)
+        {
+            err += (2 * y) + 1;
+        }
+        else
+        {
+            x--;
+            err += (2 * (y - x)) + 1;
+        }
+    }
+}
+
+static void naive_fill_circle(int32_t cx, int32_t cy, int32_t r, lcd_color565_t c)
+{
+    const int32_t r2 = (r * r) + r;
+    for (int32_t dy = -r; dy <= r; dy++)
+    {
+        for (int32_t dx = -r; dx <= r; dx++)
+        {
+            if (((dx * dx) + (dy * dy)) <= r2)
+            {
+                bench_gfx_plot(cx + dx, cy + dy, c);
+            }
+        }
+    }
+}
+
+static void naive_fill_round_rect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, lcd_color565_t c)
+{
+    const int32_t r2 = (r * r) + r;
+    for (int32_t j = 0; j < h; j++)
+    {
+        for (int32_t i = 0; i < w; i++)
+        {
+            /* 到最近圆角圆心的偏移（直边区域为 0） */
+            const int32_t dx = (i < r) ? (r - i) : ((i > (w - 1 - r)) ? (i - (w - 1 - r)) : 0);
+            const int32_t dy = (j < r) ? (r - j) : ((j > (h - 1 - r)) ? (j - (h - 1 - r)) : 0);
+            if (((dx * dx) + (dy * dy)) <= r2)
+            {
+                bench_gfx_plot(x + i, y + j, c);
+            }
+        }
+    }
+}
+
+static int32_t naive_edge(int32_t ax, int32_t ay, int32_t bx, int32_t by, int32_t px, int32_t py)
+{
+    return ((bx - ax) * (py - ay)) - ((by - ay) * (px - ax));
+}
+
+static void naive_fill_triangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                                lcd_color565_t c)
+{
+    int32_t minx = x0, maxx = x0, miny = y0, maxy = y0;
+    minx = (x1 < minx) ? x1 : minx;
+    minx = (x2 < minx) ? x2 : minx;
+    maxx = (x1 > maxx) ? x1 : maxx;
+    maxx = (x2 > maxx) ? x2 : maxx;
+    miny = (y1 < miny) ? y1 : miny;
+    miny = (y2 < miny) ? y2 : miny;
+    maxy = (y1 > maxy) ? y1 : maxy;
+    maxy = (y2 > maxy) ? y2 : maxy;
+
+    /* 包围盒内逐点做三条边函数测试（两种绕向都接受） */
+    for (int32_t y = miny; y <= maxy; y++)
+    {
+        for (int32_t x = minx; x <= maxx; x++)
+        {
+            const int32_t e0 = naive_edge(x0, y0, x1, y1, x, y);
+            const int32_t e1 = naive_edge(x1, y1, x2, y2, x, y);
+            const int32_t e2 = naive_edge(x2, y2, x0, y0, x, y);
+            if (((e0 >= 0) && (e1 >= 0) && (e2 >= 0)) || ((e0 <= 0) && (e1 <= 0) && (e2 <= 0)))
+            {
+                bench_gfx_plot(x, y, c);
+            }
+        }
+    }
+}
+
+/* ----------------------------- 计时 ----------------------------- */
+
+typedef enum
+{
+    BENCH_GFX_LINE = 0,
+    BENCH_GFX_CIRCLE,
+    BENCH_GFX_FILL_CIRCLE,
+    BENCH_GFX_FILL_ROUND_RECT,
+    BENCH_GFX_FILL_TRIANGLE,
+} bench_gfx_kind_t;
+
+static void bench_gfx_draw(bench_gfx_kind_t kind, bool naive)
+{
+    const lcd_color565_t c = bench_gfx_color();
+
+    switch (kind)
+    {
+    case BENCH_GFX_LINE:
+    {
+        const int16_t x0 = bench_gfx_rand(0, lcd_width() - 1);
+        const int16_t y0 = bench_gfx_rand(0, lcd_height() - 1);
+        const int16_t x1 = bench_gfx_rand(0, lcd_width() - 1);
+        const int16_t y1 = bench_gfx_rand(0, lcd_height() - 1);
+        if (naive)
+        {
+            naive_line(x0, y0, x1, y1, c);
+        }
+        else
+        {
+            gfx_line(x0, y0, x1, y1, c);
+        }
+        break;
+    }
+    case BENCH_GFX_CIRCLE:
+    case BENCH_GFX_FILL_CIRCLE:
+    {
+        const int16_t r = bench_gfx_rand(5, 60);
+        const int16_t cx = bench_gfx_rand(r, lcd_width() - 1 - r);
+        const int16_t cy = bench_gfx_rand(r, lcd_height() - 1 - r);
+        if (kind == BENCH_GFX_CIRCLE)
+        {
+            if (naive)
+            {
+                naive_circle(cx, cy, r, c);
+            }
+            else
+            {
+                gfx_circle(cx, cy, r, c);
+            }
+        }
+        else if (naive)
+        {
+            naive_fill_circle(cx, cy, r, c);
+        }
+        else
+        {
+            gfx_fill_circle(cx, cy, r, c);
+        }
+        break;
+    }
+    case BENCH_GFX_FILL_ROUND_RECT:
+    {
+        const int16_t w = bench_gfx_rand(20, 120);
+        const int16_t h = bench_gfx_rand(20, 120);
+        const int16_t x = bench_gfx_rand(0, lcd_width() - w);
+        const int16_t y = bench_gfx_rand(0, lcd_height() - h);
+        if (naive)
+        {
+            naive_fill_round_rect(x, y, w, h, 8, c);
+        }
+        else
+        {
+            gfx_fill_round_rect(x, y, w, h, 8, c);
+        }
+        break;
+    }
+    case BENCH_GFX_FILL_TRIANGLE:
+    default:
+    {
+        const int16_t ox = bench_gfx_rand(0, lcd_width() - 100);
+        const int16_t oy = bench_gfx_rand(0, lcd_height() - 100);
+        const int16_t x0 = (int16_t)(ox + bench_gfx_rand(0, 99));
+        const int16_t y0 = (int16_t)(oy + bench_gfx_rand(0, 99));
+        const int16_t x1 = (int16_t)(ox + bench_gfx_rand(0, 99));
+        const int16_t y1 = (int16_t)(oy + bench_gfx_rand(0, 99));
+        const int16_t x2 = (int16_t)(ox + bench_gfx_rand(0, 99));
+        const int16_t y2 = (int16_t)(oy + bench_gfx_rand(0, 99));
+        if (naive)
+        {
+            naive_fill_triangle(x0, y0, x1, y1, x2, y2, c);
+        }
+        else
+        {
+            gfx_fill_triangle(x0, y0, x1, y1, x2, y2, c);
+        }
+        break;
+    }
+    }
+}
+
+static void bench_gfx_item(bench_gfx_item_t *item, bench_gfx_kind_t kind, uint32_t count)
+{
+    uint32_t t0;
+
+    bench_gfx_rng = BENCH_GFX_SEED;
+    t0 = bench_cycles();
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        bench_gfx_draw(kind, false);
+    }
+    item->span_cycles = bench_cycles() - t0;
+
+    bench_gfx_rng = BENCH_GFX_SEED;
+    t0 = bench_cycles();
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        bench_gfx_draw(kind, true);
+    }
+    item->pixel_cycles = bench_cycles() - t0;
+
+    item->count = count;
+    item->span_per_s = bench_rate_per_s(count, item->span_cycles);
+    item->pixel_per_s = bench_rate_per_s(count, item->pixel_cycles);
+}
+
+void bench_gfx_primitives(bench_gfx_result_t *out, uint32_t count)
+{
+    if ((out == 0) || (count == 0U))
+    {
+        return;
+    }
+
+    bench_gfx_item(&out->line, BENCH_GFX_LINE, count);
+    bench_gfx_item(&out->circle, BENCH_GFX_CIRCLE, count);
+    bench_gfx_item(&out->fill_circle, BENCH_GFX_FILL_CIRCLE, count);
+    bench_gfx_item(&out->fill_round_rect, BENCH_GFX_FILL_ROUND_RECT, count);
+    bench_gfx_item(&out->fill_triangle, BENCH_GFX_FILL_TRIANGLE, count);
+}
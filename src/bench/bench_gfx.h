@@ -0,0 +1,42 @@
+#ifndef BENCH_BENCH_GFX_H
+#define BENCH_BENCH_GFX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief 图元吞吐率：gfx span 实现 vs 逐点 lcd_draw_pixel() 朴素实现。
+ *
+ * 两条路径使用相同随机种子生成完全相同的图元序列。需先完成 lcd_panel_init() 与 bench_init()。
+ * 详见: src/bench/bench.md
+ */
+
+typedef struct
+{
+    uint32_t count;          /* 图元个数 */
+    uint32_t span_cycles;    /* gfx_*() */
+    uint32_t pixel_cycles;   /* 朴素逐点实现 */
+    uint32_t span_per_s;     /* 图元/秒 */
+    uint32_t pixel_per_s;    /* 图元/秒 */
+} bench_gfx_item_t;
+
+typedef struct
+{
+    bench_gfx_item_t line;
+    bench_gfx_item_t circle;
+    bench_gfx_item_t fill_circle;
+    bench_gfx_item_t fill_round_rect;
+    bench_gfx_item_t fill_triangle;
+} bench_gfx_result_t;
+
+/** @brief 每类图元各画 count 个并计时（会覆盖整个屏幕内容）。 */
+void bench_gfx_primitives(bench_gfx_result_t *out, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_BENCH_GFX_H */
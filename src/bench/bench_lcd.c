@@ -0,0 +1,234 @@
+#include "bench/bench_lcd.h"
+
+#include "bench/bench.h"
+#include "lcd/lcd.h"
+#include "lcd/lcd_dma.h"
+
+#include "stm32f4xx.h"
+
+/* 两次填充使用不同颜色，肉眼也能确认两条路径都写到了屏上 */
+#define BENCH_LCD_COLOR_CPU ((lcd_color565_t)0xF800) /* RED */
+#define BENCH_LCD_COLOR_DMA ((lcd_color565_t)0x001F) /* BLUE */
+
+void bench_lcd_fill(bench_lcd_fill_result_t *out, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if (out == 0)
+    {
+        return;
+    }
+
+    const uint32_t pixels = (uint32_t)w * (uint32_t)h;
+    uint32_t t0;
+
+    /* 1) CPU：与原 lcd_fill_rect() 相同的逐像素写循环 */
+    t0 = bench_cycles();
+    lcd_set_window(x, y, w, h);
+    for (uint32_t i = 0U; i < pixels; i++)
+    {
+        lcd_write_data(BENCH_LCD_COLOR_CPU);
+    }
+    out->cpu_cycles = bench_cycles() - t0;
+
+    /* 2) DMA：lcd_fill_rect() 内部走 DMA2 M2M（含窗口设置）；启动后即返回，计时到传输完成 */
+    t0 = bench_cycles();
+    lcd_fill_rect(x, y, w, h, BENCH_LCD_COLOR_DMA);
+    lcd_dma_wait();
+    out->dma_cycles = bench_cycles() - t0;
+
+    out->pixels = pixels;
+    out->cpu_mpix_x100 = bench_mpix_x100(pixels, out->cpu_cycles);
+    out->dma_mpix_x100 = bench_mpix_x100(pixels, out->dma_cycles);
+}
+
+void bench_lcd_blit(bench_lcd_blit_result_t *out,
+                    uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                    const lcd_color565_t *src)
+{
+    if ((out == 0) || (src == 0))
+    {
+        return;
+    }
+
+    const uint32_t pixels = (uint32_t)w * (uint32_t)h;
+    uint32_t t0;
+
+    /* 1) 逐点：每行首像素设置窗口，行内后续像素命中写光标（见 lcd.md 第 17 节） */
+    t0 = bench_cycles();
+    for (uint16_t row = 0U; row < h; row++)
+    {
+        for (uint16_t col = 0U; col < w; col++)
+        {
+            lcd_draw_pixel((uint16_t)(x + col), (uint16_t)(y + row), src[(uint32_t)row * w + col]);
+        }
+    }
+    out->pixel_cycles = bench_cycles() - t0;
+
+    /* 2) CPU：一次窗口 + 展开写 */
+    t0 = bench_cycles();
+    lcd_set_window(x, y, w, h);
+    lcd_write_pixels(src, pixels);
+    out->cpu_cycles = bench_cycles() - t0;
+
+    /* 3) lcd_blit()：像素数超过 LCD_DMA_BLIT_MIN_PIXELS 时走 DMA */
+    t0 = bench_cycles();
+    lcd_blit(x, y, w, h, src);
+    out->blit_cycles = bench_cycles() - t0;
+
+    out->pixels = pixels;
+    out->pixel_px_per_s = bench_rate_per_s(pixels, out->pixel_cycles);
+    out->cpu_px_per_s = bench_rate_per_s(pixels, out->cpu_cycles);
+    out->blit_px_per_s = bench_rate_per_s(pixels, out->blit_cycles);
+}
+
+/* ----------------------------- 窗口 / 源存储器 / 读回 ----------------------------- */
+
+#define BENCH_LCD_SRC_PIXELS (BENCH_LCD_SRC_W * BENCH_LCD_SRC_H)
+
+/* 图样直接取 FLASH 起始处：内容固定、无需额外常量表 */
+#define BENCH_LCD_FLASH_SRC ((const lcd_color565_t *)FLASH_BASE)
+
+static lcd_color565_t bench_lcd_sram[BENCH_LCD_SRC_PIXELS] __attribute__((aligned(4)));
+static lcd_color565_t bench_lcd_readback[BENCH_LCD_SRC_PIXELS] __attribute__((aligned(4)));
+static lcd_color565_t bench_lcd_ccm[BENCH_LCD_SRC_PIXELS] __attribute__((section(".ccmbss"), aligned(4)));
+
+static void bench_lcd_load_pattern(void)
+{
+    for (uint32_t i = 0U; i < BENCH_LCD_SRC_PIXELS; i++)
+    {
+        bench_lcd_sram[i] = BENCH_LCD_FLASH_SRC[i];
+        bench_lcd_ccm[i] = BENCH_LCD_FLASH_SRC[i];
+    }
+}
+
+void bench_lcd_window(bench_lcd_window_result_t *out, uint32_t calls)
+{
+    uint32_t t0;
+
+    if (out == 0)
+    {
+        return;
+    }
+    if (calls == 0U)
+    {
+        calls = 1U;
+    }
+
+    /* 1) x/y 每次都变：0x2A/0x2B 都要重发 */
+    t0 = bench_cycles();
+    for (uint32_t i = 0U; i < calls; i++)
+    {
+        const uint16_t o = ((i & 1U) != 0U) ? 8U : 0U;
+        lcd_set_window(o, o, 8U, 8U);
+    }
+    out->changed_cycles = (bench_cycles() - t0) / calls;
+
+    /* 2) 同一窗口：只剩 0x2C */
+    lcd_set_window(0U, 0U, 8U, 8U);
+    t0 = bench_cycles();
+    for (uint32_t i = 0U; i < calls; i++)
+    {
+        lcd_set_window(0U, 0U, 8U, 8U);
+    }
+    out->same_cycles = (bench_cycles() - t0) / calls;
+
+    out->calls = calls;
+}
+
+void bench_lcd_blit_src(bench_lcd_src_result_t *out, uint16_t x, uint16_t y)
+{
+    const lcd_color565_t *src[BENCH_LCD_MEM_COUNT];
+
+    if (out == 0)
+    {
+        return;
+    }
+
+    bench_lcd_load_pattern();
+    src[BENCH_LCD_MEM_SRAM] = bench_lcd_sram;
+    src[BENCH_LCD_MEM_CCMRAM] = bench_lcd_ccm;
+    src[BENCH_LCD_MEM_FLASH] = BENCH_LCD_FLASH_SRC;
+
+    for (uint32_t m = 0U; m < (uint32_t)BENCH_LCD_MEM_COUNT; m++)
+    {
+        const uint32_t t0 = bench_cycles();
+        lcd_blit(x, y, BENCH_LCD_SRC_W, BENCH_LCD_SRC_H, src[m]);
+        out->cycles[m] = bench_cycles() - t0;
+        out->mpix_x100[m] = bench_mpix_x100(BENCH_LCD_SRC_PIXELS, out->cycles[m]);
+    }
+
+    out->pixels = BENCH_LCD_SRC_PIXELS;
+}
+
+void bench_lcd_read(bench_lcd_read_result_t *out, uint16_t x, uint16_t y)
+{
+    uint32_t t0;
+    uint32_t bad = 0U;
+
+    if (out == 0)
+    {
+        return;
+    }
+
+    bench_lcd_load_pattern();
+    lcd_blit(x, y, BENCH_LCD_SRC_W, BENCH_LCD_SRC_H, bench_lcd_sram);
+
+    for (uint32_t i = 0U; i < BENCH_LCD_SRC_PIXELS; i++)
+    {
+        bench_lcd_readback[i] = (lcd_color565_t)~bench_lcd_sram[i];
+    }
+
+    t0 = bench_cycles();
+    (void)lcd_read_rect(x, y, BENCH_LCD_SRC_W, BENCH_LCD_SRC_H, bench_lcd_readback);
+    out->cycles = bench_cycles() - t0;
+
+    for (uint32_t i = 0U; i < BENCH_LCD_SRC_PIXELS; i++)
+    {
+        if (bench_lcd_readback[i] != bench_lcd_sram[i])
+        {
+            bad++;
+        }
+    }
+
+    out->pixels = BENCH_LCD_SRC_PIXELS;
+    out->mpix_x100 = bench_mpix_x100(BENCH_LCD_SRC_PIXELS, out->cycles);
+    out->mismatches = bad;
+}
+
+/* ----------------------------- FSMC 时序扫描 ----------------------------- */
+
+void bench_lcd_timing_sweep(bench_lcd_timing_row_t *rows, const lcd_fsmc_timing_t *timings, uint32_t count)
+{
+    lcd_fsmc_timing_t saved;
+
+    if ((rows == 0) || (timings == 0))
+    {
+        return;
+    }
+
+    lcd_fsmc_get_timing(&saved);
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        const uint32_t screen = (uint32_t)lcd_width() * lcd_height();
+        bench_lcd_src_result_t s;
+        bench_lcd_read_result_t r;
+        uint32_t t0;
+
+        lcd_fsmc_set_timing(&timings[i]);
+        rows[i].timing = timings[i];
+
+        t0 = bench_cycles();
+        lcd_clear(BENCH_LCD_COLOR_DMA);
+        lcd_dma_wait();
+        rows[i].clear_mpix_x100 = bench_mpix_x100(screen, bench_cycles() - t0);
+
+        bench_lcd_blit_src(&s, 0U, 0U);
+        rows[i].blit_mpix_x100 = s.mpix_x100[BENCH_LCD_MEM_SRAM];
+
+        bench_lcd_read(&r, 0U, 0U);
+        rows[i].read_mpix_x100 = r.mpix_x100;
+        rows[i].read_mismatches = r.mismatches;
+    }
+
+    lcd_fsmc_set_timing(&saved);
+}
@@ -0,0 +1,132 @@
+#ifndef BENCH_BENCH_LCD_H
+#define BENCH_BENCH_LCD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "lcd/lcd.h"
+
+/**
+ * @brief LCD 吞吐率测量（DWT 周期计数），需先完成 lcd_panel_init() 与 bench_init()。
+ *
+ * 结果以结构体返回，可在调试器中直接查看；bench_lcd_app_run() 汇总后输出到串口与屏幕。
+ * 详见: src/bench/bench.md
+ */
+
+/** 填充：CPU 逐像素写 LCD_DATA 与 DMA2 M2M 填充的对比。 */
+typedef struct
+{
+    uint32_t pixels;
+    uint32_t cpu_cycles;
+    uint32_t dma_cycles;
+    uint32_t cpu_mpix_x100; /* MPix/s × 100 */
+    uint32_t dma_mpix_x100; /* MPix/s × 100 */
+} bench_lcd_fill_result_t;
+
+/**
+ * @brief 对同一矩形分别用 CPU 循环和 lcd_fill_rect()(DMA) 填充并计时。
+ *
+ * 矩形需完全位于屏幕内（像素数按 w*h 计算）；传入全屏即等价于对比 lcd_clear()。
+ */
+void bench_lcd_fill(bench_lcd_fill_result_t *out, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/** 缓冲区推送：逐点 lcd_draw_pixel() vs CPU 展开写 vs lcd_blit()(DMA)。 */
+typedef struct
+{
+    uint32_t pixels;
+    uint32_t pixel_cycles;   /* 逐点：lcd_draw_pixel()（行内连续画点只写数据） */
+    uint32_t cpu_cycles;     /* lcd_set_window() + lcd_write_pixels() */
+    uint32_t blit_cycles;    /* lcd_blit()：超过阈值走 DMA */
+    uint32_t pixel_px_per_s;
+    uint32_t cpu_px_per_s;
+    uint32_t blit_px_per_s;
+} bench_lcd_blit_result_t;
+
+/**
+ * @brief 用三条路径把同一个 w*h 缓冲区写到 (x,y) 并计时。
+ *
+ * 矩形需完全位于屏幕内；src 需位于 SRAM 才能测到 DMA 路径。
+ */
+void bench_lcd_blit(bench_lcd_blit_result_t *out,
+                    uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                    const lcd_color565_t *src);
+
+/** 窗口设置开销（平均每次调用的周期数）。 */
+typedef struct
+{
+    uint32_t calls;
+    uint32_t changed_cycles; /* 每次参数都变化：0x2A + 0x2B + 0x2C 各带参数 */
+    uint32_t same_cycles;    /* 参数不变：影子状态合并后只发 0x2C */
+} bench_lcd_window_result_t;
+
+/** @brief 交替设置两个不同窗口 / 反复设置同一窗口各 calls 次（calls 为 0 时按 1 计）。 */
+void bench_lcd_window(bench_lcd_window_result_t *out, uint32_t calls);
+
+/** 源/读回缓冲区大小：BENCH_LCD_SRC_W × BENCH_LCD_SRC_H 像素（SRAM / CCMRAM 各一份）。 */
+#ifndef BENCH_LCD_SRC_W
+#define BENCH_LCD_SRC_W (64U)
+#endif
+#ifndef BENCH_LCD_SRC_H
+#define BENCH_LCD_SRC_H (64U)
+#endif
+
+typedef enum
+{
+    BENCH_LCD_MEM_SRAM = 0, /* DMA2 */
+    BENCH_LCD_MEM_CCMRAM,   /* DMA 不可达，CPU 展开写 */
+    BENCH_LCD_MEM_FLASH,    /* DMA2 经 AHB 读 FLASH */
+    BENCH_LCD_MEM_COUNT
+} bench_lcd_mem_t;
+
+/** lcd_blit() 按源缓冲区所在存储器对比。 */
+typedef struct
+{
+    uint32_t pixels;
+    uint32_t cycles[BENCH_LCD_MEM_COUNT];
+    uint32_t mpix_x100[BENCH_LCD_MEM_COUNT];
+} bench_lcd_src_result_t;
+
+/**
+ * @brief 把同一幅 BENCH_LCD_SRC_W × BENCH_LCD_SRC_H 图像分别从 SRAM / CCMRAM / FLASH 推送到 (x,y) 并计时。
+ *
+ * 图像内容取自 FLASH 起始处（向量表与代码），三份数据完全相同。矩形需完全位于屏幕内。
+ */
+void bench_lcd_blit_src(bench_lcd_src_result_t *out, uint16_t x, uint16_t y);
+
+/** GRAM 读回速率。 */
+typedef struct
+{
+    uint32_t pixels;
+    uint32_t cycles;         /* lcd_read_rect()（目的在 SRAM，走 DMA2） */
+    uint32_t mpix_x100;
+    uint32_t mismatches;     /* 读回与写入不一致的像素数，应为 0 */
+} bench_lcd_read_result_t;
+
+/** @brief 先写入 BENCH_LCD_SRC_W × BENCH_LCD_SRC_H 图样，再读回计时并逐像素比对。 */
+void bench_lcd_read(bench_lcd_read_result_t *out, uint16_t x, uint16_t y);
+
+/** 一组 FSMC 时序下的吞吐率。 */
+typedef struct
+{
+    lcd_fsmc_timing_t timing;
+    uint32_t clear_mpix_x100; /* lcd_clear() */
+    uint32_t blit_mpix_x100;  /* SRAM 源 lcd_blit() */
+    uint32_t read_mpix_x100;  /* lcd_read_rect() */
+    uint32_t read_mismatches; /* 同 bench_lcd_read_result_t::mismatches，非 0 说明该时序不可用 */
+} bench_lcd_timing_row_t;
+
+/**
+ * @brief 依次切换到 timings[i]，测整屏清屏、推送与读回，结果写入 rows[i]；结束后恢复原时序。
+ *
+ * 过快的写时序可能让命令本身出错，建议只扫描 lcd_fsmc_calibrate() 确认过的档位。
+ */
+void bench_lcd_timing_sweep(bench_lcd_timing_row_t *rows, const lcd_fsmc_timing_t *timings, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_BENCH_LCD_H */
@@ -0,0 +1,157 @@
+#include "bench/bench_lcd_app.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "bench/bench.h"
+#include "bench/bench_lcd.h"
+#include "font/font.h"
+#include "usart/usart.h"
+
+#include "stm32f4xx.h"
+
+/* 屏幕报告：8x16 字体，竖屏 40 列 × 30 行 */
+#define BENCH_APP_FONT      (&font_mono16)
+#define BENCH_APP_COLS      (40U)
+#define BENCH_APP_LINES     (30U)
+#define BENCH_APP_FG        ((lcd_color565_t)0xFFFF) /* WHITE */
+#define BENCH_APP_BG        ((lcd_color565_t)0x0000) /* BLACK */
+
+/* 时序扫描：启动默认值、校准后写入值、校准得到的最快值 */
+#define BENCH_APP_TIMINGS   (3U)
+
+/* draw_pixel / write_pixels / blit 三路对比用的小图（SRAM，DMA 可达） */
+#define BENCH_APP_BLIT_W      (32U)
+#define BENCH_APP_BLIT_H      (32U)
+#define BENCH_APP_BLIT_PIXELS (BENCH_APP_BLIT_W * BENCH_APP_BLIT_H)
+
+static lcd_color565_t bench_app_blit_src[BENCH_APP_BLIT_PIXELS] __attribute__((aligned(4)));
+static char bench_app_text[BENCH_APP_LINES][BENCH_APP_COLS + 1U];
+static uint32_t bench_app_lines;
+
+/* 一行报告：立即发串口，同时留给最后的屏幕页 */
+static void bench_app_line(const char *fmt, ...)
+{
+    char buf[96];
+    va_list ap;
+
+    va_start(ap, fmt);
+    (void)vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+
+    usart_puts(buf);
+    usart_puts("\n");
+
+    if (bench_app_lines < BENCH_APP_LINES)
+    {
+        /* 屏幕一行只放 BENCH_APP_COLS 个字符，显式截断 */
+        (void)snprintf(bench_app_text[bench_app_lines], sizeof(bench_app_text[0]), "%.*s", (int)BENCH_APP_COLS, buf);
+        bench_app_lines++;
+    }
+}
+
+/* MPix/s × 100 -> "12.34" */
+static void bench_app_mpix(const char *name, uint32_t mpix_x100)
+{
+    bench_app_line("%-14s %4lu.%02lu MPix/s", name,
+                   (unsigned long)(mpix_x100 / 100U), (unsigned long)(mpix_x100 % 100U));
+}
+
+static void bench_app_rate(const char *name, uint32_t px_per_s)
+{
+    bench_app_line("%-14s %9lu px/s", name, (unsigned long)px_per_s);
+}
+
+static void bench_app_show(void)
+{
+    lcd_clear(BENCH_APP_BG);
+    for (uint32_t i = 0U; i < bench_app_lines; i++)
+    {
+        font_draw_string(0U, (uint16_t)(i * BENCH_APP_FONT->height), bench_app_text[i], BENCH_APP_FONT,
+                         BENCH_APP_FG, BENCH_APP_BG);
+    }
+}
+
+void bench_lcd_app_run(void)
+{
+    const uint16_t w = lcd_width();
+    const uint16_t h = lcd_height();
+    lcd_fsmc_timing_t timings[BENCH_APP_TIMINGS];
+    bench_lcd_timing_row_t rows[BENCH_APP_TIMINGS];
+    lcd_fsmc_cal_result_t cal;
+    bench_lcd_fill_result_t fill;
+    bench_lcd_blit_result_t blit;
+    bench_lcd_window_result_t win;
+    bench_lcd_src_result_t src;
+    bench_lcd_read_result_t rd;
+    uint32_t ntim = 1U;
+
+    usart_init(USART_DEFAULT_BAUD);
+    bench_init();
+    bench_app_lines = 0U;
+
+    for (uint32_t i = 0U; i < BENCH_APP_BLIT_PIXELS; i++)
+    {
+        bench_app_blit_src[i] = (lcd_color565_t)(i * 0x0841U);
+    }
+
+    bench_app_line("bench_lcd  HCLK %lu MHz  %ux%u", (unsigned long)(SystemCoreClock / 1000000U),
+                   (unsigned)w, (unsigned)h);
+
+    /* 1) 启动默认时序下的各项 */
+    lcd_fsmc_get_timing(&timings[0]);
+    bench_app_line("FSMC W %u/%u R %u/%u", (unsigned)timings[0].write_addset, (unsigned)timings[0].write_datast,
+                   (unsigned)timings[0].read_addset, (unsigned)timings[0].read_datast);
+
+    bench_lcd_fill(&fill, 0U, 0U, w, h);
+    bench_app_mpix("clear cpu", fill.cpu_mpix_x100);
+    bench_app_mpix("clear dma", fill.dma_mpix_x100);
+
+    bench_lcd_fill(&fill, 0U, 0U, 100U, 100U);
+    bench_app_mpix("rect100 cpu", fill.cpu_mpix_x100);
+    bench_app_mpix("rect100 dma", fill.dma_mpix_x100);
+
+    bench_lcd_blit(&blit, 0U, 0U, BENCH_APP_BLIT_W, BENCH_APP_BLIT_H, bench_app_blit_src);
+    bench_app_rate("draw_pixel", blit.pixel_px_per_s);
+    bench_app_rate("write_pixels", blit.cpu_px_per_s);
+    bench_app_rate("blit", blit.blit_px_per_s);
+
+    bench_lcd_window(&win, 1000U);
+    bench_app_line("%-14s %6lu cyc", "window new", (unsigned long)win.changed_cycles);
+    bench_app_line("%-14s %6lu cyc", "window same", (unsigned long)win.same_cycles);
+
+    bench_lcd_blit_src(&src, 0U, 0U);
+    bench_app_mpix("blit sram", src.mpix_x100[BENCH_LCD_MEM_SRAM]);
+    bench_app_mpix("blit ccmram", src.mpix_x100[BENCH_LCD_MEM_CCMRAM]);
+    bench_app_mpix("blit flash", src.mpix_x100[BENCH_LCD_MEM_FLASH]);
+
+    bench_lcd_read(&rd, 0U, 0U);
+    bench_app_mpix("read", rd.mpix_x100);
+    bench_app_line("%-14s %6lu px", "read errors", (unsigned long)rd.mismatches);
+
+    /* 2) 时序扫描：默认 / 校准写入值 / 校准最快值（校准失败时只测默认） */
+    if (lcd_fsmc_calibrate(&cal))
+    {
+        timings[1] = cal.applied;
+        timings[2] = cal.fastest;
+        ntim = BENCH_APP_TIMINGS;
+    }
+    bench_lcd_timing_sweep(rows, timings, ntim);
+
+    bench_app_line("W a/d  R a/d  clr  blit read err");
+    for (uint32_t i = 0U; i < ntim; i++)
+    {
+        bench_app_line("%2u/%-3u %2u/%-3u %4lu %4lu %4lu %lu",
+                       (unsigned)rows[i].timing.write_addset, (unsigned)rows[i].timing.write_datast,
+                       (unsigned)rows[i].timing.read_addset, (unsigned)rows[i].timing.read_datast,
+                       (unsigned long)(rows[i].clear_mpix_x100 / 100U),
+                       (unsigned long)(rows[i].blit_mpix_x100 / 100U),
+                       (unsigned long)(rows[i].read_mpix_x100 / 100U),
+                       (unsigned long)rows[i].read_mismatches);
+    }
+
+    /* 校准会保留 applied 时序；恢复启动默认值，报告页与测试前一致 */
+    lcd_fsmc_set_timing(&timings[0]);
+    bench_app_show();
+    usart_flush();
+}
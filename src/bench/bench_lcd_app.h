@@ -0,0 +1,28 @@
+#ifndef BENCH_BENCH_LCD_APP_H
+#define BENCH_BENCH_LCD_APP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief bench_lcd 固件入口：跑完 LCD 吞吐率测试，把报告同时输出到 USART1 与屏幕。
+ *
+ * CMake 目标 bench_lcd.elf 定义 BENCH_LCD_APP=1，main() 在外设初始化后调用本函数；
+ * 普通 firmware.elf 不调用。需先完成时钟、delay 与 lcd_panel_init()。
+ *
+ * 详见: src/bench/bench.md
+ */
+
+#ifndef BENCH_LCD_APP
+#define BENCH_LCD_APP (0)
+#endif
+
+/** 测试一遍并输出报告后返回（约数秒，期间屏幕内容被覆盖）。 */
+void bench_lcd_app_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_BENCH_LCD_APP_H */
@@ -0,0 +1,93 @@
+#include "bench/bench_timer.h"
+
+#include <stdbool.h>
+
+#include "bench/bench.h"
+#include "timer/basic_timer.h"
+
+#include "stm32f4xx.h"
+
+const uint32_t bench_timer_cases_ns[BENCH_TIMER_CASES] = {
+    100U, 250U, 500U, 1000U, 2000U, 5000U, 10000U, 100000U, 200000U, 1000000U,
+};
+
+/* 连续两次 bench_cycles() 之间的周期数（取最小值），从每次测量中扣除 */
+static uint32_t bench_timer_empty_cycles(void)
+{
+    uint32_t best = 0xFFFFFFFFU;
+
+    for (uint32_t i = 0U; i < BENCH_TIMER_REPEAT; i++)
+    {
+        const uint32_t t0 = bench_cycles();
+        const uint32_t d = bench_cycles() - t0;
+        if (d < best)
+        {
+            best = d;
+        }
+    }
+    return best;
+}
+
+static void bench_timer_measure(uint32_t *min_out, uint32_t *max_out, uint32_t req_ns, bool ref, uint32_t empty)
+{
+    const bool whole_us = ((req_ns % 1000U) == 0U) && (req_ns != 0U);
+    uint32_t lo = 0xFFFFFFFFU;
+    uint32_t hi = 0U;
+
+    for (uint32_t i = 0U; i < BENCH_TIMER_REPEAT; i++)
+    {
+        const uint32_t t0 = bench_cycles();
+        if (ref)
+        {
+            basic_timer_delay_us_ref(req_ns / 1000U);
+        }
+        else if (whole_us)
+        {
+            basic_timer_delay_us(req_ns / 1000U);
+        }
+        else
+        {
+            basic_timer_delay_ns(req_ns);
+        }
+        uint32_t d = bench_cycles() - t0;
+
+        d = (d > empty) ? (d - empty) : 0U;
+        if (d < lo)
+        {
+            lo = d;
+        }
+        if (d > hi)
+        {
+            hi = d;
+        }
+    }
+
+    *min_out = lo;
+    *max_out = hi;
+}
+
+void bench_timer_delays(bench_timer_row_t *rows, const uint32_t *req_ns, uint32_t count)
+{
+    if ((rows == 0) || (req_ns == 0))
+    {
+        return;
+    }
+
+    const uint32_t empty = bench_timer_empty_cycles();
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        bench_timer_row_t *r = &rows[i];
+
+        r->req_ns = req_ns[i];
+        r->expect_cycles = (uint32_t)(((uint64_t)req_ns[i] * SystemCoreClock) / 1000000000ULL);
+        bench_timer_measure(&r->min_cycles, &r->max_cycles, req_ns[i], false, empty);
+
+        r->ref_min_cycles = 0U;
+        r->ref_max_cycles = 0U;
+        if (((req_ns[i] % 1000U) == 0U) && (req_ns[i] != 0U))
+        {
+            bench_timer_measure(&r->ref_min_cycles, &r->ref_max_cycles, req_ns[i], true, empty);
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef BENCH_BENCH_TIMER_H
+#define BENCH_BENCH_TIMER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief 阻塞延时精度表（src/timer/basic_timer.h）：按请求时长逐行测实际耗时，
+ *        对比自由运行实现与旧的单次计数参考实现。
+ *
+ * 需先调用 bench_init() 与 basic_timer_init()；不访问 LCD。
+ * 详见: src/bench/bench.md
+ */
+
+/** 每个请求时长重复测量的次数，取最小 / 最大值。 */
+#define BENCH_TIMER_REPEAT (8U)
+
+/** 默认请求时长（ns）：亚微秒、DWT 区间、TIM6 区间各几档。 */
+#define BENCH_TIMER_CASES (10U)
+extern const uint32_t bench_timer_cases_ns[BENCH_TIMER_CASES];
+
+typedef struct
+{
+    uint32_t req_ns;
+    uint32_t expect_cycles;  /* req_ns 换算的 HCLK 周期 */
+    uint32_t min_cycles;     /* basic_timer_delay_us()；不足 1us 或非整 us 时为 basic_timer_delay_ns() */
+    uint32_t max_cycles;
+    uint32_t ref_min_cycles; /* basic_timer_delay_us_ref()；非整 us 的行为 0 */
+    uint32_t ref_max_cycles;
+} bench_timer_row_t;
+
+/**
+ * @brief 逐个测量 req_ns[0..count) 的延时，结果写入 rows[0..count)。
+ *
+ * 周期数已扣除一对 bench_cycles() 自身的开销。
+ */
+void bench_timer_delays(bench_timer_row_t *rows, const uint32_t *req_ns, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_BENCH_TIMER_H */
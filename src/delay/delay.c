@@ -2,6 +2,8 @@
 
 #include "stm32f4xx.h"
 
+#include "timebase/timebase.h"
+
 static volatile uint32_t system_tick_ms = 0U;
 
 void delay_init(void)
@@ -28,5 +30,11 @@ void delay_ms(uint32_t ms)
 void SysTick_Handler(void)
 {
     system_tick_ms++;
+
+    /* CYCCNT 约 25.5s 回绕一次：每 1024ms 读一次 64-bit 时间，主循环长时间不读也不会漏掉回绕 */
+    if ((system_tick_ms & 0x3FFU) == 0U)
+    {
+        (void)time_now_cycles();
+    }
 }
 
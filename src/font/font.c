@@ -0,0 +1,398 @@
+#include "font/font.h"
+
+#include <stdbool.h>
+
+#include "gfx/blend.h"
+
+/* 一行最多处理的字形数：按屏幕长边、最窄 6 像素字宽估计 */
+#define FONT_LINE_MAX_GLYPHS (LCD_PANEL_LONG_SIDE / 6U)
+
+/* 每槽像素数取偶数：槽首地址 4 字节对齐，偶数字宽的字形每行可按字拷贝 */
+#define FONT_SLOT_PIXELS ((FONT_CACHE_MAX_PIXELS + 1U) & ~1U)
+
+typedef uint32_t __attribute__((may_alias)) font_u32_t;
+
+typedef struct
+{
+    const font_t *font;       /* 0 表示空槽 */
+    lcd_color565_t fg;
+    lcd_color565_t bg;
+    uint8_t ch;
+    uint32_t stamp;           /* 最近一次使用时的行序号，0 = 从未使用 */
+} font_slot_t;
+
+/*
+ * 槽描述在 .bss（启动清零即全部为空槽）；像素块与行缓冲只由 CPU 读写，放在 CCMRAM
+ * （.ccmbss 不清零，只会读取有效槽 / 本次已写入的部分）。
+ */
+static font_slot_t font_slots[FONT_CACHE_SLOTS];
+static lcd_color565_t font_slot_px[FONT_CACHE_SLOTS][FONT_SLOT_PIXELS] __attribute__((section(".ccmbss"), aligned(4)));
+static lcd_color565_t font_line[LCD_PANEL_LONG_SIDE] __attribute__((section(".ccmbss"), aligned(4)));
+
+static uint32_t font_stamp;
+static font_cache_stats_t font_stats;
+
+/* ----------------------------- 位图 ----------------------------- */
+
+static uint8_t font_map_char(const font_t *font, uint8_t ch)
+{
+    if ((ch >= font->first) && (ch <= font->last))
+    {
+        return ch;
+    }
+    if (((uint8_t)'?' >= font->first) && ((uint8_t)'?' <= font->last))
+    {
+        return (uint8_t)'?';
+    }
+    return font->first;
+}
+
+static const uint8_t *font_glyph_bits(const font_t *font, uint8_t ch)
+{
+    return &font->bitmap[(uint32_t)(ch - font->first) * font->glyph_bytes];
+}
+
+/*
+ * 前景/背景色对应的 16 级颜色表：lut[k] = blend(fg, bg, k * 17)，lut[0] = bg、lut[15] = fg。
+ * 4bpp 字形每像素查一次表，不在内循环里做混合；1bpp 只用两端。
+ * 只缓存最近一组颜色，换色时重算（16 次 gfx_blend565()）。
+ */
+static lcd_color565_t font_lut[16];
+static lcd_color565_t font_lut_fg;
+static lcd_color565_t font_lut_bg;
+static bool font_lut_valid;
+
+static const lcd_color565_t *font_get_lut(lcd_color565_t fg, lcd_color565_t bg)
+{
+    if (!font_lut_valid || (fg != font_lut_fg) || (bg != font_lut_bg))
+    {
+        for (uint32_t k = 0U; k < 16U; k++)
+        {
+            font_lut[k] = gfx_blend565(fg, bg, (uint8_t)(k * 17U));
+        }
+        font_lut_fg = fg;
+        font_lut_bg = bg;
+        font_lut_valid = true;
+    }
+    return font_lut;
+}
+
+/* 1bpp：从第 pos 个像素开始展开 n 个（MSB 在前，跨字节连续） */
+static void font_expand_1bpp(lcd_color565_t *dst, const uint8_t *bits, uint32_t pos, uint32_t n,
+                             lcd_color565_t fg, lcd_color565_t bg)
+{
+    const uint8_t *p = &bits[pos >> 3];
+    uint32_t mask = 0x80U >> (pos & 7U);
+    uint32_t b = *p;
+
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        /* 用到下一字节时才读取，不越过字形末尾 */
+        if (mask == 0U)
+        {
+            mask = 0x80U;
+            p++;
+            b = *p;
+        }
+        dst[i] = ((b & mask) != 0U) ? fg : bg;
+        mask >>= 1;
+    }
+}
+
+/* 4bpp：每字节两个像素（高半字节在前），每像素一次查表 */
+static void font_expand_4bpp(lcd_color565_t *dst, const uint8_t *bits, uint32_t pos, uint32_t n,
+                             const lcd_color565_t *lut)
+{
+    const uint8_t *p = &bits[pos >> 1];
+    uint32_t i = 0U;
+
+    if (((pos & 1U) != 0U) && (n > 0U))
+    {
+        dst[0] = lut[*p & 0x0FU];
+        p++;
+        i = 1U;
+    }
+    for (; (i + 1U) < n; i += 2U)
+    {
+        const uint32_t b = *p;
+        p++;
+        dst[i] = lut[b >> 4];
+        dst[i + 1U] = lut[b & 0x0FU];
+    }
+    if (i < n)
+    {
+        dst[i] = lut[*p >> 4];
+    }
+}
+
+static void font_expand(lcd_color565_t *dst, const font_t *font, const uint8_t *bits, uint32_t pos, uint32_t n,
+                        const lcd_color565_t *lut)
+{
+    if (font->bpp == 4U)
+    {
+        font_expand_4bpp(dst, bits, pos, n, lut);
+    }
+    else
+    {
+        font_expand_1bpp(dst, bits, pos, n, lut[15], lut[0]);
+    }
+}
+
+void font_render_glyph(lcd_color565_t *dst, const font_t *font, char ch, lcd_color565_t fg, lcd_color565_t bg)
+{
+    if ((dst == 0) || (font == 0))
+    {
+        return;
+    }
+    font_expand(dst, font, font_glyph_bits(font, font_map_char(font, (uint8_t)ch)), 0U,
+                (uint32_t)font->width * font->height, font_get_lut(fg, bg));
+}
+
+/* ----------------------------- 字形缓存 ----------------------------- */
+
+void font_cache_clear(void)
+{
+    for (uint32_t i = 0U; i < FONT_CACHE_SLOTS; i++)
+    {
+        font_slots[i].font = 0;
+        font_slots[i].stamp = 0U;
+    }
+}
+
+void font_cache_get_stats(font_cache_stats_t *out)
+{
+    if (out != 0)
+    {
+        *out = font_stats;
+    }
+}
+
+void font_cache_reset_stats(void)
+{
+    font_stats.hits = 0U;
+    font_stats.misses = 0U;
+    font_stats.evictions = 0U;
+    font_stats.bypass = 0U;
+}
+
+/*
+ * 查找/装入一个字形，返回其 RGB565 像素块；返回 0 表示不缓存（调用方逐行从位图展开）。
+ * 本行已用到的槽（stamp == font_stamp）不会被替换，保证一行内取到的指针始终有效。
+ */
+static const lcd_color565_t *font_cache_get(const font_t *font, uint8_t ch, lcd_color565_t fg, lcd_color565_t bg,
+                                            const lcd_color565_t *lut)
+{
+    font_slot_t *victim = 0;
+    uint32_t vi = 0U;
+
+    if (((uint32_t)font->width * font->height) > FONT_CACHE_MAX_PIXELS)
+    {
+        font_stats.bypass++;
+        return 0;
+    }
+
+    for (uint32_t i = 0U; i < FONT_CACHE_SLOTS; i++)
+    {
+        font_slot_t *s = &font_slots[i];
+
+        if ((s->font == font) && (s->ch == ch) && (s->fg == fg) && (s->bg == bg))
+        {
+            s->stamp = font_stamp;
+            font_stats.hits++;
+            return font_slot_px[i];
+        }
+        /* 空槽 stamp 为 0，自然优先于任何已用槽 */
+        if ((s->stamp != font_stamp) && ((victim == 0) || (s->stamp < victim->stamp)))
+        {
+            victim = s;
+            vi = i;
+        }
+    }
+
+    if (victim == 0)
+    {
+        /* 一行内不同字形数超过槽数 */
+        font_stats.bypass++;
+        return 0;
+    }
+
+    if (victim->font != 0)
+    {
+        font_stats.evictions++;
+    }
+    font_stats.misses++;
+
+    victim->font = font;
+    victim->ch = ch;
+    victim->fg = fg;
+    victim->bg = bg;
+    victim->stamp = font_stamp;
+    font_expand(font_slot_px[vi], font, font_glyph_bits(font, ch), 0U, (uint32_t)font->width * font->height, lut);
+
+    return font_slot_px[vi];
+}
+
+/* ----------------------------- 渲染 ----------------------------- */
+
+static inline void font_copy_run(lcd_color565_t *dst, const lcd_color565_t *src, uint32_t n, bool words)
+{
+    if (words)
+    {
+        /* 偶数字宽：dst/src 都落在偶数像素上，4 字节对齐 */
+        font_u32_t *d32 = (font_u32_t *)(void *)dst;
+        const font_u32_t *s32 = (const font_u32_t *)(const void *)src;
+
+        for (uint32_t i = 0U; i < (n >> 1); i++)
+        {
+            d32[i] = s32[i];
+        }
+        if ((n & 1U) != 0U)
+        {
+            dst[n - 1U] = src[n - 1U];
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            dst[i] = src[i];
+        }
+    }
+}
+
+/* 单行文本（不含 '\n'），n 个字符 */
+static void font_draw_line(uint16_t x, uint16_t y, const char *str, uint32_t n, const font_t *font,
+                           lcd_color565_t fg, lcd_color565_t bg)
+{
+    const lcd_color565_t *px[FONT_LINE_MAX_GLYPHS];
+    const uint8_t *bits[FONT_LINE_MAX_GLYPHS];
+    const uint32_t fw = font->width;
+    const bool words = ((fw & 1U) == 0U);
+    const lcd_color565_t *lut = font_get_lut(fg, bg);
+    uint16_t w;
+    uint16_t h = font->height;
+    uint32_t glyphs;
+
+    if (n > FONT_LINE_MAX_GLYPHS)
+    {
+        n = FONT_LINE_MAX_GLYPHS;
+    }
+    if ((n * fw) > 0xFFFFU)
+    {
+        n = 0xFFFFU / fw;
+    }
+    w = (uint16_t)(n * fw);
+
+    if (!lcd_clip_rect(&x, &y, &w, &h))
+    {
+        return;
+    }
+
+    /* 先解析本行可见字形，再一次窗口逐像素行推送 */
+    font_stamp++;
+    if (font_stamp == 0U)
+    {
+        font_cache_clear();
+        font_stamp = 1U;
+    }
+
+    glyphs = (w + fw - 1U) / fw;
+    for (uint32_t g = 0U; g < glyphs; g++)
+    {
+        const uint8_t ch = font_map_char(font, (uint8_t)str[g]);
+        px[g] = font_cache_get(font, ch, fg, bg, lut);
+        bits[g] = font_glyph_bits(font, ch);
+    }
+
+    lcd_set_window(x, y, w, h);
+
+    for (uint32_t row = 0U; row < h; row++)
+    {
+        lcd_color565_t *dst = font_line;
+        uint32_t left = w;
+
+        for (uint32_t g = 0U; g < glyphs; g++)
+        {
+            const uint32_t k = (left < fw) ? left : fw;
+
+            if (px[g] != 0)
+            {
+                font_copy_run(dst, &px[g][row * fw], k, words);
+            }
+            else
+            {
+                font_expand(dst, font, bits[g], row * fw, k, lut);
+            }
+            dst += k;
+            left -= k;
+        }
+
+        lcd_write_pixels(font_line, w);
+    }
+}
+
+void font_draw_string(uint16_t x, uint16_t y, const char *str, const font_t *font,
+                      lcd_color565_t fg, lcd_color565_t bg)
+{
+    uint32_t ly = y;
+
+    if ((str == 0) || (font == 0))
+    {
+        return;
+    }
+
+    while ((*str != '\0') && (ly < lcd_height()))
+    {
+        uint32_t n = 0U;
+
+        while ((str[n] != '\0') && (str[n] != '\n'))
+        {
+            n++;
+        }
+        if (n > 0U)
+        {
+            font_draw_line(x, (uint16_t)ly, str, n, font, fg, bg);
+        }
+
+        str += n;
+        if (*str == '\n')
+        {
+            str++;
+            ly += font->height;
+        }
+    }
+}
+
+uint16_t font_text_width(const char *str, const font_t *font)
+{
+    uint32_t best = 0U;
+    uint32_t n = 0U;
+
+    if ((str == 0) || (font == 0))
+    {
+        return 0U;
+    }
+
+    for (;; str++)
+    {
+        if ((*str == '\0') || (*str == '\n'))
+        {
+            if (n > best)
+            {
+                best = n;
+            }
+            n = 0U;
+            if (*str == '\0')
+            {
+                break;
+            }
+        }
+        else
+        {
+            n++;
+        }
+    }
+
+    best *= font->width;
+    return (best > 0xFFFFU) ? 0xFFFFU : (uint16_t)best;
+}
@@ -0,0 +1,88 @@
+#ifndef FONT_FONT_H
+#define FONT_FONT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "lcd/lcd.h"
+
+/**
+ * @brief 等宽位图字体 + 字形缓存 + 按行推送的文本渲染。
+ *
+ * - 字体以紧凑位图存放在 FLASH（const，tools/fontgen.py 生成）：每字形行优先、MSB 在前连续打包
+ * - 4bpp 抗锯齿字体：每组前景/背景色预先算好 16 级 RGB565 颜色表，展开时每像素一次查表
+ * - 字形缓存：最近使用的 (字体, 字符, 前景色, 背景色) 预展开为 RGB565 像素块放在 CCMRAM，
+ *   命中时每行只是一次字拷贝；LRU 替换
+ * - 渲染：一行文本只设置一次窗口，逐像素行把各字形的对应行拼进行缓冲区后连续写入，
+ *   而不是每个字形各设一次窗口
+ *
+ * 详见: src/font/font.md
+ */
+
+typedef struct
+{
+    uint8_t width;            /* 单元格宽（像素） */
+    uint8_t height;           /* 单元格高（像素） */
+    uint8_t bpp;              /* 1 或 4（16 级灰度，抗锯齿） */
+    uint8_t first;            /* 首字符编码 */
+    uint8_t last;             /* 末字符编码（含） */
+    uint16_t glyph_bytes;     /* 每字形字节数 */
+    const uint8_t *bitmap;    /* (last - first + 1) * glyph_bytes 字节 */
+} font_t;
+
+/** 8x16 / 12x24，DejaVu Sans Mono，ASCII 0x20..0x7E；*_aa 为 4bpp 抗锯齿版本。 */
+extern const font_t font_mono16;
+extern const font_t font_mono24;
+extern const font_t font_mono16_aa;
+extern const font_t font_mono24_aa;
+
+/** 缓存槽数；每槽按 FONT_CACHE_MAX_PIXELS 个像素分配（CCMRAM）。 */
+#ifndef FONT_CACHE_SLOTS
+#define FONT_CACHE_SLOTS (24U)
+#endif
+
+/** 可缓存的最大字形像素数（width * height），更大的字体直接从位图展开。 */
+#ifndef FONT_CACHE_MAX_PIXELS
+#define FONT_CACHE_MAX_PIXELS (12U * 24U)
+#endif
+
+typedef struct
+{
+    uint32_t hits;            /* 缓存命中（按字形计） */
+    uint32_t misses;          /* 未命中，展开后放入缓存 */
+    uint32_t evictions;       /* 未命中且替换了已有字形 */
+    uint32_t bypass;          /* 未缓存，逐行直接从位图展开 */
+} font_cache_stats_t;
+
+/**
+ * @brief 在 (x,y) 处以 fg/bg 绘制字符串（不透明背景），默认裁剪。
+ *
+ * '\n' 换到下一行（y += height，x 回到起点）；编码不在字体范围内的字符显示为 '?'。
+ */
+void font_draw_string(uint16_t x, uint16_t y, const char *str, const font_t *font,
+                      lcd_color565_t fg, lcd_color565_t bg);
+
+/**
+ * @brief 把单个字形展开为 width*height 个 RGB565 像素（行优先）写入 dst，不经过缓存。
+ *
+ * 适合自行拼图或走 lcd_blit() 的场合；ch 不在范围内时同样按 '?' 处理。
+ */
+void font_render_glyph(lcd_color565_t *dst, const font_t *font, char ch, lcd_color565_t fg, lcd_color565_t bg);
+
+/** 字符串宽度（像素）：多行时取最长一行。 */
+uint16_t font_text_width(const char *str, const font_t *font);
+
+/** 清空字形缓存（保留统计）。 */
+void font_cache_clear(void);
+
+void font_cache_get_stats(font_cache_stats_t *out);
+void font_cache_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FONT_FONT_H */
@@ -0,0 +1,212 @@
+/*
+ * 由 tools/fontgen.py 生成，请勿手工修改。
+ *   python3 tools/fontgen.py DejaVuSansMono.ttf 16 1 font_mono16
+ *
+ * 字形来自 DejaVu Sans Mono（Bitstream Vera / DejaVu 许可，允许嵌入与再分发）。
+ * 单元格 8x16，1bpp，字符 0x20..0x7E，每字形 16 字节。
+ */
+
+#include "font/font.h"
+
+static const uint8_t font_mono16_bitmap[1520] = {
+    /* ' ' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '!' */
+    0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x08, 0x00, 0x00, 0x00,
+    /* '"' */
+    0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '#' */
+    0x00, 0x00, 0x00, 0x1A, 0x12, 0x36, 0x7F, 0x34, 0x24, 0xFF, 0x2C, 0x68, 0x48, 0x00, 0x00, 0x00,
+    /* '$' */
+    0x00, 0x00, 0x00, 0x08, 0x3E, 0x68, 0x68, 0x38, 0x1E, 0x0A, 0x0B, 0x6E, 0x3C, 0x08, 0x08, 0x00,
+    /* '%' */
+    0x00, 0x00, 0x00, 0x70, 0xD0, 0x98, 0x71, 0x0C, 0x36, 0x0F, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00,
+    /* '&' */
+    0x00, 0x00, 0x08, 0x3C, 0x20, 0x20, 0x30, 0x70, 0x49, 0xCD, 0xC7, 0x66, 0x3F, 0x00, 0x00, 0x00,
+    /* ''' */
+    0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '(' */
+    0x00, 0x00, 0x04, 0x08, 0x08, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x08, 0x08, 0x04, 0x00,
+    /* ')' */
+    0x00, 0x00, 0x00, 0x10, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x10, 0x00, 0x00,
+    /* '0x2A' */
+    0x00, 0x00, 0x00, 0x08, 0x6E, 0x18, 0x3C, 0x0A, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '+' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x18, 0x7F, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+    /* ',' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x10, 0x10, 0x00,
+    /* '-' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '.' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
+    /* '0x2F' */
+    0x00, 0x00, 0x00, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x10, 0x30, 0x20, 0x60, 0x40, 0x00, 0x00,
+    /* '0' */
+    0x00, 0x00, 0x08, 0x3C, 0x66, 0x62, 0x42, 0x5A, 0x4A, 0x42, 0x62, 0x26, 0x3C, 0x00, 0x00, 0x00,
+    /* '1' */
+    0x00, 0x00, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x3E, 0x00, 0x00, 0x00,
+    /* '2' */
+    0x00, 0x00, 0x10, 0x7C, 0x06, 0x02, 0x06, 0x04, 0x0C, 0x18, 0x30, 0x60, 0x7E, 0x00, 0x00, 0x00,
+    /* '3' */
+    0x00, 0x00, 0x10, 0x7C, 0x06, 0x02, 0x06, 0x1C, 0x06, 0x02, 0x02, 0x46, 0x7C, 0x00, 0x00, 0x00,
+    /* '4' */
+    0x00, 0x00, 0x00, 0x0C, 0x1C, 0x14, 0x34, 0x24, 0x44, 0x7F, 0x0E, 0x04, 0x04, 0x00, 0x00, 0x00,
+    /* '5' */
+    0x00, 0x00, 0x00, 0x7E, 0x60, 0x60, 0x7C, 0x0E, 0x06, 0x02, 0x02, 0x46, 0x7C, 0x00, 0x00, 0x00,
+    /* '6' */
+    0x00, 0x00, 0x08, 0x3E, 0x60, 0x60, 0x5C, 0x66, 0x62, 0x42, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00,
+    /* '7' */
+    0x00, 0x00, 0x00, 0x7E, 0x06, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x18, 0x10, 0x30, 0x00, 0x00, 0x00,
+    /* '8' */
+    0x00, 0x00, 0x08, 0x3E, 0x62, 0x62, 0x66, 0x3C, 0x66, 0x42, 0x42, 0x66, 0x3C, 0x00, 0x00, 0x00,
+    /* '9' */
+    0x00, 0x00, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x66, 0x3E, 0x02, 0x02, 0x0E, 0x3C, 0x00, 0x00, 0x00,
+    /* ':' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
+    /* ';' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x10, 0x10, 0x00,
+    /* '<' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0E, 0x78, 0x60, 0x38, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00,
+    /* '=' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '>' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x70, 0x1E, 0x07, 0x1E, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00,
+    /* '?' */
+    0x00, 0x00, 0x08, 0x3E, 0x06, 0x06, 0x04, 0x08, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
+    /* '@' */
+    0x00, 0x00, 0x00, 0x1C, 0x36, 0x41, 0x4F, 0x9B, 0x91, 0x91, 0x93, 0xCF, 0x40, 0x30, 0x1E, 0x00,
+    /* 'A' */
+    0x00, 0x00, 0x00, 0x18, 0x1C, 0x3C, 0x34, 0x26, 0x66, 0x7E, 0x42, 0x43, 0xC1, 0x00, 0x00, 0x00,
+    /* 'B' */
+    0x00, 0x00, 0x00, 0x7E, 0x62, 0x62, 0x66, 0x7C, 0x62, 0x63, 0x63, 0x66, 0x7C, 0x00, 0x00, 0x00,
+    /* 'C' */
+    0x00, 0x00, 0x04, 0x3E, 0x20, 0x60, 0x60, 0x40, 0x40, 0x60, 0x60, 0x32, 0x1E, 0x00, 0x00, 0x00,
+    /* 'D' */
+    0x00, 0x00, 0x00, 0x7C, 0x46, 0x42, 0x42, 0x42, 0x42, 0x42, 0x46, 0x6C, 0x78, 0x00, 0x00, 0x00,
+    /* 'E' */
+    0x00, 0x00, 0x00, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x60, 0x7E, 0x00, 0x00, 0x00,
+    /* 'F' */
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x20, 0x20, 0x3E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+    /* 'G' */
+    0x00, 0x00, 0x08, 0x3E, 0x60, 0x40, 0x40, 0x40, 0x46, 0x42, 0x62, 0x32, 0x1E, 0x00, 0x00, 0x00,
+    /* 'H' */
+    0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00,
+    /* 'I' */
+    0x00, 0x00, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x00, 0x00,
+    /* 'J' */
+    0x00, 0x00, 0x00, 0x3C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x4C, 0x78, 0x00, 0x00, 0x00,
+    /* 'K' */
+    0x00, 0x00, 0x00, 0x42, 0x46, 0x4C, 0x78, 0x78, 0x68, 0x4C, 0x46, 0x42, 0x43, 0x00, 0x00, 0x00,
+    /* 'L' */
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x3F, 0x00, 0x00, 0x00,
+    /* 'M' */
+    0x00, 0x00, 0x00, 0x63, 0x67, 0x67, 0x5F, 0x5B, 0x5B, 0x43, 0x43, 0x43, 0x43, 0x00, 0x00, 0x00,
+    /* 'N' */
+    0x00, 0x00, 0x00, 0x62, 0x62, 0x72, 0x52, 0x5A, 0x4A, 0x4E, 0x46, 0x46, 0x42, 0x00, 0x00, 0x00,
+    /* 'O' */
+    0x00, 0x00, 0x08, 0x3C, 0x66, 0x42, 0x43, 0x43, 0x43, 0x42, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00,
+    /* 'P' */
+    0x00, 0x00, 0x00, 0x7E, 0x63, 0x63, 0x63, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00,
+    /* 'Q' */
+    0x00, 0x00, 0x08, 0x3C, 0x66, 0x42, 0x43, 0x43, 0x43, 0x42, 0x62, 0x66, 0x3C, 0x06, 0x00, 0x00,
+    /* 'R' */
+    0x00, 0x00, 0x00, 0x7C, 0x46, 0x42, 0x46, 0x7C, 0x7C, 0x46, 0x42, 0x43, 0x41, 0x00, 0x00, 0x00,
+    /* 'S' */
+    0x00, 0x00, 0x08, 0x3E, 0x60, 0x40, 0x60, 0x3C, 0x0E, 0x02, 0x02, 0x46, 0x7C, 0x00, 0x00, 0x00,
+    /* 'T' */
+    0x00, 0x00, 0x00, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x00, 0x00, 0x00,
+    /* 'U' */
+    0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x00, 0x00, 0x00,
+    /* 'V' */
+    0x00, 0x00, 0x00, 0x43, 0x42, 0x62, 0x66, 0x26, 0x24, 0x34, 0x1C, 0x18, 0x18, 0x00, 0x00, 0x00,
+    /* 'W' */
+    0x00, 0x00, 0x00, 0xC1, 0xC1, 0xC9, 0xDB, 0x5B, 0x5F, 0x76, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00,
+    /* 'X' */
+    0x00, 0x00, 0x00, 0x63, 0x26, 0x34, 0x1C, 0x18, 0x1C, 0x34, 0x66, 0x42, 0xC3, 0x00, 0x00, 0x00,
+    /* 'Y' */
+    0x00, 0x00, 0x00, 0x43, 0x62, 0x26, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x00, 0x00, 0x00,
+    /* 'Z' */
+    0x00, 0x00, 0x00, 0x7F, 0x02, 0x06, 0x0C, 0x08, 0x18, 0x30, 0x20, 0x60, 0x7F, 0x00, 0x00, 0x00,
+    /* '[' */
+    0x00, 0x00, 0x1C, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x1C, 0x00,
+    /* '0x5C' */
+    0x00, 0x00, 0x00, 0x40, 0x60, 0x20, 0x30, 0x10, 0x18, 0x08, 0x0C, 0x04, 0x06, 0x02, 0x00, 0x00,
+    /* ']' */
+    0x00, 0x00, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x18, 0x00,
+    /* '^' */
+    0x00, 0x00, 0x00, 0x18, 0x34, 0x62, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '_' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    /* '`' */
+    0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'a' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x06, 0x02, 0x3E, 0x62, 0x42, 0x66, 0x3A, 0x00, 0x00, 0x00,
+    /* 'b' */
+    0x00, 0x00, 0x40, 0x60, 0x60, 0x7C, 0x66, 0x62, 0x63, 0x63, 0x62, 0x66, 0x7C, 0x00, 0x00, 0x00,
+    /* 'c' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x32, 0x60, 0x60, 0x60, 0x60, 0x32, 0x1E, 0x00, 0x00, 0x00,
+    /* 'd' */
+    0x00, 0x00, 0x02, 0x02, 0x02, 0x3E, 0x66, 0x46, 0x42, 0x42, 0x46, 0x66, 0x3E, 0x00, 0x00, 0x00,
+    /* 'e' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x66, 0x42, 0x7F, 0x40, 0x40, 0x62, 0x3E, 0x00, 0x00, 0x00,
+    /* 'f' */
+    0x00, 0x00, 0x0E, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x10, 0x00, 0x00, 0x00,
+    /* 'g' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x66, 0x46, 0x42, 0x42, 0x46, 0x66, 0x3A, 0x02, 0x26, 0x38,
+    /* 'h' */
+    0x00, 0x00, 0x40, 0x60, 0x60, 0x7C, 0x66, 0x62, 0x62, 0x62, 0x62, 0x62, 0x42, 0x00, 0x00, 0x00,
+    /* 'i' */
+    0x00, 0x00, 0x08, 0x08, 0x00, 0x38, 0x18, 0x08, 0x08, 0x08, 0x08, 0x18, 0x7E, 0x00, 0x00, 0x00,
+    /* 'j' */
+    0x00, 0x00, 0x08, 0x08, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x70,
+    /* 'k' */
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x22, 0x24, 0x28, 0x38, 0x2C, 0x26, 0x22, 0x23, 0x00, 0x00, 0x00,
+    /* 'l' */
+    0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0E, 0x00, 0x00, 0x00,
+    /* 'm' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x5B, 0x5B, 0x4B, 0x4B, 0x4B, 0x4B, 0x49, 0x00, 0x00, 0x00,
+    /* 'n' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x66, 0x62, 0x62, 0x62, 0x62, 0x62, 0x42, 0x00, 0x00, 0x00,
+    /* 'o' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x66, 0x62, 0x42, 0x42, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00,
+    /* 'p' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x66, 0x62, 0x62, 0x62, 0x62, 0x66, 0x7C, 0x60, 0x60, 0x40,
+    /* 'q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x66, 0x62, 0x42, 0x42, 0x62, 0x66, 0x3E, 0x02, 0x02, 0x02,
+    /* 'r' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x39, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00,
+    /* 's' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x20, 0x60, 0x38, 0x0E, 0x06, 0x46, 0x3C, 0x00, 0x00, 0x00,
+    /* 't' */
+    0x00, 0x00, 0x00, 0x10, 0x10, 0x7E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0E, 0x00, 0x00, 0x00,
+    /* 'u' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x62, 0x62, 0x62, 0x62, 0x62, 0x66, 0x3A, 0x00, 0x00, 0x00,
+    /* 'v' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x66, 0x26, 0x34, 0x3C, 0x18, 0x18, 0x00, 0x00, 0x00,
+    /* 'w' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xC1, 0xCB, 0x5B, 0x5A, 0x76, 0x66, 0x26, 0x00, 0x00, 0x00,
+    /* 'x' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x26, 0x3C, 0x18, 0x18, 0x34, 0x66, 0x42, 0x00, 0x00, 0x00,
+    /* 'y' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x62, 0x66, 0x26, 0x34, 0x1C, 0x18, 0x18, 0x18, 0x30, 0x60,
+    /* 'z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x06, 0x04, 0x08, 0x18, 0x30, 0x60, 0x7E, 0x00, 0x00, 0x00,
+    /* '{' */
+    0x00, 0x00, 0x06, 0x08, 0x18, 0x18, 0x18, 0x18, 0x70, 0x18, 0x18, 0x18, 0x18, 0x08, 0x0E, 0x00,
+    /* '|' */
+    0x00, 0x00, 0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    /* '}' */
+    0x00, 0x00, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0E, 0x08, 0x18, 0x18, 0x18, 0x18, 0x70, 0x00,
+    /* '~' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const font_t font_mono16 = {
+    .width = 8U,
+    .height = 16U,
+    .bpp = 1U,
+    .first = 0x20U,
+    .last = 0x7EU,
+    .glyph_bytes = 16U,
+    .bitmap = font_mono16_bitmap,
+};
@@ -0,0 +1,497 @@
+/*
+ * 由 tools/fontgen.py 生成，请勿手工修改。
+ *   python3 tools/fontgen.py DejaVuSansMono.ttf 16 4 font_mono16_aa
+ *
+ * 字形来自 DejaVu Sans Mono（Bitstream Vera / DejaVu 许可，允许嵌入与再分发）。
+ * 单元格 8x16，4bpp，字符 0x20..0x7E，每字形 64 字节。
+ */
+
+#include "font/font.h"
+
+static const uint8_t font_mono16_aa_bitmap[6080] = {
+    /* ' ' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '!' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x08, 0xD0, 0x00,
+    0x00, 0x08, 0xD0, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x08, 0xC0, 0x00,
+    0x00, 0x07, 0xB0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xD0, 0x00,
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '"' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x04, 0x00, 0x00, 0xB6, 0x2F, 0x00,
+    0x00, 0xB6, 0x2F, 0x00, 0x00, 0xB6, 0x2F, 0x00, 0x00, 0x63, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '#' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x10, 0x00, 0x09, 0x70, 0xE2,
+    0x00, 0x0D, 0x32, 0xE0, 0x16, 0x6F, 0x69, 0xC6, 0x3B, 0xDE, 0xBE, 0xCB, 0x00, 0x97, 0x0E, 0x20,
+    0x00, 0xD3, 0x2E, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x06, 0xA0, 0xA6, 0x00, 0x09, 0x70, 0xE2, 0x00,
+    0x09, 0x21, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '$' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x01, 0xA0, 0x00,
+    0x01, 0xBE, 0xEE, 0xB0, 0x09, 0xB0, 0x90, 0x40, 0x0B, 0x80, 0x90, 0x00, 0x05, 0xE8, 0xB1, 0x00,
+    0x00, 0x49, 0xEF, 0x90, 0x00, 0x00, 0x93, 0xE5, 0x00, 0x00, 0x90, 0xC7, 0x0A, 0x74, 0xB7, 0xE2,
+    0x03, 0x8B, 0xE9, 0x30, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '%' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xD8, 0x00, 0x00,
+    0x97, 0x2B, 0x50, 0x00, 0xB2, 0x07, 0x70, 0x00, 0x6C, 0x8D, 0x30, 0x68, 0x04, 0x65, 0x9B, 0x60,
+    0x06, 0xB9, 0x47, 0x60, 0x36, 0x00, 0xD7, 0x9A, 0x00, 0x04, 0xA0, 0x0E, 0x00, 0x01, 0xD4, 0x5D,
+    0x00, 0x00, 0x4B, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '&' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x63, 0x00, 0x01, 0xEB, 0x9B, 0x00,
+    0x06, 0xC0, 0x00, 0x00, 0x04, 0xE0, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x0B, 0xAE, 0x40, 0x06,
+    0x5C, 0x06, 0xE2, 0x0F, 0x99, 0x00, 0xAB, 0x2D, 0x8B, 0x00, 0x1D, 0xD8, 0x2E, 0x82, 0x3B, 0xF4,
+    0x03, 0xBE, 0xD8, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ''' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x08, 0xB0, 0x00,
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '(' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xC5, 0x00,
+    0x00, 0x04, 0xD0, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x00, 0x1F, 0x40, 0x00,
+    0x00, 0x2F, 0x20, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x00, 0x0A, 0x90, 0x00,
+    0x00, 0x04, 0xE0, 0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ')' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x1E, 0x20, 0x00,
+    0x00, 0x09, 0x80, 0x00, 0x00, 0x05, 0xE0, 0x00, 0x00, 0x01, 0xF3, 0x00, 0x00, 0x00, 0xE5, 0x00,
+    0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x01, 0xF3, 0x00, 0x00, 0x05, 0xD0, 0x00,
+    0x00, 0x0A, 0x80, 0x00, 0x00, 0x2E, 0x10, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '0x2A' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x01, 0x04, 0x80, 0x10,
+    0x08, 0xA5, 0x88, 0xB0, 0x00, 0x2D, 0xE5, 0x00, 0x03, 0xBA, 0xBB, 0x60, 0x06, 0x24, 0x80, 0x70,
+    0x00, 0x03, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '+' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x10, 0x00, 0x00, 0x06, 0xB0, 0x00, 0x00, 0x06, 0xB0, 0x00, 0x12, 0x27, 0xC2, 0x21,
+    0x6F, 0xFF, 0xFF, 0xF9, 0x00, 0x06, 0xB0, 0x00, 0x00, 0x06, 0xB0, 0x00, 0x00, 0x06, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ',' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '-' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x58, 0x87, 0x00, 0x00, 0x58, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '.' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00,
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '0x2F' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x06, 0xD0,
+    0x00, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x04, 0xE1, 0x00,
+    0x00, 0x0B, 0x80, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00,
+    0x09, 0xA0, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '0' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x62, 0x00, 0x02, 0xDC, 0xBF, 0x40,
+    0x09, 0xC0, 0x08, 0xD0, 0x0D, 0x70, 0x03, 0xF3, 0x1F, 0x51, 0x10, 0xF5, 0x2F, 0x4A, 0xE0, 0xF6,
+    0x2F, 0x45, 0x70, 0xF6, 0x0F, 0x50, 0x01, 0xF4, 0x0B, 0x90, 0x05, 0xF1, 0x05, 0xF4, 0x3D, 0x90,
+    0x00, 0x7D, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '1' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x41, 0x00, 0x04, 0xEF, 0xF4, 0x00,
+    0x02, 0x43, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00,
+    0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x01, 0x67, 0xF8, 0x62,
+    0x03, 0xBB, 0xBB, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '2' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x51, 0x00, 0x0C, 0xEB, 0xCF, 0x50,
+    0x04, 0x00, 0x0A, 0xD0, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x4F, 0x40,
+    0x00, 0x02, 0xE6, 0x00, 0x00, 0x1D, 0x80, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x0C, 0xD6, 0x66, 0x61,
+    0x0B, 0xBB, 0xBB, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '3' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0x52, 0x00, 0x0B, 0xDB, 0xCF, 0x50,
+    0x01, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x12, 0x4D, 0x90, 0x00, 0x6F, 0xFC, 0x10,
+    0x00, 0x00, 0x1A, 0xC0, 0x00, 0x00, 0x02, 0xF3, 0x00, 0x00, 0x03, 0xF3, 0x2A, 0x54, 0x5D, 0xC0,
+    0x19, 0xDF, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '4' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x00, 0x00, 0xBF, 0x40,
+    0x00, 0x06, 0xBF, 0x40, 0x00, 0x2D, 0x3F, 0x40, 0x00, 0xA6, 0x2F, 0x40, 0x05, 0xC0, 0x2F, 0x40,
+    0x1D, 0x40, 0x2F, 0x40, 0x5F, 0xBB, 0xCF, 0xC7, 0x26, 0x66, 0x7F, 0x84, 0x00, 0x00, 0x2F, 0x40,
+    0x00, 0x00, 0x1B, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '5' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x44, 0x20, 0x09, 0xED, 0xDD, 0x70,
+    0x09, 0x90, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x09, 0xDD, 0xC7, 0x00, 0x06, 0x64, 0x7E, 0x90,
+    0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x04, 0xF2, 0x00, 0x00, 0x05, 0xF1, 0x09, 0x44, 0x6E, 0xA0,
+    0x0B, 0xDF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '6' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x20, 0x00, 0xBE, 0xBC, 0x90,
+    0x07, 0xD1, 0x00, 0x00, 0x0D, 0x60, 0x00, 0x00, 0x0F, 0x5B, 0xDA, 0x20, 0x2F, 0xD5, 0x4A, 0xD0,
+    0x2F, 0x80, 0x01, 0xF4, 0x0F, 0x60, 0x00, 0xF6, 0x0C, 0x80, 0x01, 0xF4, 0x06, 0xE4, 0x29, 0xD0,
+    0x00, 0x7D, 0xEB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '7' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x44, 0x41, 0x2D, 0xDD, 0xDE, 0xF2,
+    0x00, 0x00, 0x08, 0xC0, 0x00, 0x00, 0x0D, 0x60, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x00, 0xBA, 0x00,
+    0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0D, 0x80, 0x00, 0x00, 0x4F, 0x20, 0x00,
+    0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '8' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x63, 0x00, 0x04, 0xFB, 0xAE, 0x80,
+    0x0C, 0x90, 0x05, 0xF1, 0x0D, 0x80, 0x04, 0xF2, 0x07, 0xD3, 0x2A, 0xB0, 0x00, 0xAF, 0xFD, 0x20,
+    0x0A, 0xB1, 0x08, 0xE1, 0x1F, 0x40, 0x00, 0xF5, 0x1F, 0x50, 0x01, 0xF5, 0x0C, 0xC3, 0x29, 0xE1,
+    0x01, 0x9E, 0xEB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '9' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x62, 0x00, 0x05, 0xFB, 0xBF, 0x40,
+    0x0E, 0x70, 0x08, 0xD0, 0x2F, 0x40, 0x03, 0xF2, 0x2F, 0x40, 0x03, 0xF4, 0x0D, 0x80, 0x08, 0xF6,
+    0x05, 0xFB, 0xBB, 0xE5, 0x00, 0x25, 0x41, 0xF3, 0x00, 0x00, 0x06, 0xE0, 0x03, 0x54, 0x6E, 0x70,
+    0x04, 0xCF, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ':' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00,
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ';' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '<' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x00, 0x04, 0xAF, 0xB4, 0x17, 0xDD, 0x82, 0x00,
+    0x6F, 0x90, 0x00, 0x00, 0x06, 0xBE, 0x94, 0x00, 0x00, 0x02, 0x8E, 0xD5, 0x00, 0x00, 0x00, 0x56,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '=' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x88, 0x88, 0x85, 0x49, 0x99, 0x99, 0x96,
+    0x00, 0x00, 0x00, 0x00, 0x4B, 0xBB, 0xBB, 0xB7, 0x26, 0x66, 0x66, 0x64, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '>' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x58, 0x20, 0x00, 0x00, 0x2A, 0xFB, 0x60, 0x00, 0x00, 0x16, 0xCE, 0x92,
+    0x00, 0x00, 0x06, 0xF9, 0x00, 0x28, 0xDD, 0x71, 0x3B, 0xFA, 0x40, 0x00, 0x47, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '?' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x63, 0x00, 0x04, 0xEB, 0xBF, 0x70,
+    0x03, 0x10, 0x08, 0xE0, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x04, 0xF5, 0x00,
+    0x00, 0x09, 0xA0, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x0B, 0x90, 0x00,
+    0x00, 0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '@' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x98, 0x30,
+    0x03, 0xD9, 0x67, 0xE4, 0x0D, 0x50, 0x00, 0x5B, 0x6A, 0x02, 0xAB, 0x7D, 0xA5, 0x0C, 0x84, 0xAD,
+    0xB4, 0x3D, 0x00, 0x2D, 0xC3, 0x3C, 0x00, 0x1D, 0xB5, 0x0E, 0x50, 0x8D, 0x7A, 0x04, 0xDF, 0x8B,
+    0x1E, 0x40, 0x00, 0x00, 0x04, 0xE7, 0x22, 0x30, 0x00, 0x29, 0xCD, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    /* 'A' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x0E, 0xF3, 0x00,
+    0x00, 0x4E, 0xB8, 0x00, 0x00, 0x8B, 0x6C, 0x00, 0x00, 0xD6, 0x2F, 0x20, 0x02, 0xF2, 0x0D, 0x60,
+    0x07, 0xD0, 0x09, 0xB0, 0x0B, 0xFF, 0xFF, 0xF1, 0x1F, 0x52, 0x22, 0xF5, 0x5F, 0x00, 0x00, 0xBA,
+    0x78, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'B' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x44, 0x41, 0x00, 0x0D, 0xED, 0xDF, 0x80,
+    0x0D, 0x80, 0x05, 0xF3, 0x0D, 0x80, 0x02, 0xF4, 0x0D, 0x82, 0x29, 0xE1, 0x0D, 0xFF, 0xFE, 0x50,
+    0x0D, 0x80, 0x04, 0xF4, 0x0D, 0x80, 0x00, 0xC9, 0x0D, 0x80, 0x00, 0xC9, 0x0D, 0xA6, 0x6A, 0xF4,
+    0x0A, 0xBB, 0xB9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'C' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x66, 0x30, 0x00, 0x8F, 0xBB, 0xF4,
+    0x05, 0xF3, 0x00, 0x12, 0x0B, 0xA0, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x00,
+    0x0F, 0x60, 0x00, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x02, 0xEA, 0x33, 0x84,
+    0x00, 0x2A, 0xEE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'D' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x10, 0x00, 0x2F, 0xED, 0xFA, 0x10,
+    0x2F, 0x40, 0x2C, 0xB0, 0x2F, 0x40, 0x04, 0xF2, 0x2F, 0x40, 0x01, 0xF5, 0x2F, 0x40, 0x00, 0xF6,
+    0x2F, 0x40, 0x00, 0xF6, 0x2F, 0x40, 0x03, 0xF4, 0x2F, 0x40, 0x08, 0xE0, 0x2F, 0x86, 0xAF, 0x50,
+    0x1B, 0xBB, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'E' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x44, 0x41, 0x09, 0xED, 0xDD, 0xD3,
+    0x09, 0x90, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x09, 0xA2, 0x22, 0x20, 0x09, 0xFF, 0xFF, 0xF2,
+    0x09, 0x90, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x09, 0xB6, 0x66, 0x62,
+    0x07, 0xBB, 0xBB, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'F' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 0x44, 0x42, 0x06, 0xFD, 0xDD, 0xD7,
+    0x06, 0xD0, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x06, 0xD2, 0x22, 0x20, 0x06, 0xFF, 0xFF, 0xF0,
+    0x06, 0xD0, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00,
+    0x04, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'G' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x10, 0x01, 0xBE, 0xAB, 0xE1,
+    0x09, 0xD1, 0x00, 0x41, 0x1F, 0x60, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x4F, 0x20, 0x26, 0x62,
+    0x4F, 0x20, 0x4B, 0xF6, 0x2F, 0x40, 0x00, 0xD6, 0x0D, 0x80, 0x00, 0xD6, 0x04, 0xF7, 0x24, 0xE6,
+    0x00, 0x4B, 0xED, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'H' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x41, 0x2F, 0x40, 0x00, 0xF6,
+    0x2F, 0x40, 0x00, 0xF6, 0x2F, 0x40, 0x00, 0xF6, 0x2F, 0x52, 0x22, 0xF6, 0x2F, 0xFF, 0xFF, 0xF6,
+    0x2F, 0x40, 0x00, 0xF6, 0x2F, 0x40, 0x00, 0xF6, 0x2F, 0x40, 0x00, 0xF6, 0x2F, 0x40, 0x00, 0xF6,
+    0x1B, 0x30, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'I' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x44, 0x30, 0x08, 0xDE, 0xFD, 0xB0,
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00,
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x04, 0x6A, 0xD6, 0x50,
+    0x07, 0xBB, 0xBB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'J' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x10, 0x00, 0x7D, 0xDF, 0x60,
+    0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F, 0x60,
+    0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F, 0x50, 0x4B, 0x42, 0x8F, 0x20,
+    0x2A, 0xDF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'K' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x24, 0x2F, 0x40, 0x04, 0xE6,
+    0x2F, 0x40, 0x4E, 0x70, 0x2F, 0x42, 0xE7, 0x00, 0x2F, 0x6E, 0x90, 0x00, 0x2F, 0xFE, 0xA0, 0x00,
+    0x2F, 0x93, 0xF5, 0x00, 0x2F, 0x40, 0x8E, 0x10, 0x2F, 0x40, 0x0D, 0xB0, 0x2F, 0x40, 0x04, 0xF6,
+    0x1B, 0x30, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'L' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00,
+    0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00,
+    0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xD6, 0x66, 0x64,
+    0x06, 0xBB, 0xBB, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'M' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x20, 0x01, 0x42, 0x6F, 0xA0, 0x06, 0xF9,
+    0x6E, 0xE0, 0x0B, 0xD9, 0x6D, 0xA5, 0x1D, 0x99, 0x6D, 0x5A, 0x78, 0x99, 0x6D, 0x0D, 0xC4, 0x99,
+    0x6D, 0x09, 0xD0, 0x99, 0x6D, 0x01, 0x20, 0x99, 0x6D, 0x00, 0x00, 0x99, 0x6D, 0x00, 0x00, 0x99,
+    0x4A, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'N' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x30, 0x00, 0x41, 0x2F, 0xE0, 0x00, 0xF6,
+    0x2F, 0xE6, 0x00, 0xF6, 0x2F, 0x9C, 0x00, 0xF6, 0x2F, 0x4E, 0x30, 0xF6, 0x2F, 0x48, 0x90, 0xF6,
+    0x2F, 0x42, 0xE1, 0xF6, 0x2F, 0x40, 0xB6, 0xF6, 0x2F, 0x40, 0x4C, 0xF6, 0x2F, 0x40, 0x0D, 0xF6,
+    0x1B, 0x30, 0x06, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'O' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x63, 0x00, 0x03, 0xEC, 0xBF, 0x60,
+    0x0B, 0xB0, 0x07, 0xE0, 0x0F, 0x60, 0x02, 0xF4, 0x2F, 0x40, 0x00, 0xF7, 0x4F, 0x40, 0x00, 0xD8,
+    0x3F, 0x40, 0x00, 0xE8, 0x1F, 0x40, 0x00, 0xF5, 0x0D, 0x80, 0x04, 0xF2, 0x07, 0xE4, 0x3C, 0xB0,
+    0x00, 0x8D, 0xEA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'P' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x42, 0x00, 0x09, 0xED, 0xDF, 0xB0,
+    0x09, 0x90, 0x04, 0xF7, 0x09, 0x90, 0x00, 0xC9, 0x09, 0x90, 0x00, 0xD9, 0x09, 0xB6, 0x6B, 0xF3,
+    0x09, 0xEB, 0xB9, 0x30, 0x09, 0x90, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00,
+    0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x63, 0x00, 0x03, 0xEC, 0xBF, 0x60,
+    0x0B, 0xB0, 0x07, 0xE0, 0x0F, 0x60, 0x02, 0xF4, 0x2F, 0x40, 0x00, 0xF7, 0x4F, 0x40, 0x00, 0xD8,
+    0x3F, 0x40, 0x00, 0xE8, 0x1F, 0x40, 0x00, 0xF5, 0x0D, 0x80, 0x04, 0xF3, 0x07, 0xE4, 0x3C, 0xB0,
+    0x00, 0x8D, 0xFE, 0x10, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00,
+    /* 'R' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x30, 0x00, 0x0F, 0xED, 0xEE, 0x50,
+    0x0F, 0x60, 0x09, 0xE0, 0x0F, 0x60, 0x04, 0xF2, 0x0F, 0x60, 0x07, 0xF1, 0x0F, 0xB9, 0xAE, 0x50,
+    0x0F, 0xA8, 0xBC, 0x10, 0x0F, 0x60, 0x0B, 0x90, 0x0F, 0x60, 0x04, 0xF2, 0x0F, 0x60, 0x00, 0xB9,
+    0x0B, 0x40, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'S' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x65, 0x10, 0x05, 0xFC, 0xAD, 0xB0,
+    0x0D, 0x80, 0x00, 0x20, 0x0F, 0x40, 0x00, 0x00, 0x0D, 0xC4, 0x00, 0x00, 0x03, 0xCF, 0xEA, 0x20,
+    0x00, 0x02, 0x6C, 0xE1, 0x00, 0x00, 0x01, 0xF5, 0x00, 0x00, 0x00, 0xE5, 0x0C, 0x63, 0x3A, 0xE1,
+    0x08, 0xCE, 0xEB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'T' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x44, 0x44, 0x8D, 0xDE, 0xFD, 0xDD,
+    0x00, 0x08, 0xD0, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x08, 0xD0, 0x00,
+    0x00, 0x08, 0xD0, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x08, 0xD0, 0x00,
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'U' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x41, 0x0F, 0x60, 0x02, 0xF4,
+    0x0F, 0x60, 0x02, 0xF4, 0x0F, 0x60, 0x02, 0xF4, 0x0F, 0x60, 0x02, 0xF4, 0x0F, 0x60, 0x02, 0xF4,
+    0x0F, 0x60, 0x02, 0xF4, 0x0F, 0x60, 0x02, 0xF4, 0x0E, 0x60, 0x02, 0xF3, 0x0A, 0xD4, 0x3A, 0xD0,
+    0x01, 0x9E, 0xEB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'V' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x23, 0x6E, 0x00, 0x00, 0xBA,
+    0x2F, 0x40, 0x00, 0xE6, 0x0C, 0x80, 0x04, 0xF1, 0x08, 0xC0, 0x08, 0xC0, 0x04, 0xF1, 0x0C, 0x80,
+    0x00, 0xE5, 0x1F, 0x30, 0x00, 0xA9, 0x5E, 0x00, 0x00, 0x5D, 0x89, 0x00, 0x00, 0x1F, 0xE5, 0x00,
+    0x00, 0x09, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'W' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x04, 0xD6, 0x00, 0x00, 0x2F,
+    0xB8, 0x00, 0x00, 0x4F, 0x9A, 0x05, 0x70, 0x6D, 0x7B, 0x0C, 0xF1, 0x8B, 0x4D, 0x0E, 0xB4, 0x98,
+    0x2F, 0x3B, 0x77, 0xB6, 0x0F, 0x88, 0x4A, 0xD4, 0x0D, 0xD4, 0x1E, 0xF2, 0x0A, 0xF1, 0x0C, 0xF0,
+    0x06, 0xA0, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'X' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x23, 0x1D, 0x70, 0x01, 0xE7,
+    0x05, 0xE2, 0x08, 0xC0, 0x00, 0xBA, 0x3F, 0x30, 0x00, 0x2F, 0xD8, 0x00, 0x00, 0x0A, 0xF1, 0x00,
+    0x00, 0x3F, 0xC8, 0x00, 0x00, 0xC9, 0x3F, 0x30, 0x07, 0xE1, 0x09, 0xC0, 0x2E, 0x50, 0x01, 0xE6,
+    0x79, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Y' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x24, 0x5F, 0x20, 0x00, 0xD9,
+    0x0B, 0xA0, 0x06, 0xE1, 0x02, 0xF3, 0x1E, 0x60, 0x00, 0x9B, 0x8C, 0x00, 0x00, 0x1E, 0xF4, 0x00,
+    0x00, 0x08, 0xC0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00,
+    0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x44, 0x44, 0x43, 0x0A, 0xDD, 0xDD, 0xFB,
+    0x00, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x1D, 0x80, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x03, 0xF3, 0x00,
+    0x00, 0x0D, 0x80, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x03, 0xF3, 0x00, 0x00, 0x0C, 0xC6, 0x66, 0x65,
+    0x0B, 0xBB, 0xBB, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '[' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x99, 0x00, 0x00, 0x0D, 0x84, 0x00,
+    0x00, 0x0D, 0x60, 0x00, 0x00, 0x0D, 0x60, 0x00, 0x00, 0x0D, 0x60, 0x00, 0x00, 0x0D, 0x60, 0x00,
+    0x00, 0x0D, 0x60, 0x00, 0x00, 0x0D, 0x60, 0x00, 0x00, 0x0D, 0x60, 0x00, 0x00, 0x0D, 0x60, 0x00,
+    0x00, 0x0D, 0x60, 0x00, 0x00, 0x0D, 0x96, 0x00, 0x00, 0x08, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '0x5C' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x00,
+    0x08, 0xC0, 0x00, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x1F, 0x30, 0x00,
+    0x00, 0x09, 0xA0, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0x10,
+    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x04, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ']' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x91, 0x00, 0x00, 0x25, 0xF2, 0x00,
+    0x00, 0x02, 0xF2, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x02, 0xF2, 0x00,
+    0x00, 0x02, 0xF2, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x02, 0xF2, 0x00,
+    0x00, 0x02, 0xF2, 0x00, 0x00, 0x47, 0xF2, 0x00, 0x00, 0x69, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '^' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x2E, 0xF5, 0x00,
+    0x01, 0xD8, 0x4E, 0x30, 0x0B, 0x80, 0x05, 0xD1, 0x27, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '_' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88,
+    /* '`' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x09, 0x80, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'a' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xBD, 0xDA, 0x20, 0x05, 0x52, 0x29, 0xC0, 0x00, 0x00, 0x02, 0xF1,
+    0x02, 0xBE, 0xFF, 0xF2, 0x0D, 0x91, 0x02, 0xF2, 0x2F, 0x20, 0x05, 0xF2, 0x0E, 0x82, 0x4D, 0xF2,
+    0x04, 0xCE, 0xB4, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'b' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
+    0x0B, 0x80, 0x00, 0x00, 0x0B, 0x9B, 0xDB, 0x20, 0x0B, 0xF6, 0x29, 0xD0, 0x0B, 0xB0, 0x01, 0xF4,
+    0x0B, 0x80, 0x00, 0xD7, 0x0B, 0x80, 0x00, 0xD7, 0x0B, 0xB0, 0x01, 0xF4, 0x0B, 0xF6, 0x29, 0xD0,
+    0x08, 0x7B, 0xEC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'c' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xDD, 0xA1, 0x01, 0xE9, 0x32, 0x82, 0x07, 0xD0, 0x00, 0x00,
+    0x0A, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xE9, 0x22, 0x72,
+    0x00, 0x2A, 0xEE, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'd' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x04, 0xF0,
+    0x00, 0x00, 0x04, 0xF0, 0x01, 0xAD, 0xC7, 0xF0, 0x09, 0xC3, 0x4D, 0xF0, 0x0F, 0x50, 0x07, 0xF0,
+    0x2F, 0x20, 0x04, 0xF0, 0x2F, 0x20, 0x04, 0xF0, 0x0F, 0x50, 0x07, 0xF0, 0x09, 0xC3, 0x3D, 0xF0,
+    0x01, 0xAE, 0xC6, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'e' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xDB, 0x20, 0x07, 0xE4, 0x28, 0xD0, 0x0E, 0x60, 0x00, 0xD5,
+    0x2F, 0xA9, 0x99, 0xE7, 0x2F, 0x54, 0x44, 0x42, 0x0E, 0x50, 0x00, 0x00, 0x07, 0xE4, 0x23, 0x81,
+    0x00, 0x6C, 0xFD, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'f' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x91, 0x00, 0x07, 0xD6, 0x61,
+    0x00, 0x09, 0x80, 0x00, 0x08, 0xBE, 0xDB, 0xB1, 0x03, 0x4B, 0x94, 0x40, 0x00, 0x09, 0x80, 0x00,
+    0x00, 0x09, 0x80, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00, 0x09, 0x80, 0x00,
+    0x00, 0x07, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'g' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xAD, 0xC6, 0xB0, 0x09, 0xD3, 0x3D, 0xF0, 0x0F, 0x50, 0x07, 0xF0,
+    0x2F, 0x20, 0x04, 0xF0, 0x2F, 0x20, 0x04, 0xF0, 0x0E, 0x50, 0x07, 0xF0, 0x08, 0xE5, 0x5D, 0xF0,
+    0x00, 0x8B, 0xA6, 0xF0, 0x00, 0x00, 0x06, 0xD0, 0x04, 0x84, 0x5E, 0x70, 0x02, 0x8B, 0xA5, 0x00,
+    /* 'h' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
+    0x0B, 0x80, 0x00, 0x00, 0x0B, 0x89, 0xDC, 0x40, 0x0B, 0xE5, 0x2A, 0xC0, 0x0B, 0xA0, 0x04, 0xF0,
+    0x0B, 0x80, 0x04, 0xF0, 0x0B, 0x80, 0x04, 0xF0, 0x0B, 0x80, 0x04, 0xF0, 0x0B, 0x80, 0x04, 0xF0,
+    0x08, 0x60, 0x03, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'i' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x05, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBB, 0xA0, 0x00, 0x01, 0x48, 0xD0, 0x00, 0x00, 0x06, 0xD0, 0x00,
+    0x00, 0x06, 0xD0, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x03, 0x48, 0xE4, 0x41,
+    0x08, 0xBB, 0xBB, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'j' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xBB, 0xB3, 0x00, 0x00, 0x44, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
+    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
+    0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF3, 0x00, 0x04, 0x6A, 0xD0, 0x00, 0x07, 0x98, 0x20, 0x00,
+    /* 'k' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00,
+    0x06, 0xD0, 0x00, 0x00, 0x06, 0xD0, 0x04, 0xB2, 0x06, 0xD0, 0x4E, 0x50, 0x06, 0xD4, 0xE4, 0x00,
+    0x06, 0xFF, 0xD1, 0x00, 0x06, 0xE3, 0xBA, 0x00, 0x06, 0xD0, 0x2E, 0x60, 0x06, 0xD0, 0x05, 0xF3,
+    0x04, 0xA0, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'l' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xBB, 0x30, 0x00, 0x03, 0x4F, 0x40, 0x00,
+    0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00,
+    0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x00, 0x0A, 0xC4, 0x40,
+    0x00, 0x01, 0x9B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'm' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3A, 0xBD, 0x6D, 0xC2, 0x4F, 0x3A, 0xE3, 0xB7, 0x4D, 0x06, 0xB0, 0x89,
+    0x4D, 0x06, 0xB0, 0x89, 0x4D, 0x06, 0xB0, 0x89, 0x4D, 0x06, 0xB0, 0x89, 0x4D, 0x06, 0xB0, 0x89,
+    0x3A, 0x04, 0x80, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'n' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x69, 0xDC, 0x40, 0x0B, 0xE5, 0x2A, 0xC0, 0x0B, 0xA0, 0x04, 0xF0,
+    0x0B, 0x80, 0x04, 0xF0, 0x0B, 0x80, 0x04, 0xF0, 0x0B, 0x80, 0x04, 0xF0, 0x0B, 0x80, 0x04, 0xF0,
+    0x08, 0x60, 0x03, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'o' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xDA, 0x10, 0x08, 0xE4, 0x2B, 0xC0, 0x0E, 0x70, 0x02, 0xF3,
+    0x1F, 0x40, 0x00, 0xF5, 0x1F, 0x40, 0x00, 0xF5, 0x0E, 0x60, 0x02, 0xF3, 0x08, 0xD4, 0x2B, 0xC0,
+    0x00, 0x8D, 0xEA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'p' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x7B, 0xDB, 0x20, 0x0B, 0xF6, 0x29, 0xD0, 0x0B, 0xB0, 0x01, 0xF4,
+    0x0B, 0x80, 0x00, 0xD6, 0x0B, 0x80, 0x00, 0xD6, 0x0B, 0xB0, 0x01, 0xF4, 0x0B, 0xF6, 0x29, 0xD0,
+    0x0B, 0x9B, 0xEB, 0x20, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00,
+    /* 'q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xC5, 0xB1, 0x08, 0xD4, 0x3D, 0xF2, 0x0E, 0x70, 0x05, 0xF2,
+    0x1F, 0x40, 0x03, 0xF2, 0x1F, 0x40, 0x03, 0xF2, 0x0E, 0x60, 0x05, 0xF2, 0x08, 0xD3, 0x3C, 0xF2,
+    0x01, 0x9E, 0xD7, 0xF2, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x01, 0x91,
+    /* 'r' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x6D, 0xD8, 0x00, 0x9D, 0xB4, 0x46, 0x00, 0x9E, 0x00, 0x00,
+    0x00, 0x9B, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00,
+    0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 's' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xDC, 0x40, 0x06, 0xE3, 0x24, 0x40, 0x08, 0xC0, 0x00, 0x00,
+    0x03, 0xED, 0x95, 0x00, 0x00, 0x15, 0x9F, 0x90, 0x00, 0x00, 0x06, 0xD0, 0x06, 0x52, 0x2B, 0xB0,
+    0x05, 0xCE, 0xEA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 't' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x20, 0x00,
+    0x00, 0x2F, 0x20, 0x00, 0x1B, 0xCF, 0xCB, 0xA0, 0x04, 0x5F, 0x54, 0x30, 0x00, 0x2F, 0x20, 0x00,
+    0x00, 0x2F, 0x20, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x00, 0x0E, 0x94, 0x30,
+    0x00, 0x03, 0xAB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'u' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x60, 0x03, 0xB0, 0x0B, 0x80, 0x04, 0xF0, 0x0B, 0x80, 0x04, 0xF0,
+    0x0B, 0x80, 0x04, 0xF0, 0x0B, 0x80, 0x04, 0xF0, 0x0A, 0x90, 0x05, 0xF0, 0x07, 0xE3, 0x3C, 0xF0,
+    0x01, 0xAE, 0xC5, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'v' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2B, 0x10, 0x00, 0x95, 0x0D, 0x60, 0x02, 0xF2, 0x08, 0xB0, 0x07, 0xC0,
+    0x03, 0xF1, 0x0C, 0x70, 0x00, 0xC7, 0x2F, 0x20, 0x00, 0x7B, 0x8B, 0x00, 0x00, 0x2F, 0xE6, 0x00,
+    0x00, 0x09, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'w' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x0B, 0xB7, 0x00, 0x00, 0x3E, 0x7B, 0x04, 0x70, 0x7B,
+    0x4E, 0x0A, 0xE0, 0xA8, 0x0F, 0x2D, 0x94, 0xD4, 0x0C, 0x99, 0x59, 0xF1, 0x08, 0xF4, 0x1F, 0xC0,
+    0x04, 0xB1, 0x09, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'x' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x50, 0x02, 0xB3, 0x04, 0xE2, 0x0C, 0x80, 0x00, 0x8C, 0x8C, 0x00,
+    0x00, 0x0C, 0xE2, 0x00, 0x00, 0x2E, 0xF5, 0x00, 0x00, 0xB9, 0x5E, 0x20, 0x08, 0xC0, 0x09, 0xC0,
+    0x2B, 0x30, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'y' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2B, 0x20, 0x00, 0x87, 0x0C, 0x70, 0x01, 0xF4, 0x06, 0xD0, 0x06, 0xD0,
+    0x01, 0xF4, 0x0C, 0x70, 0x00, 0x99, 0x2F, 0x10, 0x00, 0x4E, 0x9B, 0x00, 0x00, 0x0D, 0xF5, 0x00,
+    0x00, 0x08, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x04, 0x8F, 0x20, 0x00, 0x07, 0x93, 0x00, 0x00,
+    /* 'z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBB, 0xBB, 0xB0, 0x02, 0x44, 0x4B, 0xC0, 0x00, 0x00, 0x5E, 0x20,
+    0x00, 0x03, 0xE4, 0x00, 0x00, 0x1D, 0x70, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x07, 0xE4, 0x44, 0x40,
+    0x07, 0xBB, 0xBB, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '{' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x70, 0x00, 0x04, 0xF6, 0x30,
+    0x00, 0x06, 0xD0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x0A, 0xA0, 0x00,
+    0x07, 0xEE, 0x20, 0x00, 0x01, 0x3C, 0x80, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00,
+    0x00, 0x07, 0xC0, 0x00, 0x00, 0x05, 0xE1, 0x00, 0x00, 0x00, 0xBE, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    /* '|' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x08, 0xB0, 0x00,
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00,
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00,
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00,
+    /* '}' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x98, 0x10, 0x00, 0x02, 0x5D, 0x80, 0x00,
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x06, 0xD1, 0x00,
+    0x00, 0x01, 0xBE, 0xA0, 0x00, 0x04, 0xE4, 0x10, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xB0, 0x00,
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x08, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '~' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x75, 0x00, 0x02,
+    0x5D, 0x9C, 0xEA, 0xC9, 0x10, 0x00, 0x37, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const font_t font_mono16_aa = {
+    .width = 8U,
+    .height = 16U,
+    .bpp = 4U,
+    .first = 0x20U,
+    .last = 0x7EU,
+    .glyph_bytes = 64U,
+    .bitmap = font_mono16_aa_bitmap,
+};
@@ -0,0 +1,402 @@
+/*
+ * 由 tools/fontgen.py 生成，请勿手工修改。
+ *   python3 tools/fontgen.py DejaVuSansMono.ttf 24 1 font_mono24
+ *
+ * 字形来自 DejaVu Sans Mono（Bitstream Vera / DejaVu 许可，允许嵌入与再分发）。
+ * 单元格 12x24，1bpp，字符 0x20..0x7E，每字形 36 字节。
+ */
+
+#include "font/font.h"
+
+static const uint8_t font_mono24_bitmap[3420] = {
+    /* ' ' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '!' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '"' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x81, 0x98, 0x19, 0x81, 0x98, 0x19, 0x81, 0x98, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '#' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x66, 0x04, 0x60, 0xCC, 0x7F, 0xF7, 0xFF, 0x0C,
+    0xC1, 0x98, 0x19, 0x8F, 0xFE, 0xFF, 0xE3, 0x30, 0x33, 0x03, 0x30, 0x23, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '$' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x20, 0x1F, 0xC3, 0xAC, 0x32, 0x03, 0x20, 0x32,
+    0x01, 0xE0, 0x0F, 0xC0, 0x3E, 0x02, 0x60, 0x26, 0x02, 0x63, 0xBE, 0x3F, 0x80, 0x20, 0x02, 0x00,
+    0x20, 0x00, 0x00, 0x00,
+    /* '%' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x66, 0x0C, 0x60, 0xC6, 0x06, 0xC0, 0x7C,
+    0xE0, 0x38, 0x1C, 0x07, 0x1E, 0x03, 0x30, 0x21, 0x02, 0x30, 0x33, 0x01, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '&' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xD8, 0x30, 0x03, 0x00, 0x18, 0x01, 0x80, 0x1C,
+    0x03, 0xE1, 0x66, 0x36, 0x33, 0x41, 0xB6, 0x1F, 0x60, 0xE7, 0x1E, 0x3F, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* ''' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '(' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x30, 0x03, 0x00, 0x60, 0x06, 0x00, 0x60, 0x0E,
+    0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x30, 0x03, 0x00,
+    0x18, 0x00, 0x00, 0x00,
+    /* ')' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0C, 0x00, 0xC0, 0x06, 0x00, 0x60, 0x03, 0x00, 0x30, 0x03,
+    0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x60, 0x06, 0x00, 0x60, 0x0C, 0x00,
+    0x80, 0x00, 0x00, 0x00,
+    /* '0x2A' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x32, 0xE1, 0xF8, 0x07, 0x01, 0xF8, 0x32,
+    0xE0, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '+' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x7F, 0xF7, 0xFE, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* ',' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x70, 0x07, 0x00, 0x60, 0x0C, 0x00,
+    0xC0, 0x00, 0x00, 0x00,
+    /* '-' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '.' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x70, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '0x2F' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x30, 0x03,
+    0x00, 0x70, 0x06, 0x00, 0xE0, 0x0C, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x30, 0x03, 0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '0' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFC, 0x30, 0xC3, 0x0E, 0x30, 0x67, 0x06, 0x66,
+    0x66, 0x76, 0x66, 0x67, 0x06, 0x70, 0x63, 0x06, 0x30, 0xC1, 0x9C, 0x1F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '1' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xF0, 0x13, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03,
+    0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x01, 0xFE, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '2' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x20, 0xC0, 0x0E, 0x00, 0xE0, 0x0C, 0x00,
+    0xC0, 0x18, 0x03, 0x00, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '3' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0xC0, 0x0E, 0x00, 0xE0, 0x0C, 0x0F,
+    0x80, 0xF8, 0x01, 0xC0, 0x0E, 0x00, 0x60, 0x06, 0x00, 0xE7, 0x3C, 0x7F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '4' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x38, 0x07, 0x80, 0x78, 0x0D, 0x80, 0x98, 0x19,
+    0x83, 0x18, 0x31, 0x86, 0x1C, 0x7F, 0xE7, 0xFE, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '5' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x30, 0x03, 0x00, 0x30, 0x03, 0xF0, 0x3F,
+    0x80, 0x1C, 0x00, 0xE0, 0x06, 0x00, 0x60, 0x0E, 0x00, 0xC7, 0x3C, 0x7F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '6' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x38, 0x03, 0x00, 0x30, 0x06, 0x78, 0x7F,
+    0xC7, 0x8E, 0x70, 0x67, 0x06, 0x70, 0x63, 0x06, 0x30, 0x63, 0x8C, 0x1F, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '7' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0xC0, 0x0C, 0x01, 0xC0, 0x18, 0x01,
+    0x80, 0x30, 0x03, 0x00, 0x70, 0x06, 0x00, 0x60, 0x0E, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '8' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFC, 0x30, 0xE3, 0x06, 0x30, 0x63, 0x0C, 0x1F,
+    0xC1, 0xF8, 0x38, 0xC7, 0x06, 0x60, 0x67, 0x06, 0x70, 0x63, 0x9E, 0x1F, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '9' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFC, 0x30, 0xC7, 0x0E, 0x60, 0x66, 0x06, 0x70,
+    0xE3, 0x0E, 0x3F, 0xE1, 0xF6, 0x00, 0x60, 0x0E, 0x00, 0xC3, 0x3C, 0x3F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* ':' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x70, 0x07,
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x70, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* ';' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x70, 0x07,
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x70, 0x07, 0x00, 0x60, 0x0C, 0x00,
+    0xC0, 0x00, 0x00, 0x00,
+    /* '<' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1E, 0x0F,
+    0x87, 0xC0, 0x70, 0x07, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '=' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xF7, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '>' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x07, 0xC0, 0x1F,
+    0x00, 0x3E, 0x00, 0x70, 0x1E, 0x0F, 0x83, 0xE0, 0x70, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '?' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFC, 0x00, 0xC0, 0x0E, 0x00, 0xC0, 0x1C, 0x03,
+    0x80, 0x70, 0x06, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '@' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1F, 0xE3, 0x06, 0x60, 0x36, 0x1B, 0x47,
+    0xFC, 0xE3, 0xCC, 0x3C, 0xC3, 0xCC, 0x3C, 0xC3, 0xC7, 0xF6, 0x3F, 0x60, 0x03, 0x00, 0x1C, 0x00,
+    0xFC, 0x00, 0x00, 0x00,
+    /* 'A' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xF0, 0x0F, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x19,
+    0x81, 0x8C, 0x30, 0xC3, 0x8C, 0x3F, 0xE7, 0x06, 0x60, 0x66, 0x07, 0xE0, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'B' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x30, 0xE3, 0x06, 0x30, 0x63, 0x0E, 0x3F,
+    0xC3, 0xFC, 0x30, 0xE3, 0x06, 0x30, 0x73, 0x07, 0x30, 0x63, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'C' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xFE, 0x38, 0x03, 0x00, 0x30, 0x07, 0x00, 0x70,
+    0x07, 0x00, 0x70, 0x07, 0x00, 0x30, 0x03, 0x00, 0x38, 0x01, 0xC6, 0x0F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'D' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xF8, 0x61, 0xC6, 0x0E, 0x60, 0x66, 0x06, 0x60,
+    0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x66, 0x0E, 0x60, 0xC7, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'E' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0xFE, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x3F,
+    0xE3, 0xFE, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'F' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0xFE, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x3F,
+    0xC3, 0xFE, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'G' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xFE, 0x38, 0x23, 0x00, 0x70, 0x06, 0x00, 0x60,
+    0x06, 0x1E, 0x61, 0xE6, 0x06, 0x70, 0x63, 0x06, 0x30, 0x61, 0xCE, 0x0F, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'H' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x7F,
+    0xE7, 0xFE, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'I' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'J' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00,
+    0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x1C, 0x41, 0x87, 0x38, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'K' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x76, 0x0E, 0x61, 0xC6, 0x38, 0x67, 0x06, 0x60, 0x7E,
+    0x07, 0xE0, 0x77, 0x07, 0x38, 0x61, 0x86, 0x1C, 0x60, 0xE6, 0x06, 0x60, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'L' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30,
+    0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'M' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x77, 0x0F, 0x70, 0xF7, 0x8F, 0x69, 0xB6, 0xD3, 0x6D,
+    0x36, 0x73, 0x66, 0x36, 0x63, 0x60, 0x36, 0x03, 0x60, 0x36, 0x03, 0x60, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'N' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x67, 0x86, 0x78, 0x67, 0x86, 0x6C, 0x66, 0xC6, 0x66,
+    0x66, 0x66, 0x63, 0x66, 0x36, 0x63, 0x66, 0x1E, 0x61, 0xE6, 0x0E, 0x60, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'O' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFC, 0x30, 0xC3, 0x06, 0x70, 0x66, 0x06, 0x60,
+    0x66, 0x06, 0x60, 0x66, 0x06, 0x70, 0x67, 0x06, 0x30, 0xE3, 0x9C, 0x1F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'P' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFE, 0x30, 0xE3, 0x06, 0x30, 0x73, 0x07, 0x30,
+    0x63, 0xFE, 0x3F, 0xC3, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'Q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFC, 0x30, 0xC3, 0x06, 0x70, 0x66, 0x06, 0x60,
+    0x66, 0x06, 0x60, 0x66, 0x06, 0x70, 0x67, 0x06, 0x30, 0xE3, 0x9C, 0x1F, 0x80, 0x38, 0x00, 0xC0,
+    0x0C, 0x00, 0x00, 0x00,
+    /* 'R' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xFC, 0x70, 0xC7, 0x0E, 0x70, 0x67, 0x0E, 0x70,
+    0xC7, 0xF8, 0x7F, 0x87, 0x1C, 0x70, 0xC7, 0x0E, 0x70, 0x67, 0x07, 0x70, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'S' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xFC, 0x30, 0x07, 0x00, 0x70, 0x07, 0x00, 0x3E,
+    0x01, 0xF8, 0x03, 0xC0, 0x0E, 0x00, 0x60, 0x06, 0x00, 0x63, 0x1E, 0x3F, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'T' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'U' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x67, 0x06, 0x70, 0x67, 0x06, 0x70, 0x67, 0x06, 0x70,
+    0x67, 0x06, 0x70, 0x67, 0x06, 0x70, 0x67, 0x06, 0x30, 0x63, 0x9C, 0x1F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'V' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x36, 0x07, 0x60, 0x67, 0x06, 0x30, 0xE3, 0x0C, 0x30,
+    0xC1, 0x8C, 0x19, 0x81, 0x98, 0x0D, 0x80, 0xD8, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'W' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0x66, 0x36, 0x73, 0x67,
+    0x36, 0xF6, 0x6D, 0x66, 0xD6, 0x69, 0xE3, 0x9E, 0x38, 0xE3, 0x8E, 0x30, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'X' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x73, 0x06, 0x38, 0xC1, 0x8C, 0x1D, 0x80, 0xF8, 0x07,
+    0x00, 0x70, 0x0F, 0x00, 0xD8, 0x19, 0xC3, 0x8C, 0x30, 0xE6, 0x06, 0xE0, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'Y' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x36, 0x06, 0x30, 0xE3, 0x8C, 0x19, 0xC1, 0xD8, 0x0F,
+    0x00, 0x70, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'Z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x60, 0x0C, 0x01, 0xC0, 0x18, 0x03,
+    0x00, 0x70, 0x06, 0x00, 0xC0, 0x1C, 0x01, 0x80, 0x30, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '[' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0x80, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x07, 0x80,
+    0x78, 0x00, 0x00, 0x00,
+    /* '0x5C' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x30, 0x01, 0x80, 0x18, 0x01, 0xC0, 0x0C,
+    0x00, 0xE0, 0x06, 0x00, 0x60, 0x03, 0x00, 0x30, 0x01, 0x80, 0x18, 0x00, 0xC0, 0x0C, 0x00, 0x60,
+    0x00, 0x00, 0x00, 0x00,
+    /* ']' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03,
+    0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x0F, 0x01,
+    0xF0, 0x00, 0x00, 0x00,
+    /* '^' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xF0, 0x1D, 0x83, 0x8C, 0x30, 0x66, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '_' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF,
+    /* '`' */
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x0C, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'a' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0x1C, 0x00,
+    0xE0, 0x06, 0x1F, 0xE3, 0xFE, 0x70, 0x66, 0x0E, 0x60, 0xE3, 0x1E, 0x3F, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'b' */
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xC3, 0x8C, 0x30,
+    0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x8C, 0x3F, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'c' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xC6, 0x38,
+    0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x38, 0x01, 0xC6, 0x0F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'd' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x1F, 0xE3, 0x9E, 0x30,
+    0xE7, 0x0E, 0x60, 0xE6, 0x06, 0x60, 0xE6, 0x0E, 0x30, 0xE3, 0x9E, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'e' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0x8C, 0x30,
+    0x67, 0x06, 0x7F, 0xE7, 0xFE, 0x60, 0x06, 0x00, 0x30, 0x03, 0x86, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'f' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0xE0, 0x60, 0x06, 0x00, 0x60, 0x3F, 0xE0, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'g' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE3, 0x9E, 0x30,
+    0xE7, 0x0E, 0x60, 0x66, 0x06, 0x60, 0xE7, 0x0E, 0x30, 0xE3, 0xFE, 0x1F, 0xE0, 0x0E, 0x00, 0xC1,
+    0x0C, 0x3F, 0x80, 0xE0,
+    /* 'h' */
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x37, 0xC3, 0xDC, 0x30,
+    0xE3, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'i' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x70, 0x3F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'j' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x30, 0x03,
+    0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,
+    0x70, 0x3E, 0x00, 0x00,
+    /* 'k' */
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0xE3, 0x1C, 0x33,
+    0x83, 0x70, 0x3E, 0x03, 0xF0, 0x3B, 0x83, 0x1C, 0x30, 0xC3, 0x06, 0x30, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'l' */
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04,
+    0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x60, 0x06, 0x00, 0x70, 0x03, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'm' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE6, 0x76, 0x66,
+    0x26, 0x62, 0x66, 0x26, 0x62, 0x66, 0x26, 0x62, 0x66, 0x26, 0x62, 0x66, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'n' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xC3, 0xDC, 0x30,
+    0xE3, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'o' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0x9C, 0x30,
+    0xE7, 0x06, 0x60, 0x66, 0x06, 0x60, 0x67, 0x06, 0x30, 0xE3, 0x9C, 0x1F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'p' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0x8C, 0x30,
+    0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x8C, 0x3F, 0xC3, 0x00, 0x30, 0x03,
+    0x00, 0x30, 0x00, 0x00,
+    /* 'q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE3, 0x9E, 0x30,
+    0xE7, 0x0E, 0x60, 0x66, 0x06, 0x60, 0x67, 0x0E, 0x30, 0xE3, 0x9E, 0x1F, 0xE0, 0x46, 0x00, 0x60,
+    0x06, 0x00, 0x60, 0x04,
+    /* 'r' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xF3, 0x0C,
+    0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 's' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0x8C, 0x30,
+    0x03, 0x00, 0x3E, 0x01, 0xF8, 0x01, 0xC0, 0x0C, 0x00, 0xC3, 0x1C, 0x3F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 't' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x7F, 0xC0, 0xC0, 0x0C,
+    0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x70, 0x07, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'u' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x63, 0x06, 0x30,
+    0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x0E, 0x30, 0xE3, 0x9E, 0x1F, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'v' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x67, 0x06, 0x30,
+    0xE3, 0x0C, 0x18, 0xC1, 0x98, 0x19, 0x80, 0xD8, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'w' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3C, 0x03, 0x60,
+    0x36, 0x63, 0x66, 0x66, 0x76, 0x6D, 0x63, 0xD6, 0x39, 0xC3, 0x9C, 0x38, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'x' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x63, 0x8C, 0x19,
+    0x80, 0xF8, 0x07, 0x00, 0x70, 0x0F, 0x01, 0xD8, 0x19, 0xC3, 0x0E, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* 'y' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x63, 0x06, 0x30,
+    0x63, 0x0C, 0x18, 0xC1, 0x9C, 0x0D, 0x80, 0xD8, 0x0F, 0x00, 0x70, 0x07, 0x00, 0x60, 0x06, 0x00,
+    0xC0, 0x3C, 0x00, 0x00,
+    /* 'z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0E, 0x01,
+    0xC0, 0x18, 0x03, 0x00, 0x60, 0x0E, 0x01, 0xC0, 0x18, 0x03, 0x80, 0x3F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    /* '{' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x03, 0xC0, 0x70, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x3C, 0x03, 0xC0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x07, 0x00,
+    0x3C, 0x00, 0xC0, 0x00,
+    /* '|' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+    0x60, 0x06, 0x00, 0x60,
+    /* '}' */
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x3E, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x70, 0x03, 0xC0, 0x3C, 0x07, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x03,
+    0xC0, 0x10, 0x00, 0x00,
+    /* '~' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xC0, 0x7F, 0xF4, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+
+const font_t font_mono24 = {
+    .width = 12U,
+    .height = 24U,
+    .bpp = 1U,
+    .first = 0x20U,
+    .last = 0x7EU,
+    .glyph_bytes = 36U,
+    .bitmap = font_mono24_bitmap,
+};
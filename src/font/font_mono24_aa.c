@@ -0,0 +1,972 @@
+/*
+ * 由 tools/fontgen.py 生成，请勿手工修改。
+ *   python3 tools/fontgen.py DejaVuSansMono.ttf 24 4 font_mono24_aa
+ *
+ * 字形来自 DejaVu Sans Mono（Bitstream Vera / DejaVu 许可，允许嵌入与再分发）。
+ * 单元格 12x24，4bpp，字符 0x20..0x7E，每字形 144 字节。
+ */
+
+#include "font/font.h"
+
+static const uint8_t font_mono24_aa_bitmap[13680] = {
+    /* ' ' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '!' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD3, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x61, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '"' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xD2, 0x0A, 0xD0, 0x00, 0x00, 0x09,
+    0xF2, 0x0B, 0xF0, 0x00, 0x00, 0x09, 0xF2, 0x0B, 0xF0, 0x00, 0x00, 0x09, 0xF2, 0x0B, 0xF0, 0x00,
+    0x00, 0x09, 0xF2, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xB1, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '#' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x07, 0x80, 0x00, 0x00,
+    0x1F, 0x90, 0x0E, 0xA0, 0x00, 0x00, 0x4F, 0x50, 0x3F, 0x70, 0x00, 0x00, 0x8F, 0x10, 0x7F, 0x30,
+    0x07, 0x88, 0xDE, 0x88, 0xCF, 0x88, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x25, 0xF6, 0x24,
+    0xF8, 0x22, 0x00, 0x08, 0xF1, 0x07, 0xF3, 0x00, 0x00, 0x0B, 0xD0, 0x0A, 0xE0, 0x00, 0x99, 0x9F,
+    0xD9, 0x9E, 0xE9, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x8F, 0x10, 0x7F, 0x30, 0x00,
+    0x00, 0xCD, 0x00, 0xAE, 0x00, 0x00, 0x01, 0xF9, 0x00, 0xEA, 0x00, 0x00, 0x04, 0xF5, 0x03, 0xF6,
+    0x00, 0x00, 0x01, 0x20, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '$' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xFF, 0xFB, 0x20, 0x00, 0x8F, 0xB4, 0xF4, 0x8D, 0x40,
+    0x00, 0xED, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xFB, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xEF, 0x30, 0xF0,
+    0x00, 0x00, 0x00, 0x6F, 0xFB, 0xF5, 0x10, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xCF, 0xA0, 0x00, 0x00, 0x00, 0xF0, 0x1D, 0xF1, 0x00, 0x00, 0x00, 0xF0, 0x0A, 0xF4,
+    0x01, 0x40, 0x00, 0xF0, 0x1D, 0xF1, 0x02, 0xFC, 0x85, 0xF6, 0xCF, 0x70, 0x00, 0x7B, 0xFF, 0xFF,
+    0xD6, 0x00, 0x00, 0x00, 0x02, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '%' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xF9, 0x00, 0x00, 0x00, 0x5F, 0x72, 0x6F, 0x60, 0x00, 0x00, 0x9C, 0x00, 0x0A, 0xB0, 0x00, 0x00,
+    0x9C, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x4F, 0x84, 0x8F, 0x50, 0x00, 0x65, 0x06, 0xEF, 0xF7, 0x03,
+    0x9E, 0xB4, 0x00, 0x02, 0x16, 0xCE, 0x82, 0x00, 0x00, 0x39, 0xEB, 0x51, 0x43, 0x00, 0x0C, 0xE8,
+    0x20, 0x5E, 0xFF, 0xC1, 0x04, 0x00, 0x01, 0xEA, 0x23, 0xDB, 0x00, 0x00, 0x05, 0xF1, 0x00, 0x6F,
+    0x00, 0x00, 0x05, 0xF2, 0x00, 0x6F, 0x00, 0x00, 0x01, 0xDC, 0x45, 0xEA, 0x00, 0x00, 0x00, 0x3D,
+    0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '&' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x4F,
+    0xE7, 0x69, 0xA0, 0x00, 0x00, 0x9F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFC, 0x10,
+    0x00, 0x00, 0x04, 0xFA, 0x7F, 0x90, 0x00, 0x48, 0x0E, 0xD0, 0x0B, 0xF6, 0x00, 0x8F, 0x4F, 0x70,
+    0x01, 0xEE, 0x20, 0x9F, 0x6F, 0x60, 0x00, 0x4F, 0xC0, 0xBB, 0x5F, 0x80, 0x00, 0x08, 0xFB, 0xF6,
+    0x2F, 0xE2, 0x00, 0x00, 0xBF, 0xC0, 0x08, 0xFD, 0x62, 0x38, 0xEF, 0xE2, 0x00, 0x7F, 0xFF, 0xFF,
+    0xA6, 0xFC, 0x00, 0x01, 0x56, 0x52, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ''' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xD2, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x07, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '(' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ')' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x10, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0x20, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '0x2A' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x06, 0xB0, 0x00, 0x00, 0x00, 0x30,
+    0x06, 0xB0, 0x01, 0x20, 0x02, 0xEA, 0x26, 0xB0, 0x6E, 0x80, 0x00, 0x18, 0xEB, 0xDC, 0xC4, 0x00,
+    0x00, 0x00, 0x4E, 0xF9, 0x00, 0x00, 0x00, 0x18, 0xEB, 0xDD, 0xB3, 0x00, 0x02, 0xEB, 0x26, 0xB0,
+    0x7F, 0x70, 0x00, 0x40, 0x06, 0xB0, 0x02, 0x20, 0x00, 0x00, 0x06, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '+' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x02, 0x22, 0x2A, 0xF2, 0x22, 0x21, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x18, 0x88,
+    0x8C, 0xF8, 0x88, 0x84, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ',' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '-' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x66, 0x50, 0x00, 0x00, 0x06,
+    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0x66, 0x66, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '.' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2D, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '0x2F' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x30, 0x00, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x10, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00,
+    0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '0' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x04, 0xDF, 0xFE, 0x80, 0x00, 0x00, 0x3F,
+    0xF9, 0x8D, 0xF9, 0x00, 0x00, 0xCF, 0x60, 0x01, 0xEF, 0x30, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0x80,
+    0x06, 0xFA, 0x00, 0x00, 0x3F, 0xC0, 0x08, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x09, 0xF6, 0x08, 0xA2,
+    0x0F, 0xF0, 0x09, 0xF6, 0x2F, 0xF8, 0x0F, 0xF2, 0x09, 0xF6, 0x0B, 0xD3, 0x0F, 0xF0, 0x09, 0xF7,
+    0x00, 0x00, 0x1F, 0xF0, 0x07, 0xF9, 0x00, 0x00, 0x3F, 0xD0, 0x04, 0xFC, 0x00, 0x00, 0x6F, 0xA0,
+    0x00, 0xDF, 0x30, 0x00, 0xCF, 0x40, 0x00, 0x6F, 0xD5, 0x49, 0xFC, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0xC1, 0x00, 0x00, 0x00, 0x25, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '1' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x9C, 0xDB, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x57, 0x43, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x29, 0x9A, 0xFE, 0x99, 0x90, 0x00, 0x4F, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x02, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '2' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x20, 0x00, 0x00, 0x01, 0x8D, 0xFF, 0xFD, 0x70, 0x00, 0x06, 0xFE,
+    0xA8, 0xAE, 0xFA, 0x00, 0x04, 0x70, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x04,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF3, 0x00, 0x00, 0x00, 0x01, 0xCF, 0x50, 0x00, 0x00, 0x00,
+    0x1B, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xA9, 0x99, 0x99, 0x60, 0x08, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x90, 0x01, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '3' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x20, 0x00, 0x00, 0x01, 0xAE, 0xFF, 0xFE, 0x80, 0x00, 0x02, 0xFC,
+    0xA8, 0x9E, 0xFB, 0x00, 0x01, 0x20, 0x00, 0x01, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0x03, 0xEE, 0x20, 0x00, 0x00, 0xBB, 0xCF,
+    0xD4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFE, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xD0,
+    0x02, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x09, 0xC8, 0x54, 0x6B, 0xFE, 0x20, 0x08, 0xFF, 0xFF, 0xFF,
+    0xD3, 0x00, 0x00, 0x13, 0x66, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '4' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xD5, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xF6, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xF6, 0x00, 0x00, 0x00, 0x2E, 0x79, 0xF6, 0x00,
+    0x00, 0x00, 0xBD, 0x09, 0xF6, 0x00, 0x00, 0x05, 0xF4, 0x09, 0xF6, 0x00, 0x00, 0x1E, 0xA0, 0x09,
+    0xF6, 0x00, 0x00, 0x9F, 0x20, 0x09, 0xF6, 0x00, 0x04, 0xF7, 0x00, 0x09, 0xF6, 0x00, 0x0D, 0xE2,
+    0x22, 0x2A, 0xF7, 0x21, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x08, 0x88, 0x88, 0x8C, 0xFA, 0x83,
+    0x00, 0x00, 0x00, 0x09, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xF6, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '5' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xDD, 0xDD, 0xDA, 0x00, 0x00, 0xDF,
+    0xDD, 0xDD, 0xDA, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0xAB, 0xB8, 0x20, 0x00, 0x00, 0xDF, 0xEE, 0xFF,
+    0xF5, 0x00, 0x00, 0x62, 0x00, 0x29, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xA0,
+    0x01, 0x00, 0x00, 0x01, 0xDF, 0x50, 0x08, 0xC7, 0x54, 0x7D, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0xA1, 0x00, 0x00, 0x25, 0x66, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '6' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFF, 0xFB, 0x00, 0x00, 0x1D,
+    0xFD, 0x98, 0xBF, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x3A, 0xBB, 0x60, 0x00, 0x09, 0xF8, 0xFE, 0xCE,
+    0xFB, 0x10, 0x09, 0xFF, 0x80, 0x01, 0xCF, 0x80, 0x09, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x09, 0xFA,
+    0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF9, 0x00, 0x00, 0x0E, 0xF1, 0x04, 0xFA, 0x00, 0x00, 0x1F, 0xF0,
+    0x00, 0xEF, 0x20, 0x00, 0x5F, 0xB0, 0x00, 0x7F, 0xD5, 0x26, 0xEF, 0x40, 0x00, 0x08, 0xFF, 0xFF,
+    0xF6, 0x00, 0x00, 0x00, 0x25, 0x65, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '7' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDD, 0xDD, 0xDD, 0xDD, 0xB0, 0x08, 0xDD,
+    0xDD, 0xDD, 0xEF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x10, 0x00, 0x00, 0x00,
+    0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x20, 0x00, 0x00, 0x00, 0x06, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '8' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x00, 0x08, 0xEF, 0xFF, 0xB3, 0x00, 0x00, 0x9F,
+    0xD7, 0x6A, 0xFE, 0x20, 0x02, 0xFE, 0x10, 0x00, 0x9F, 0x80, 0x05, 0xFB, 0x00, 0x00, 0x4F, 0xB0,
+    0x04, 0xFB, 0x00, 0x00, 0x5F, 0xA0, 0x00, 0xDF, 0x30, 0x00, 0xBF, 0x40, 0x00, 0x2C, 0xFA, 0x9D,
+    0xE6, 0x00, 0x00, 0x18, 0xEF, 0xFF, 0xB3, 0x00, 0x00, 0xCF, 0x71, 0x04, 0xDF, 0x40, 0x06, 0xFA,
+    0x00, 0x00, 0x3F, 0xC0, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF1, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF1,
+    0x08, 0xFB, 0x00, 0x00, 0x5F, 0xD0, 0x01, 0xEF, 0xA4, 0x36, 0xEF, 0x70, 0x00, 0x3D, 0xFF, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x36, 0x65, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '9' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0xBF,
+    0xC7, 0x7D, 0xF9, 0x00, 0x04, 0xFC, 0x10, 0x01, 0xDF, 0x30, 0x09, 0xF7, 0x00, 0x00, 0x6F, 0x80,
+    0x0B, 0xF4, 0x00, 0x00, 0x4F, 0xC0, 0x0B, 0xF4, 0x00, 0x00, 0x4F, 0xE0, 0x09, 0xF7, 0x00, 0x00,
+    0x7F, 0xF0, 0x04, 0xFD, 0x10, 0x01, 0xDF, 0xF0, 0x00, 0xAF, 0xD8, 0x8E, 0xCD, 0xF0, 0x00, 0x08,
+    0xEF, 0xFA, 0x1E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0x00, 0x00, 0x02, 0xEF, 0x20, 0x00, 0x88, 0x54, 0x7E, 0xF7, 0x00, 0x00, 0x9F, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x03, 0x66, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ':' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x95, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2D, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ';' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x95, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '<' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x39, 0xE8, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xD4, 0x00, 0x03, 0x9E, 0xFE,
+    0x93, 0x00, 0x06, 0xCF, 0xFB, 0x50, 0x00, 0x00, 0x2F, 0xF9, 0x20, 0x00, 0x00, 0x00, 0x1B, 0xFF,
+    0xB6, 0x10, 0x00, 0x00, 0x00, 0x28, 0xEF, 0xE9, 0x40, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xFD, 0x82,
+    0x00, 0x00, 0x00, 0x02, 0x8E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '=' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x44, 0x44, 0x44, 0x42, 0x2F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x18, 0x88, 0x88, 0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22,
+    0x22, 0x22, 0x22, 0x21, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x19, 0x99, 0x99, 0x99, 0x99, 0x95,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '>' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE8, 0x20, 0x00, 0x00, 0x00, 0x17, 0xCF, 0xFB,
+    0x50, 0x00, 0x00, 0x00, 0x03, 0x9E, 0xFE, 0x92, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF8, 0x00, 0x00,
+    0x00, 0x39, 0xEF, 0xE5, 0x00, 0x02, 0x7D, 0xFF, 0xB5, 0x00, 0x05, 0xBF, 0xFD, 0x82, 0x00, 0x00,
+    0x2F, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '?' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x00, 0x18, 0xEF, 0xFF, 0xB2, 0x00, 0x00, 0x8F,
+    0xC8, 0x8D, 0xFD, 0x10, 0x00, 0x54, 0x00, 0x01, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xA0, 0x00, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x60, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '@' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5A, 0xDD, 0xB6, 0x00, 0x00, 0x1C, 0xFC, 0x88, 0xCF, 0xA0, 0x01, 0xDE, 0x40, 0x00, 0x07, 0xF5,
+    0x08, 0xF4, 0x00, 0x00, 0x00, 0xDA, 0x1F, 0x90, 0x00, 0x69, 0x94, 0x9D, 0x5F, 0x30, 0x0B, 0xFD,
+    0xDF, 0xDD, 0x8E, 0x00, 0x6F, 0x70, 0x05, 0xFD, 0xAC, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0xBB, 0x00,
+    0xDB, 0x00, 0x00, 0x8D, 0xBC, 0x00, 0xCC, 0x00, 0x00, 0xAD, 0x9E, 0x00, 0x8F, 0x30, 0x02, 0xED,
+    0x6F, 0x20, 0x1E, 0xE9, 0x8D, 0xFD, 0x2F, 0x80, 0x02, 0xAE, 0xE8, 0x7A, 0x0A, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xED, 0x20, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xE8, 0x42, 0x25, 0x10, 0x00, 0x01,
+    0x9E, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x35, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'A' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0x30, 0x00, 0x00, 0x01, 0xFB, 0x5F, 0x70, 0x00,
+    0x00, 0x06, 0xF7, 0x1F, 0xC0, 0x00, 0x00, 0x0A, 0xF3, 0x0C, 0xF1, 0x00, 0x00, 0x0E, 0xE0, 0x08,
+    0xF6, 0x00, 0x00, 0x4F, 0xA0, 0x04, 0xFB, 0x00, 0x00, 0x9F, 0x50, 0x00, 0xEF, 0x10, 0x00, 0xDF,
+    0x76, 0x66, 0xCF, 0x50, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x08, 0xF9, 0x44, 0x44, 0x4F, 0xE0,
+    0x0C, 0xF3, 0x00, 0x00, 0x0C, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x7F, 0xA0, 0x00, 0x00,
+    0x04, 0xFD, 0x12, 0x10, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'B' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDD, 0xDD, 0xDC, 0x81, 0x00, 0x06, 0xFE,
+    0xBB, 0xCE, 0xFE, 0x20, 0x06, 0xFB, 0x00, 0x00, 0x9F, 0xA0, 0x06, 0xFB, 0x00, 0x00, 0x3F, 0xD0,
+    0x06, 0xFB, 0x00, 0x00, 0x3F, 0xD0, 0x06, 0xFB, 0x00, 0x00, 0x9F, 0x90, 0x06, 0xFE, 0xBB, 0xBD,
+    0xFA, 0x10, 0x06, 0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x06, 0xFB, 0x00, 0x02, 0x9F, 0xB0, 0x06, 0xFB,
+    0x00, 0x00, 0x0C, 0xF3, 0x06, 0xFB, 0x00, 0x00, 0x09, 0xF6, 0x06, 0xFB, 0x00, 0x00, 0x0A, 0xF6,
+    0x06, 0xFB, 0x00, 0x00, 0x2E, 0xF3, 0x06, 0xFD, 0x88, 0x8A, 0xFF, 0xA0, 0x06, 0xFF, 0xFF, 0xFF,
+    0xD7, 0x00, 0x01, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'C' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFD, 0x60, 0x00, 0x0A,
+    0xFE, 0x98, 0x9E, 0xB0, 0x00, 0x6F, 0xD1, 0x00, 0x00, 0x50, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00,
+    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xB0, 0x00, 0x00, 0x20, 0x00, 0x1D, 0xFB, 0x54, 0x5A, 0xB0, 0x00, 0x01, 0xAF, 0xFF,
+    0xFF, 0x90, 0x00, 0x00, 0x02, 0x56, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'D' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDD, 0xDD, 0xA6, 0x00, 0x00, 0x09, 0xFD,
+    0xBD, 0xFF, 0xD2, 0x00, 0x09, 0xF6, 0x00, 0x19, 0xFD, 0x10, 0x09, 0xF6, 0x00, 0x00, 0xBF, 0x70,
+    0x09, 0xF6, 0x00, 0x00, 0x5F, 0xC0, 0x09, 0xF6, 0x00, 0x00, 0x2F, 0xF0, 0x09, 0xF6, 0x00, 0x00,
+    0x0F, 0xF2, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF2, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF2, 0x09, 0xF6,
+    0x00, 0x00, 0x2F, 0xF0, 0x09, 0xF6, 0x00, 0x00, 0x4F, 0xC0, 0x09, 0xF6, 0x00, 0x00, 0xAF, 0x80,
+    0x09, 0xF6, 0x00, 0x06, 0xFE, 0x20, 0x09, 0xFA, 0x89, 0xDF, 0xF5, 0x00, 0x09, 0xFF, 0xFF, 0xEA,
+    0x30, 0x00, 0x01, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'E' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xDD, 0xDD, 0xB0, 0x00, 0xFF,
+    0xDD, 0xDD, 0xDD, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBB, 0xBB,
+    0xBB, 0x70, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x99, 0x99, 0x99, 0x91, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF2, 0x00, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'F' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xDD, 0xDD, 0xDD, 0xD3, 0x00, 0x9F,
+    0xED, 0xDD, 0xDD, 0xD3, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xDB, 0xBB,
+    0xBB, 0x60, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'G' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFF, 0xFA, 0x30, 0x00, 0x2D,
+    0xFC, 0x88, 0xBF, 0x90, 0x00, 0xBF, 0x90, 0x00, 0x03, 0x70, 0x04, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xF2, 0x00, 0x09, 0x99, 0x91, 0x0E, 0xF2, 0x00, 0x0F, 0xFF, 0xF2, 0x0D, 0xF4,
+    0x00, 0x02, 0x2D, 0xF2, 0x0A, 0xF7, 0x00, 0x00, 0x0D, 0xF2, 0x06, 0xFB, 0x00, 0x00, 0x0D, 0xF2,
+    0x00, 0xEF, 0x40, 0x00, 0x0D, 0xF2, 0x00, 0x4F, 0xF8, 0x44, 0x8F, 0xF2, 0x00, 0x04, 0xDF, 0xFF,
+    0xFE, 0x60, 0x00, 0x00, 0x04, 0x66, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'H' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xD5, 0x00, 0x00, 0x0D, 0xD0, 0x09, 0xF6,
+    0x00, 0x00, 0x0F, 0xF0, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF0, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF0,
+    0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF0, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF0, 0x09, 0xFD, 0xBB, 0xBB,
+    0xBF, 0xF0, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF0, 0x09, 0xF6,
+    0x00, 0x00, 0x0F, 0xF0, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF0, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF0,
+    0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF0, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF0, 0x09, 0xF6, 0x00, 0x00,
+    0x0F, 0xF0, 0x01, 0x21, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'I' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xDD, 0xDD, 0x50, 0x00, 0xDD,
+    0xDF, 0xFE, 0xDD, 0x50, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x99, 0x9E, 0xFB, 0x99, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x60, 0x00, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'J' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDD, 0xDD, 0xD8, 0x00, 0x00, 0x03,
+    0xDD, 0xDE, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00,
+    0x06, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x0D, 0xD7, 0x44, 0x9F, 0xE1, 0x00, 0x0A, 0xFF, 0xFF, 0xFE,
+    0x50, 0x00, 0x00, 0x14, 0x66, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'K' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xD5, 0x00, 0x00, 0x08, 0xDA, 0x09, 0xF6,
+    0x00, 0x00, 0x8F, 0xB1, 0x09, 0xF6, 0x00, 0x08, 0xFD, 0x10, 0x09, 0xF6, 0x00, 0x7F, 0xD1, 0x00,
+    0x09, 0xF6, 0x07, 0xFD, 0x10, 0x00, 0x09, 0xF6, 0x5F, 0xE2, 0x00, 0x00, 0x09, 0xFA, 0xFF, 0x80,
+    0x00, 0x00, 0x09, 0xFF, 0xEE, 0xF3, 0x00, 0x00, 0x09, 0xFE, 0x37, 0xFC, 0x00, 0x00, 0x09, 0xF6,
+    0x00, 0xCF, 0x80, 0x00, 0x09, 0xF6, 0x00, 0x2F, 0xF3, 0x00, 0x09, 0xF6, 0x00, 0x08, 0xFD, 0x00,
+    0x09, 0xF6, 0x00, 0x00, 0xCF, 0x80, 0x09, 0xF6, 0x00, 0x00, 0x3F, 0xF3, 0x09, 0xF6, 0x00, 0x00,
+    0x08, 0xFD, 0x01, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'L' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x30, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xB9, 0x99, 0x99, 0x95, 0x00, 0xDF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'M' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xDA, 0x00, 0x00, 0x5D, 0xD7, 0x2F, 0xFF,
+    0x10, 0x00, 0xAF, 0xF8, 0x2F, 0xCF, 0x60, 0x01, 0xFC, 0xF8, 0x2F, 0xBA, 0xB0, 0x05, 0xF7, 0xF8,
+    0x2F, 0xB5, 0xF1, 0x0A, 0xB6, 0xF8, 0x2F, 0xB1, 0xF6, 0x1F, 0x66, 0xF8, 0x2F, 0xB0, 0xAB, 0x6F,
+    0x16, 0xF8, 0x2F, 0xB0, 0x5F, 0xCB, 0x06, 0xF8, 0x2F, 0xB0, 0x1F, 0xF6, 0x06, 0xF8, 0x2F, 0xB0,
+    0x08, 0xB1, 0x06, 0xF8, 0x2F, 0xB0, 0x00, 0x00, 0x06, 0xF8, 0x2F, 0xB0, 0x00, 0x00, 0x06, 0xF8,
+    0x2F, 0xB0, 0x00, 0x00, 0x06, 0xF8, 0x2F, 0xB0, 0x00, 0x00, 0x06, 0xF8, 0x2F, 0xB0, 0x00, 0x00,
+    0x06, 0xF8, 0x02, 0x10, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'N' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDD, 0x20, 0x00, 0x0D, 0xD0, 0x09, 0xFF,
+    0x80, 0x00, 0x0F, 0xF0, 0x09, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x09, 0xFB, 0xF6, 0x00, 0x0F, 0xF0,
+    0x09, 0xF6, 0xEC, 0x00, 0x0F, 0xF0, 0x09, 0xF6, 0x8F, 0x30, 0x0F, 0xF0, 0x09, 0xF6, 0x2F, 0x90,
+    0x0F, 0xF0, 0x09, 0xF6, 0x0B, 0xE1, 0x0F, 0xF0, 0x09, 0xF6, 0x04, 0xF6, 0x0F, 0xF0, 0x09, 0xF6,
+    0x00, 0xDC, 0x0F, 0xF0, 0x09, 0xF6, 0x00, 0x7F, 0x4F, 0xF0, 0x09, 0xF6, 0x00, 0x1F, 0xAF, 0xF0,
+    0x09, 0xF6, 0x00, 0x0A, 0xFF, 0xF0, 0x09, 0xF6, 0x00, 0x03, 0xFF, 0xF0, 0x09, 0xF6, 0x00, 0x00,
+    0xCF, 0xF0, 0x01, 0x21, 0x00, 0x00, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'O' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0x91, 0x00, 0x00, 0x5F,
+    0xE9, 0x8C, 0xFB, 0x00, 0x00, 0xEF, 0x40, 0x00, 0xCF, 0x50, 0x05, 0xFB, 0x00, 0x00, 0x5F, 0xB0,
+    0x08, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xF6, 0x00, 0x00, 0x0F, 0xF2, 0x0B, 0xF5, 0x00, 0x00,
+    0x0D, 0xF3, 0x0D, 0xF4, 0x00, 0x00, 0x0D, 0xF4, 0x0B, 0xF5, 0x00, 0x00, 0x0D, 0xF4, 0x0B, 0xF6,
+    0x00, 0x00, 0x0F, 0xF2, 0x09, 0xF7, 0x00, 0x00, 0x1F, 0xF0, 0x06, 0xFA, 0x00, 0x00, 0x4F, 0xC0,
+    0x02, 0xFF, 0x20, 0x00, 0xAF, 0x70, 0x00, 0x9F, 0xD5, 0x49, 0xFE, 0x10, 0x00, 0x09, 0xFF, 0xFF,
+    0xD3, 0x00, 0x00, 0x00, 0x26, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'P' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xDC, 0x93, 0x00, 0x00, 0xFF,
+    0xBB, 0xBE, 0xFF, 0x60, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xF1, 0x00, 0xFF, 0x00, 0x00, 0x0C, 0xF6,
+    0x00, 0xFF, 0x00, 0x00, 0x09, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0xFF, 0x00, 0x00,
+    0x5F, 0xF3, 0x00, 0xFF, 0x99, 0x9B, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0xFF,
+    0x22, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0x91, 0x00, 0x00, 0x5F,
+    0xE9, 0x8C, 0xFB, 0x00, 0x00, 0xEF, 0x40, 0x00, 0xCF, 0x50, 0x05, 0xFB, 0x00, 0x00, 0x5F, 0xB0,
+    0x08, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xF6, 0x00, 0x00, 0x0F, 0xF2, 0x0B, 0xF5, 0x00, 0x00,
+    0x0D, 0xF3, 0x0D, 0xF4, 0x00, 0x00, 0x0D, 0xF4, 0x0B, 0xF5, 0x00, 0x00, 0x0D, 0xF4, 0x0B, 0xF6,
+    0x00, 0x00, 0x0F, 0xF2, 0x09, 0xF7, 0x00, 0x00, 0x1F, 0xF0, 0x06, 0xFA, 0x00, 0x00, 0x4F, 0xC0,
+    0x01, 0xFF, 0x20, 0x00, 0xAF, 0x70, 0x00, 0x8F, 0xD5, 0x49, 0xFE, 0x10, 0x00, 0x09, 0xFF, 0xFF,
+    0xD3, 0x00, 0x00, 0x00, 0x26, 0x7F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'R' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDD, 0xDD, 0xDA, 0x50, 0x00, 0x08, 0xFD,
+    0xBB, 0xDF, 0xFA, 0x00, 0x08, 0xF8, 0x00, 0x04, 0xEF, 0x50, 0x08, 0xF8, 0x00, 0x00, 0x8F, 0xA0,
+    0x08, 0xF8, 0x00, 0x00, 0x6F, 0xB0, 0x08, 0xF8, 0x00, 0x00, 0x8F, 0x90, 0x08, 0xF8, 0x00, 0x04,
+    0xEF, 0x30, 0x08, 0xFE, 0xDD, 0xEF, 0xC4, 0x00, 0x08, 0xFD, 0xBB, 0xEF, 0x90, 0x00, 0x08, 0xF8,
+    0x00, 0x0B, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x01, 0xEF, 0x20, 0x08, 0xF8, 0x00, 0x00, 0x8F, 0x90,
+    0x08, 0xF8, 0x00, 0x00, 0x1E, 0xF2, 0x08, 0xF8, 0x00, 0x00, 0x08, 0xF9, 0x08, 0xF8, 0x00, 0x00,
+    0x01, 0xFF, 0x01, 0x21, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'S' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xFF, 0xE9, 0x10, 0x00, 0xAF,
+    0xE9, 0x89, 0xDF, 0x40, 0x04, 0xFC, 0x10, 0x00, 0x05, 0x20, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFB, 0x84,
+    0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x15, 0x8C, 0xFF, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF0,
+    0x03, 0x20, 0x00, 0x00, 0x4F, 0xD0, 0x06, 0xFA, 0x64, 0x48, 0xEF, 0x60, 0x04, 0xDF, 0xFF, 0xFF,
+    0xE7, 0x00, 0x00, 0x02, 0x56, 0x64, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'T' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x7D, 0xDD,
+    0xDF, 0xFE, 0xDD, 0xDD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'U' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD7, 0x00, 0x00, 0x2D, 0xB0, 0x08, 0xF8,
+    0x00, 0x00, 0x2F, 0xD0, 0x08, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x08, 0xF8, 0x00, 0x00, 0x2F, 0xD0,
+    0x08, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x08, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x08, 0xF8, 0x00, 0x00,
+    0x2F, 0xD0, 0x08, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x08, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x08, 0xF8,
+    0x00, 0x00, 0x2F, 0xD0, 0x08, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x06, 0xF8, 0x00, 0x00, 0x2F, 0xD0,
+    0x04, 0xFC, 0x00, 0x00, 0x6F, 0xA0, 0x00, 0xCF, 0xA4, 0x47, 0xEF, 0x40, 0x00, 0x1C, 0xFF, 0xFF,
+    0xE6, 0x00, 0x00, 0x00, 0x36, 0x65, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'V' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xB0, 0x00, 0x00, 0x05, 0xD9, 0x1F, 0xF1,
+    0x00, 0x00, 0x09, 0xF6, 0x0B, 0xF5, 0x00, 0x00, 0x0E, 0xF2, 0x06, 0xF9, 0x00, 0x00, 0x2F, 0xD0,
+    0x02, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xDF, 0x10, 0x00, 0xAF, 0x40, 0x00, 0x8F, 0x60, 0x00,
+    0xEE, 0x00, 0x00, 0x4F, 0x90, 0x03, 0xFA, 0x00, 0x00, 0x0E, 0xE0, 0x08, 0xF6, 0x00, 0x00, 0x0A,
+    0xF2, 0x0B, 0xF1, 0x00, 0x00, 0x06, 0xF6, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFA, 0x4F, 0x80, 0x00,
+    0x00, 0x00, 0xCE, 0x8F, 0x30, 0x00, 0x00, 0x00, 0x8F, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'W' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xCF, 0x20,
+    0x00, 0x00, 0x00, 0xBF, 0xAF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0x7F, 0x60, 0x00, 0x00, 0x00, 0xFE,
+    0x5F, 0x80, 0x0B, 0xB4, 0x01, 0xFB, 0x3F, 0x90, 0x2F, 0xF8, 0x03, 0xF9, 0x1F, 0xB0, 0x5F, 0xDB,
+    0x05, 0xF7, 0x0E, 0xD0, 0x8E, 0x8E, 0x07, 0xF5, 0x0B, 0xF0, 0xBA, 0x4F, 0x38, 0xF2, 0x09, 0xF2,
+    0xF7, 0x1F, 0x6A, 0xF0, 0x07, 0xF6, 0xF3, 0x0C, 0x9C, 0xD0, 0x04, 0xFB, 0xF0, 0x09, 0xCE, 0xB0,
+    0x02, 0xFF, 0xB0, 0x05, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x60, 0x00, 0xDF, 0x50, 0x00,
+    0xEF, 0x40, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'X' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD4, 0x00, 0x00, 0x07, 0xD8, 0x04, 0xFD,
+    0x00, 0x00, 0x2F, 0xE1, 0x00, 0xAF, 0x70, 0x00, 0xBF, 0x60, 0x00, 0x2E, 0xE1, 0x04, 0xFB, 0x00,
+    0x00, 0x07, 0xF9, 0x0D, 0xF2, 0x00, 0x00, 0x00, 0xCF, 0xAF, 0x70, 0x00, 0x00, 0x00, 0x3F, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x1E, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xEF, 0x30, 0x00, 0x00, 0x04,
+    0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0D, 0xF3, 0x09, 0xF6, 0x00, 0x00, 0x8F, 0x90, 0x01, 0xEE, 0x10,
+    0x03, 0xFE, 0x10, 0x00, 0x7F, 0x90, 0x0C, 0xF6, 0x00, 0x00, 0x0D, 0xF4, 0x6F, 0xB0, 0x00, 0x00,
+    0x05, 0xFC, 0x12, 0x10, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Y' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xA0, 0x00, 0x00, 0x05, 0xDA, 0x0C, 0xF5,
+    0x00, 0x00, 0x0D, 0xF4, 0x04, 0xFD, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0xAF, 0x60, 0x01, 0xEE, 0x20,
+    0x00, 0x2F, 0xE1, 0x08, 0xF7, 0x00, 0x00, 0x08, 0xF8, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xDF, 0xBF,
+    0x50, 0x00, 0x00, 0x00, 0x5F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDD, 0xDD, 0xDD, 0xDD, 0xD7, 0x03, 0xDD,
+    0xDD, 0xDD, 0xDF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50,
+    0x00, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0x50, 0x00, 0x00, 0x00, 0x07, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE1, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0x50, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xE1, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x04, 0xFE, 0x99, 0x99, 0x99, 0x97, 0x06, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFB, 0x01, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '[' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x88, 0x70, 0x00, 0x00, 0x00, 0x6F, 0xED, 0xB0, 0x00, 0x00, 0x00,
+    0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC9, 0x80, 0x00, 0x00, 0x00,
+    0x5D, 0xDD, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '0x5C' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ']' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x88, 0x86, 0x00, 0x00, 0x00, 0x07, 0xDD, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x05, 0x9A, 0xFB, 0x00, 0x00, 0x00, 0x07,
+    0xDD, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '^' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xD6, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xEF, 0x40, 0x00, 0x00, 0x0A, 0xF8, 0x2E, 0xE2, 0x00, 0x00, 0x7F, 0x80, 0x04, 0xEC, 0x10,
+    0x04, 0xFA, 0x00, 0x00, 0x4F, 0xB0, 0x1B, 0x90, 0x00, 0x00, 0x05, 0xB5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '_' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+    /* '`' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x01, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'a' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x46, 0x64, 0x00, 0x00,
+    0x00, 0xAF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0xD9, 0x53, 0x36, 0xEF, 0x20, 0x00, 0x10, 0x00, 0x00,
+    0x6F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x90, 0x00, 0x17, 0xCE, 0xFF, 0xFF, 0x90, 0x01, 0xDF,
+    0xC8, 0x88, 0x9F, 0x90, 0x07, 0xF9, 0x00, 0x00, 0x4F, 0x90, 0x09, 0xF4, 0x00, 0x00, 0x6F, 0x90,
+    0x09, 0xF5, 0x00, 0x01, 0xDF, 0x90, 0x05, 0xFD, 0x42, 0x4C, 0xEF, 0x90, 0x00, 0x8F, 0xFF, 0xFC,
+    0x5F, 0x90, 0x00, 0x02, 0x66, 0x40, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'b' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x03, 0x65, 0x10, 0x00,
+    0x00, 0xFB, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0xFE, 0xE6, 0x26, 0xEF, 0x40, 0x00, 0xFF, 0x60, 0x00,
+    0x5F, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0xFB,
+    0x00, 0x00, 0x0B, 0xF3, 0x00, 0xFD, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0xFF, 0x00, 0x00, 0x0E, 0xF0,
+    0x00, 0xFF, 0x60, 0x00, 0x5F, 0xB0, 0x00, 0xFF, 0xE6, 0x25, 0xEF, 0x40, 0x00, 0xFB, 0x8F, 0xFF,
+    0xF6, 0x00, 0x00, 0x21, 0x03, 0x65, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'c' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x56, 0x51, 0x00,
+    0x00, 0x01, 0xAF, 0xFF, 0xFF, 0x70, 0x00, 0x0C, 0xFB, 0x42, 0x49, 0x90, 0x00, 0x7F, 0xB0, 0x00,
+    0x00, 0x10, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xB0, 0x00, 0x00, 0x10, 0x00, 0x0C, 0xFB, 0x42, 0x48, 0x90, 0x00, 0x01, 0xAF, 0xFF,
+    0xFF, 0x70, 0x00, 0x00, 0x02, 0x56, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'd' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x46, 0x50, 0x6F, 0x80,
+    0x00, 0x1C, 0xFF, 0xFD, 0x8F, 0x80, 0x00, 0xCF, 0x93, 0x4B, 0xFF, 0x80, 0x04, 0xFB, 0x00, 0x01,
+    0xEF, 0x80, 0x09, 0xF6, 0x00, 0x00, 0x9F, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0x6F, 0x80, 0x0B, 0xF4,
+    0x00, 0x00, 0x6F, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0x6F, 0x80, 0x08, 0xF6, 0x00, 0x00, 0x9F, 0x80,
+    0x04, 0xFB, 0x00, 0x01, 0xEF, 0x80, 0x00, 0xCF, 0x93, 0x3B, 0xFF, 0x80, 0x00, 0x1C, 0xFF, 0xFD,
+    0x8F, 0x80, 0x00, 0x00, 0x46, 0x50, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'e' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x65, 0x10, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x8F, 0xC5, 0x25, 0xDF, 0x40, 0x03, 0xFD, 0x10, 0x00,
+    0x2F, 0xB0, 0x08, 0xF7, 0x00, 0x00, 0x0C, 0xF1, 0x0B, 0xF9, 0x88, 0x88, 0x8C, 0xF2, 0x0B, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFC, 0x10, 0x00, 0x00, 0x10, 0x00, 0x8F, 0xC5, 0x23, 0x6B, 0xB0, 0x00, 0x08, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x15, 0x66, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'f' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x88, 0x60, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+    0x0C, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x22, 0x2F, 0xD2, 0x22, 0x10,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x44, 0x4F, 0xE4, 0x44, 0x30, 0x00, 0x00, 0x0F, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'g' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x50, 0x12, 0x10,
+    0x00, 0x1C, 0xFF, 0xFD, 0x8F, 0x80, 0x00, 0xCF, 0xA3, 0x3B, 0xFF, 0x80, 0x04, 0xFB, 0x00, 0x00,
+    0xDF, 0x80, 0x09, 0xF6, 0x00, 0x00, 0x8F, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0x6F, 0x80, 0x0B, 0xF4,
+    0x00, 0x00, 0x6F, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0x6F, 0x80, 0x08, 0xF7, 0x00, 0x00, 0x9F, 0x80,
+    0x03, 0xFD, 0x10, 0x01, 0xEF, 0x80, 0x00, 0xAF, 0xC6, 0x6D, 0xDF, 0x80, 0x00, 0x1A, 0xFF, 0xFB,
+    0x6F, 0x80, 0x00, 0x00, 0x14, 0x20, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x00, 0x56,
+    0x10, 0x06, 0xFC, 0x00, 0x00, 0x8F, 0xFE, 0xFF, 0xD2, 0x00, 0x00, 0x14, 0x78, 0x85, 0x00, 0x00,
+    /* 'h' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0x56, 0x30, 0x00,
+    0x00, 0xFD, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0xFE, 0xE6, 0x46, 0xEF, 0x20, 0x00, 0xFF, 0x50, 0x00,
+    0x8F, 0x70, 0x00, 0xFE, 0x00, 0x00, 0x5F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD,
+    0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90,
+    0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00,
+    0x4F, 0x90, 0x00, 0x22, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'i' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x21, 0x00, 0x00,
+    0x00, 0x6F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x14, 0x49, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x01, 0x44, 0x49, 0xF8, 0x44, 0x40, 0x04, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'j' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x00, 0x00,
+    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x04, 0x44, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x22,
+    0x3A, 0xF7, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x01, 0x66, 0x64, 0x00, 0x00, 0x00,
+    /* 'k' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x58, 0x20, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x40, 0x00, 0x02, 0x21,
+    0x00, 0x9F, 0x40, 0x00, 0x8F, 0xA1, 0x00, 0x9F, 0x40, 0x08, 0xFA, 0x00, 0x00, 0x9F, 0x40, 0x8F,
+    0xA0, 0x00, 0x00, 0x9F, 0x49, 0xF8, 0x00, 0x00, 0x00, 0x9F, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x9F,
+    0xF9, 0xFD, 0x10, 0x00, 0x00, 0x9F, 0x70, 0x7F, 0xB0, 0x00, 0x00, 0x9F, 0x40, 0x0B, 0xF7, 0x00,
+    0x00, 0x9F, 0x40, 0x02, 0xEF, 0x30, 0x00, 0x9F, 0x40, 0x00, 0x5F, 0xD1, 0x00, 0x9F, 0x40, 0x00,
+    0x09, 0xFA, 0x00, 0x12, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'l' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x99, 0x99, 0x40, 0x00, 0x00, 0x04, 0xBB, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF9, 0x66, 0x20, 0x00, 0x00, 0x02, 0xCF,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'm' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x54, 0x01, 0x55, 0x00,
+    0x0D, 0xCE, 0xFF, 0x8D, 0xFF, 0xB0, 0x0D, 0xF5, 0x4E, 0xF9, 0x2B, 0xF2, 0x0D, 0xE0, 0x0A, 0xF3,
+    0x06, 0xF5, 0x0D, 0xC0, 0x09, 0xF2, 0x04, 0xF6, 0x0D, 0xB0, 0x09, 0xF2, 0x04, 0xF6, 0x0D, 0xB0,
+    0x09, 0xF2, 0x04, 0xF6, 0x0D, 0xB0, 0x09, 0xF2, 0x04, 0xF6, 0x0D, 0xB0, 0x09, 0xF2, 0x04, 0xF6,
+    0x0D, 0xB0, 0x09, 0xF2, 0x04, 0xF6, 0x0D, 0xB0, 0x09, 0xF2, 0x04, 0xF6, 0x0D, 0xB0, 0x09, 0xF2,
+    0x04, 0xF6, 0x02, 0x10, 0x01, 0x20, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'n' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x56, 0x30, 0x00,
+    0x00, 0xFD, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0xFE, 0xE6, 0x46, 0xEF, 0x20, 0x00, 0xFF, 0x50, 0x00,
+    0x8F, 0x70, 0x00, 0xFE, 0x00, 0x00, 0x5F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD,
+    0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90,
+    0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00,
+    0x4F, 0x90, 0x00, 0x22, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'o' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x64, 0x00, 0x00,
+    0x00, 0x1A, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0xAF, 0xC4, 0x37, 0xFE, 0x20, 0x02, 0xFE, 0x10, 0x00,
+    0x8F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF0, 0x09, 0xF6,
+    0x00, 0x00, 0x0E, 0xF0, 0x09, 0xF6, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
+    0x02, 0xFE, 0x10, 0x00, 0x8F, 0x80, 0x00, 0xAF, 0xB4, 0x27, 0xFE, 0x20, 0x00, 0x1B, 0xFF, 0xFF,
+    0xE4, 0x00, 0x00, 0x00, 0x36, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'p' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x65, 0x10, 0x00,
+    0x02, 0xFB, 0x8F, 0xFF, 0xF6, 0x00, 0x02, 0xFF, 0xE6, 0x26, 0xEF, 0x30, 0x02, 0xFF, 0x50, 0x00,
+    0x5F, 0xA0, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x0D, 0xF2, 0x02, 0xFB,
+    0x00, 0x00, 0x0B, 0xF2, 0x02, 0xFC, 0x00, 0x00, 0x0D, 0xF2, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xE0,
+    0x02, 0xFF, 0x50, 0x00, 0x5F, 0xA0, 0x02, 0xFF, 0xE5, 0x25, 0xEF, 0x40, 0x02, 0xFB, 0x9F, 0xFF,
+    0xF6, 0x00, 0x02, 0xFB, 0x03, 0x65, 0x10, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00,
+    /* 'q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x40, 0x02, 0x10,
+    0x00, 0x1B, 0xFF, 0xFD, 0x6F, 0x90, 0x00, 0x9F, 0xB4, 0x4B, 0xFF, 0x90, 0x02, 0xFE, 0x00, 0x00,
+    0xCF, 0x90, 0x06, 0xF8, 0x00, 0x00, 0x7F, 0x90, 0x08, 0xF6, 0x00, 0x00, 0x4F, 0x90, 0x09, 0xF6,
+    0x00, 0x00, 0x4F, 0x90, 0x09, 0xF6, 0x00, 0x00, 0x4F, 0x90, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x90,
+    0x03, 0xFD, 0x00, 0x00, 0xCF, 0x90, 0x00, 0xBF, 0xA3, 0x29, 0xFF, 0x90, 0x00, 0x1C, 0xFF, 0xFE,
+    0x7F, 0x90, 0x00, 0x00, 0x47, 0x61, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50,
+    /* 'r' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x01, 0x56, 0x40,
+    0x00, 0x06, 0xF8, 0x6F, 0xFF, 0xF8, 0x00, 0x06, 0xFB, 0xF9, 0x55, 0x89, 0x00, 0x06, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 's' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x65, 0x20, 0x00,
+    0x00, 0x0A, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x7F, 0xB4, 0x23, 0x79, 0x00, 0x00, 0xBF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFA, 0x63, 0x00, 0x00, 0x00, 0x06,
+    0xDF, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x01, 0x5B, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x00, 0xC9, 0x42, 0x27, 0xFE, 0x10, 0x00, 0xBF, 0xFF, 0xFF,
+    0xD4, 0x00, 0x00, 0x02, 0x56, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 't' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x01, 0x22, 0xAF, 0x42, 0x22, 0x10,
+    0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x02, 0x44, 0xBF, 0x54, 0x44, 0x10, 0x00, 0x00, 0x9F, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xD6, 0x66, 0x20, 0x00, 0x00, 0x08, 0xEF,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x02, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'u' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x02, 0x10,
+    0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00,
+    0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD,
+    0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x4F, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x6F, 0x90,
+    0x00, 0xDF, 0x10, 0x00, 0xBF, 0x90, 0x00, 0x9F, 0xB4, 0x49, 0xDF, 0x90, 0x00, 0x2D, 0xFF, 0xFC,
+    0x5F, 0x90, 0x00, 0x00, 0x56, 0x40, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'v' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x01, 0x21,
+    0x0B, 0xF2, 0x00, 0x00, 0x0B, 0xF3, 0x06, 0xF7, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x00,
+    0x7F, 0x70, 0x00, 0xAF, 0x30, 0x00, 0xBF, 0x20, 0x00, 0x5F, 0x80, 0x02, 0xFB, 0x00, 0x00, 0x0E,
+    0xD0, 0x07, 0xF6, 0x00, 0x00, 0x0A, 0xF4, 0x0C, 0xF1, 0x00, 0x00, 0x04, 0xF8, 0x2F, 0xA0, 0x00,
+    0x00, 0x00, 0xEE, 0x8F, 0x50, 0x00, 0x00, 0x00, 0x8F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'w' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0xDE, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x9F, 0x30, 0x00, 0x00, 0x00, 0xCF, 0x6F, 0x60, 0x00, 0x00,
+    0x00, 0xFC, 0x2F, 0x90, 0x09, 0xD1, 0x03, 0xF8, 0x0E, 0xC0, 0x0E, 0xF5, 0x06, 0xF5, 0x0A, 0xF1,
+    0x4F, 0xAA, 0x0A, 0xF1, 0x07, 0xF4, 0x8B, 0x5E, 0x0D, 0xD0, 0x03, 0xF7, 0xC7, 0x1F, 0x4F, 0x90,
+    0x00, 0xEB, 0xF3, 0x0B, 0xBF, 0x60, 0x00, 0xBF, 0xD0, 0x07, 0xFF, 0x20, 0x00, 0x8F, 0x90, 0x03,
+    0xFE, 0x00, 0x00, 0x12, 0x10, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'x' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x02, 0x20,
+    0x06, 0xFA, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x9F, 0x60, 0x02, 0xEE, 0x20, 0x00, 0x1C, 0xF3, 0x0B,
+    0xF4, 0x00, 0x00, 0x03, 0xEC, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xDF, 0x30, 0x00, 0x00, 0x08, 0xF8, 0x3F, 0xD1, 0x00,
+    0x00, 0x4F, 0xC0, 0x06, 0xFA, 0x00, 0x01, 0xEE, 0x20, 0x00, 0xAF, 0x60, 0x0B, 0xF6, 0x00, 0x00,
+    0x1D, 0xF3, 0x02, 0x20, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'y' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x01, 0x21,
+    0x0B, 0xF4, 0x00, 0x00, 0x09, 0xF5, 0x04, 0xF9, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0xEF, 0x10, 0x00,
+    0x5F, 0x90, 0x00, 0x8F, 0x60, 0x00, 0xBF, 0x30, 0x00, 0x2F, 0xB0, 0x02, 0xFC, 0x00, 0x00, 0x0B,
+    0xF2, 0x07, 0xF6, 0x00, 0x00, 0x05, 0xF8, 0x0C, 0xF1, 0x00, 0x00, 0x00, 0xED, 0x3F, 0xA0, 0x00,
+    0x00, 0x00, 0x8F, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x23,
+    0xCF, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x66, 0x30, 0x00, 0x00, 0x00,
+    /* 'z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x22, 0x10,
+    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x46, 0x66, 0x66, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x06,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xD1, 0x00, 0x00, 0x00, 0x02, 0xEE, 0x20, 0x00, 0x00, 0x00,
+    0x0C, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x06, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xD1, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x86, 0x66, 0x66, 0x30, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '{' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x88, 0x20, 0x00, 0x00, 0x02, 0xEF, 0xFD, 0x30, 0x00, 0x00,
+    0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x8C, 0xFD, 0x50, 0x00, 0x00, 0x00, 0x8B,
+    0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xDF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x78, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '|' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00,
+    /* '}' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x68, 0x62, 0x00, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xDB, 0x30, 0x00, 0x00,
+    0x01, 0xBF, 0xCB, 0x30, 0x00, 0x00, 0x09, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x68, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '~' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x7A, 0xA7, 0x10, 0x00, 0x14, 0x1E, 0xFF, 0xFF, 0xFA, 0x89, 0xE8, 0x2B, 0x30,
+    0x04, 0xAF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const font_t font_mono24_aa = {
+    .width = 12U,
+    .height = 24U,
+    .bpp = 4U,
+    .first = 0x20U,
+    .last = 0x7EU,
+    .glyph_bytes = 144U,
+    .bitmap = font_mono24_aa_bitmap,
+};
@@ -0,0 +1,308 @@
+#include "gfx/aa.h"
+
+#include <stdbool.h>
+
+#include "gfx/blend.h"
+
+/* ----------------------------- 覆盖率段（主方向连续） ----------------------------- */
+
+typedef struct
+{
+    int32_t major;                     /* 首像素的主方向坐标 */
+    int32_t minor;                     /* 所在行（x 主方向）或列（y 主方向） */
+    uint16_t n;
+    uint8_t alpha[GFX_AA_SPAN_MAX];
+} gfx_aa_span_t;
+
+typedef struct
+{
+    bool steep;                        /* true: y 为主方向，段为竖直列 */
+    lcd_color565_t color;
+    const lcd_color565_t *bg;          /* 0: 读回 GRAM */
+} gfx_aa_ctx_t;
+
+static gfx_aa_span_t gfx_aa_spans[2];
+static lcd_color565_t gfx_aa_pixels[GFX_AA_SPAN_MAX];
+
+static void gfx_aa_flush(const gfx_aa_ctx_t *ctx, gfx_aa_span_t *s)
+{
+    const int32_t minor_limit = ctx->steep ? (int32_t)lcd_width() : (int32_t)lcd_height();
+    uint16_t n = s->n;
+
+    s->n = 0U;
+
+    /* 尾部 alpha=0 的像素不输出（已知背景模式下会覆盖原有内容） */
+    while ((n != 0U) && (s->alpha[n - 1U] == 0U))
+    {
+        n--;
+    }
+    if ((n == 0U) || (s->minor < 0) || (s->minor >= minor_limit))
+    {
+        return;
+    }
+
+    /* 主方向已在 gfx_aa_segment() 中裁剪到屏幕内 */
+    const uint16_t x = (uint16_t)(ctx->steep ? s->minor : s->major);
+    const uint16_t y = (uint16_t)(ctx->steep ? s->major : s->minor);
+    const uint16_t w = ctx->steep ? 1U : n;
+    const uint16_t h = ctx->steep ? n : 1U;
+
+    if (ctx->bg != 0)
+    {
+        const lcd_color565_t bg = *ctx->bg;
+        for (uint16_t i = 0U; i < n; i++)
+        {
+            gfx_aa_pixels[i] = gfx_blend565(ctx->color, bg, s->alpha[i]);
+        }
+    }
+    else
+    {
+        if (!lcd_read_rect(x, y, w, h, gfx_aa_pixels))
+        {
+            return;
+        }
+        for (uint16_t i = 0U; i < n; i++)
+        {
+            gfx_aa_pixels[i] = gfx_blend565(ctx->color, gfx_aa_pixels[i], s->alpha[i]);
+        }
+    }
+
+    lcd_blit(x, y, w, h, gfx_aa_pixels);
+}
+
+static void gfx_aa_put(const gfx_aa_ctx_t *ctx, gfx_aa_span_t *s, int32_t major, uint8_t alpha)
+{
+    if (s->n == 0U)
+    {
+        /* 段首不以 alpha=0 开头 */
+        if (alpha == 0U)
+        {
+            return;
+        }
+        s->major = major;
+    }
+    else if (s->n >= GFX_AA_SPAN_MAX)
+    {
+        gfx_aa_flush(ctx, s);
+        s->major = major;
+    }
+
+    s->alpha[s->n] = alpha;
+    s->n++;
+}
+
+/* ----------------------------- Wu 直线 ----------------------------- */
+
+/*
+ * (a, b) 为 (主方向, 次方向) 坐标；skip_first 为 true 时不画起点像素（折线拼接处避免重复混合）。
+ */
+static void gfx_aa_segment(const gfx_aa_ctx_t *ctx, int32_t a0, int32_t b0, int32_t a1, int32_t b1,
+                           bool skip_first)
+{
+    bool skip_lo = skip_first;
+    bool skip_hi = false;
+
+    if (a0 > a1)
+    {
+        int32_t t = a0;
+        a0 = a1;
+        a1 = t;
+        t = b0;
+        b0 = b1;
+        b1 = t;
+        skip_lo = false;
+        skip_hi = skip_first;
+    }
+
+    const int32_t da = a1 - a0;
+    /* 16.16 定点斜率，|grad| <= 1.0 */
+    const int32_t grad = (da == 0) ? 0 : (int32_t)((((int64_t)(b1 - b0)) << 16) / da);
+    const int32_t major_limit = ctx->steep ? (int32_t)lcd_height() : (int32_t)lcd_width();
+
+    /* 主方向先裁剪到屏幕内，次方向在 flush 时整段裁剪 */
+    int32_t i0 = (a0 < 0) ? -a0 : 0;
+    int32_t i1 = ((a1 >= major_limit) ? (major_limit - 1) : a1) - a0;
+    if (skip_lo && (i0 == 0))
+    {
+        i0 = 1;
+    }
+    if (skip_hi && (i1 == da))
+    {
+        i1 = da - 1;
+    }
+    if (i0 > i1)
+    {
+        return;
+    }
+
+    gfx_aa_span_t *cur = &gfx_aa_spans[0];
+    gfx_aa_span_t *nxt = &gfx_aa_spans[1];
+    int32_t pos = (int32_t)(((int64_t)b0 << 16) + ((int64_t)grad * i0));
+
+    cur->n = 0U;
+    nxt->n = 0U;
+    cur->minor = pos >> 16;
+    nxt->minor = cur->minor + 1;
+
+    for (int32_t i = i0; i <= i1; i++)
+    {
+        const int32_t ip = pos >> 16;
+        const uint8_t f = (uint8_t)(pos >> 8);
+
+        /* |grad| <= 1，整数部分每步最多变化 1：结束的那一行（列）输出，另一段顺延 */
+        if (ip > cur->minor)
+        {
+            gfx_aa_flush(ctx, cur);
+            gfx_aa_span_t *t = cur;
+            cur = nxt;
+            nxt = t;
+            nxt->minor = ip + 1;
+        }
+        else if (ip < cur->minor)
+        {
+            gfx_aa_flush(ctx, nxt);
+            gfx_aa_span_t *t = nxt;
+            nxt = cur;
+            cur = t;
+            cur->minor = ip;
+        }
+
+        gfx_aa_put(ctx, cur, a0 + i, (uint8_t)(255U - f));
+        gfx_aa_put(ctx, nxt, a0 + i, f);
+        pos += grad;
+    }
+
+    gfx_aa_flush(ctx, cur);
+    gfx_aa_flush(ctx, nxt);
+}
+
+static void gfx_aa_line_ex(int32_t x0, int32_t y0, int32_t x1, int32_t y1, bool skip_first,
+                           lcd_color565_t color, const lcd_color565_t *bg)
+{
+    const int32_t dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+    const int32_t dy = (y1 > y0) ? (y1 - y0) : (y0 - y1);
+    gfx_aa_ctx_t ctx;
+
+    ctx.steep = (dy > dx);
+    ctx.color = color;
+    ctx.bg = bg;
+
+    if (ctx.steep)
+    {
+        gfx_aa_segment(&ctx, y0, x0, y1, x1, skip_first);
+    }
+    else
+    {
+        gfx_aa_segment(&ctx, x0, y0, x1, y1, skip_first);
+    }
+}
+
+void gfx_aa_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                 lcd_color565_t color, const lcd_color565_t *bg)
+{
+    gfx_aa_line_ex(x0, y0, x1, y1, false, color, bg);
+}
+
+/* ----------------------------- Bézier：整数展开为折线 ----------------------------- */
+
+/* 四舍五入的整数除法（den > 0） */
+static int32_t gfx_aa_div_round(int64_t num, int64_t den)
+{
+    return (int32_t)((num >= 0) ? ((num + (den / 2)) / den) : -((-num + (den / 2)) / den));
+}
+
+static int32_t gfx_aa_chebyshev(int32_t ax, int32_t ay, int32_t bx, int32_t by)
+{
+    const int32_t dx = (ax > bx) ? (ax - bx) : (bx - ax);
+    const int32_t dy = (ay > by) ? (ay - by) : (by - ay);
+    return (dx > dy) ? dx : dy;
+}
+
+/* 控制多边形长度（切比雪夫距离之和）约每 8 像素一段，限制在 [1, GFX_AA_CURVE_MAX_SEGS] */
+static int32_t gfx_aa_curve_segs(int32_t poly_len)
+{
+    int32_t n = (poly_len + 7) / 8;
+    if (n < 1)
+    {
+        n = 1;
+    }
+    if (n > (int32_t)GFX_AA_CURVE_MAX_SEGS)
+    {
+        n = (int32_t)GFX_AA_CURVE_MAX_SEGS;
+    }
+    return n;
+}
+
+/* 依次连接 px/py[0..n]；拼接点只画一次，重合点跳过 */
+static void gfx_aa_polyline(const int32_t *px, const int32_t *py, int32_t n,
+                            lcd_color565_t color, const lcd_color565_t *bg)
+{
+    int32_t lx = px[0];
+    int32_t ly = py[0];
+    bool first = true;
+
+    for (int32_t i = 1; i <= n; i++)
+    {
+        if ((px[i] == lx) && (py[i] == ly))
+        {
+            continue;
+        }
+        gfx_aa_line_ex(lx, ly, px[i], py[i], !first, color, bg);
+        lx = px[i];
+        ly = py[i];
+        first = false;
+    }
+
+    if (first)
+    {
+        /* 退化为一个点 */
+        gfx_aa_line_ex(lx, ly, lx, ly, false, color, bg);
+    }
+}
+
+void gfx_aa_quad_bezier(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                        lcd_color565_t color, const lcd_color565_t *bg)
+{
+    int32_t px[GFX_AA_CURVE_MAX_SEGS + 1U];
+    int32_t py[GFX_AA_CURVE_MAX_SEGS + 1U];
+    const int32_t n = gfx_aa_curve_segs(gfx_aa_chebyshev(x0, y0, x1, y1) + gfx_aa_chebyshev(x1, y1, x2, y2));
+    const int64_t den = (int64_t)n * n;
+
+    /* B(i/n) = ((n-i)^2 P0 + 2 i (n-i) P1 + i^2 P2) / n^2 */
+    for (int32_t i = 0; i <= n; i++)
+    {
+        const int64_t u = n - i;
+        const int64_t k0 = u * u;
+        const int64_t k1 = 2 * (int64_t)i * u;
+        const int64_t k2 = (int64_t)i * i;
+        px[i] = gfx_aa_div_round((k0 * x0) + (k1 * x1) + (k2 * x2), den);
+        py[i] = gfx_aa_div_round((k0 * y0) + (k1 * y1) + (k2 * y2), den);
+    }
+
+    gfx_aa_polyline(px, py, n, color, bg);
+}
+
+void gfx_aa_cubic_bezier(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                         int16_t x2, int16_t y2, int16_t x3, int16_t y3,
+                         lcd_color565_t color, const lcd_color565_t *bg)
+{
+    int32_t px[GFX_AA_CURVE_MAX_SEGS + 1U];
+    int32_t py[GFX_AA_CURVE_MAX_SEGS + 1U];
+    const int32_t n = gfx_aa_curve_segs(gfx_aa_chebyshev(x0, y0, x1, y1) + gfx_aa_chebyshev(x1, y1, x2, y2) +
+                                        gfx_aa_chebyshev(x2, y2, x3, y3));
+    const int64_t den = (int64_t)n * n * n;
+
+    /* B(i/n) = ((n-i)^3 P0 + 3 i (n-i)^2 P1 + 3 i^2 (n-i) P2 + i^3 P3) / n^3 */
+    for (int32_t i = 0; i <= n; i++)
+    {
+        const int64_t u = n - i;
+        const int64_t k0 = u * u * u;
+        const int64_t k1 = 3 * (int64_t)i * u * u;
+        const int64_t k2 = 3 * (int64_t)i * i * u;
+        const int64_t k3 = (int64_t)i * i * i;
+        px[i] = gfx_aa_div_round((k0 * x0) + (k1 * x1) + (k2 * x2) + (k3 * x3), den);
+        py[i] = gfx_aa_div_round((k0 * y0) + (k1 * y1) + (k2 * y2) + (k3 * y3), den);
+    }
+
+    gfx_aa_polyline(px, py, n, color, bg);
+}
@@ -0,0 +1,53 @@
+#ifndef GFX_AA_H
+#define GFX_AA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "lcd/lcd.h"
+
+/**
+ * @brief 抗锯齿直线（Wu 算法）与二次/三次 Bézier 曲线。
+ *
+ * 每个主方向步进产生上下（或左右）两个像素，覆盖率 0..255 作为 alpha 与背景混合（gfx_blend565()）。
+ * 背景来源：
+ * - bg != 0：按已知纯色背景 *bg 混合（最快，适合纯色表盘底）
+ * - bg == 0：先用 lcd_read_rect() 读回 GRAM 再混合（可叠加在任意内容上，但读 GRAM 明显慢于写）
+ *
+ * 输出同 gfx.h：同一行（x 主方向）或同一列（y 主方向）上连续的像素合并为一段，一次窗口 + lcd_blit()。
+ * 端点为整数像素坐标，可部分位于屏幕外。
+ *
+ * 详见: src/gfx/gfx.md
+ */
+
+/** 单段像素缓冲长度（>= LCD_PANEL_LONG_SIDE，任意方向下都能放下一整行/列）。 */
+#ifndef GFX_AA_SPAN_MAX
+#define GFX_AA_SPAN_MAX (LCD_PANEL_LONG_SIDE)
+#endif
+
+/** 曲线最多拆分的直线段数。 */
+#ifndef GFX_AA_CURVE_MAX_SEGS
+#define GFX_AA_CURVE_MAX_SEGS (32U)
+#endif
+
+/** 抗锯齿直线。 */
+void gfx_aa_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                 lcd_color565_t color, const lcd_color565_t *bg);
+
+/** 二次 Bézier：起点 (x0,y0)，控制点 (x1,y1)，终点 (x2,y2)。 */
+void gfx_aa_quad_bezier(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                        lcd_color565_t color, const lcd_color565_t *bg);
+
+/** 三次 Bézier：起点 (x0,y0)，控制点 (x1,y1)/(x2,y2)，终点 (x3,y3)。 */
+void gfx_aa_cubic_bezier(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                         int16_t x2, int16_t y2, int16_t x3, int16_t y3,
+                         lcd_color565_t color, const lcd_color565_t *bg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GFX_AA_H */
@@ -0,0 +1,234 @@
+#include "gfx/blend.h"
+
+/* dst 对齐后按字访问；src 对齐方式可能与 dst 不同，用 2 字节对齐类型让编译器生成非对齐 LDR（M4 硬件支持） */
+typedef uint32_t __attribute__((may_alias)) gfx_u32_t;
+typedef uint32_t __attribute__((may_alias, aligned(2))) gfx_u32u_t;
+
+#define GFX_RB_LANES (0x001F001FU)
+#define GFX_G_LANES  (0x003F003FU)
+#define GFX_ROUND2   (0x00800080U)
+
+/* ----------------------------- 参考实现（逐像素、逐分量） ----------------------------- */
+
+static uint32_t gfx_ref_mix(uint32_t f, uint32_t b, uint32_t a)
+{
+    return ((f * a) + (b * (256U - a)) + 128U) >> 8;
+}
+
+static lcd_color565_t gfx_ref_blend(lcd_color565_t fg, lcd_color565_t bg, uint8_t alpha)
+{
+    const uint32_t a = gfx_alpha_weight(alpha);
+    const uint32_t r = gfx_ref_mix(((uint32_t)fg >> 11) & 0x1FU, ((uint32_t)bg >> 11) & 0x1FU, a);
+    const uint32_t g = gfx_ref_mix(((uint32_t)fg >> 5) & 0x3FU, ((uint32_t)bg >> 5) & 0x3FU, a);
+    const uint32_t b = gfx_ref_mix((uint32_t)fg & 0x1FU, (uint32_t)bg & 0x1FU, a);
+    return (lcd_color565_t)((r << 11) | (g << 5) | b);
+}
+
+static lcd_color565_t gfx_ref_add(lcd_color565_t s, lcd_color565_t d)
+{
+    uint32_t r = (((uint32_t)s >> 11) & 0x1FU) + (((uint32_t)d >> 11) & 0x1FU);
+    uint32_t g = (((uint32_t)s >> 5) & 0x3FU) + (((uint32_t)d >> 5) & 0x3FU);
+    uint32_t b = ((uint32_t)s & 0x1FU) + ((uint32_t)d & 0x1FU);
+    r = (r > 0x1FU) ? 0x1FU : r;
+    g = (g > 0x3FU) ? 0x3FU : g;
+    b = (b > 0x1FU) ? 0x1FU : b;
+    return (lcd_color565_t)((r << 11) | (g << 5) | b);
+}
+
+void gfx_blend_span_over_ref(lcd_color565_t *dst, const lcd_color565_t *src, const uint8_t *alpha, uint32_t n)
+{
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        dst[i] = gfx_ref_blend(src[i], dst[i], alpha[i]);
+    }
+}
+
+void gfx_blend_span_const_ref(lcd_color565_t *dst, const lcd_color565_t *src, uint8_t alpha, uint32_t n)
+{
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        dst[i] = gfx_ref_blend(src[i], dst[i], alpha);
+    }
+}
+
+void gfx_blend_span_fade_ref(lcd_color565_t *dst, lcd_color565_t color, uint8_t alpha, uint32_t n)
+{
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        dst[i] = gfx_ref_blend(color, dst[i], alpha);
+    }
+}
+
+void gfx_blend_span_add_ref(lcd_color565_t *dst, const lcd_color565_t *src, uint32_t n)
+{
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        dst[i] = gfx_ref_add(src[i], dst[i]);
+    }
+}
+
+/* ----------------------------- 字内核（2 像素 / 32-bit） ----------------------------- */
+
+/*
+ * 常数 alpha：同一分量的两个像素各占一个 16-bit 通道，一条 MUL/MLA 同时完成两个通道的乘法。
+ * 每通道最大 63*256 + 128 < 65536，通道之间不会进位；>>8 后掩码去掉高通道移入的低位。
+ */
+static inline uint32_t gfx_blend_pair(uint32_t s, uint32_t d, uint32_t a, uint32_t na)
+{
+    const uint32_t r = ((((s >> 11) & GFX_RB_LANES) * a) + (((d >> 11) & GFX_RB_LANES) * na) + GFX_ROUND2) >> 8;
+    const uint32_t g = ((((s >> 5) & GFX_G_LANES) * a) + (((d >> 5) & GFX_G_LANES) * na) + GFX_ROUND2) >> 8;
+    const uint32_t b = (((s & GFX_RB_LANES) * a) + ((d & GFX_RB_LANES) * na) + GFX_ROUND2) >> 8;
+    return ((r & GFX_RB_LANES) << 11) | ((g & GFX_G_LANES) << 5) | (b & GFX_RB_LANES);
+}
+
+void gfx_blend_span_over(lcd_color565_t *dst, const lcd_color565_t *src, const uint8_t *alpha, uint32_t n)
+{
+    if ((((uintptr_t)dst & 2U) != 0U) && (n != 0U))
+    {
+        *dst = gfx_blend565(*src++, *dst, *alpha++);
+        dst++;
+        n--;
+    }
+
+    gfx_u32_t *d32 = (gfx_u32_t *)(void *)dst;
+    const gfx_u32u_t *s32 = (const gfx_u32u_t *)(const void *)src;
+
+    while (n >= 2U)
+    {
+        const uint32_t a0 = alpha[0];
+        const uint32_t a1 = alpha[1];
+
+        /* 精灵图大部分像素全透明或全不透明：整字跳过 / 整字拷贝 */
+        if ((a0 & a1) == 0xFFU)
+        {
+            *d32 = *s32;
+        }
+        else if ((a0 | a1) != 0U)
+        {
+            const uint32_t s = *s32;
+            const uint32_t d = *d32;
+            /* (src0, dst0) / (src1, dst1) 各拼成一个字，每个分量一条 __SMLAD */
+            const uint32_t lo = gfx_blend565_packed((s & 0x0000FFFFU) | (d << 16), (uint8_t)a0);
+            const uint32_t hi = gfx_blend565_packed((s >> 16) | (d & 0xFFFF0000U), (uint8_t)a1);
+            *d32 = lo | (hi << 16);
+        }
+
+        d32++;
+        s32++;
+        alpha += 2;
+        n -= 2U;
+    }
+
+    if (n != 0U)
+    {
+        dst = (lcd_color565_t *)(void *)d32;
+        src = (const lcd_color565_t *)(const void *)s32;
+        *dst = gfx_blend565(*src, *dst, *alpha);
+    }
+}
+
+void gfx_blend_span_const(lcd_color565_t *dst, const lcd_color565_t *src, uint8_t alpha, uint32_t n)
+{
+    const uint32_t a = gfx_alpha_weight(alpha);
+    const uint32_t na = 256U - a;
+
+    if ((((uintptr_t)dst & 2U) != 0U) && (n != 0U))
+    {
+        *dst = (lcd_color565_t)gfx_blend_pair(*src++, *dst, a, na);
+        dst++;
+        n--;
+    }
+
+    gfx_u32_t *d32 = (gfx_u32_t *)(void *)dst;
+    const gfx_u32u_t *s32 = (const gfx_u32u_t *)(const void *)src;
+
+    while (n >= 2U)
+    {
+        *d32 = gfx_blend_pair(*s32, *d32, a, na);
+        d32++;
+        s32++;
+        n -= 2U;
+    }
+
+    if (n != 0U)
+    {
+        dst = (lcd_color565_t *)(void *)d32;
+        src = (const lcd_color565_t *)(const void *)s32;
+        *dst = (lcd_color565_t)gfx_blend_pair(*src, *dst, a, na);
+    }
+}
+
+void gfx_blend_span_fade(lcd_color565_t *dst, lcd_color565_t color, uint8_t alpha, uint32_t n)
+{
+    const uint32_t a = gfx_alpha_weight(alpha);
+    const uint32_t na = 256U - a;
+    const uint32_t c = (uint32_t)color | ((uint32_t)color << 16);
+    /* 颜色项与舍入常数在循环外算好，每字只剩 dst 一侧的 3 次乘加 */
+    const uint32_t kr = (((c >> 11) & GFX_RB_LANES) * a) + GFX_ROUND2;
+    const uint32_t kg = (((c >> 5) & GFX_G_LANES) * a) + GFX_ROUND2;
+    const uint32_t kb = ((c & GFX_RB_LANES) * a) + GFX_ROUND2;
+
+    if ((((uintptr_t)dst & 2U) != 0U) && (n != 0U))
+    {
+        *dst = (lcd_color565_t)gfx_blend_pair(c, *dst, a, na);
+        dst++;
+        n--;
+    }
+
+    gfx_u32_t *d32 = (gfx_u32_t *)(void *)dst;
+
+    while (n >= 2U)
+    {
+        const uint32_t d = *d32;
+        const uint32_t r = (kr + (((d >> 11) & GFX_RB_LANES) * na)) >> 8;
+        const uint32_t g = (kg + (((d >> 5) & GFX_G_LANES) * na)) >> 8;
+        const uint32_t b = (kb + ((d & GFX_RB_LANES) * na)) >> 8;
+        *d32++ = ((r & GFX_RB_LANES) << 11) | ((g & GFX_G_LANES) << 5) | (b & GFX_RB_LANES);
+        n -= 2U;
+    }
+
+    if (n != 0U)
+    {
+        dst = (lcd_color565_t *)(void *)d32;
+        *dst = (lcd_color565_t)gfx_blend_pair(c, *dst, a, na);
+    }
+}
+
+void gfx_blend_span_add(lcd_color565_t *dst, const lcd_color565_t *src, uint32_t n)
+{
+#if GFX_BLEND_DSP
+    if ((((uintptr_t)dst & 2U) != 0U) && (n != 0U))
+    {
+        *dst = gfx_ref_add(*src++, *dst);
+        dst++;
+        n--;
+    }
+
+    gfx_u32_t *d32 = (gfx_u32_t *)(void *)dst;
+    const gfx_u32u_t *s32 = (const gfx_u32u_t *)(const void *)src;
+
+    /*
+     * 每个分量移到 16-bit 通道的最高位，低位清零后用 __UQADD16 饱和相加：
+     * 溢出时通道饱和为 0xFFFF，掩码后恰好是该分量最大值。
+     */
+    while (n >= 2U)
+    {
+        const uint32_t s = *s32++;
+        const uint32_t d = *d32;
+        const uint32_t r = __UQADD16(s & 0xF800F800U, d & 0xF800F800U) & 0xF800F800U;
+        const uint32_t g = __UQADD16((s << 5) & 0xFC00FC00U, (d << 5) & 0xFC00FC00U) & 0xFC00FC00U;
+        const uint32_t b = __UQADD16((s << 11) & 0xF800F800U, (d << 11) & 0xF800F800U) & 0xF800F800U;
+        *d32++ = r | (g >> 5) | (b >> 11);
+        n -= 2U;
+    }
+
+    if (n != 0U)
+    {
+        dst = (lcd_color565_t *)(void *)d32;
+        src = (const lcd_color565_t *)(const void *)s32;
+        *dst = gfx_ref_add(*src, *dst);
+    }
+#else
+    gfx_blend_span_add_ref(dst, src, n);
+#endif
+}
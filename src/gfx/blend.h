@@ -0,0 +1,102 @@
+#ifndef GFX_BLEND_H
+#define GFX_BLEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "stm32f4xx.h"
+
+#include "lcd/lcd.h"
+
+/**
+ * @brief RGB565 混合：单像素 gfx_blend565() 与成段合成内核。
+ *
+ * 统一的分量公式（alpha 0..255 先映射到 a = 0..256）：
+ *   out = (fg * a + bg * (256 - a) + 128) >> 8
+ *
+ * Cortex-M4 上用 DSP 指令 __SMLAD 一次完成 fg*a + bg*(256-a)：
+ * 把 fg/bg 拼成一个 32-bit 字（低半字 fg、高半字 bg），一次移位+掩码就同时取出两者的同一分量，
+ * 再与 (a, 256-a) 做双 16-bit 乘加。无 DSP 扩展的编译器（如主机）退回等价的标量实现。
+ *
+ * 详见: src/gfx/gfx.md
+ */
+
+/* 可在编译时指定；主机构建定义为 1，由 tools/lcdsim/host/stm32f4xx.h 的 C 仿真指令验证 DSP 路径 */
+#ifndef GFX_BLEND_DSP
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define GFX_BLEND_DSP (1)
+#else
+#define GFX_BLEND_DSP (0)
+#endif
+#endif
+
+/** @brief alpha 0..255 -> 权重 0..256（255 映射为 256，保证全不透明时输出等于前景）。 */
+static inline uint32_t gfx_alpha_weight(uint8_t alpha)
+{
+    return (uint32_t)alpha + ((uint32_t)alpha >> 7);
+}
+
+/**
+ * @brief 已打包像素对的混合：fb 低半字为前景、高半字为背景，返回混合后的 RGB565。
+ */
+static inline lcd_color565_t gfx_blend565_packed(uint32_t fb, uint8_t alpha)
+{
+    const uint32_t a = gfx_alpha_weight(alpha);
+
+#if GFX_BLEND_DSP
+    const uint32_t w = a | ((256U - a) << 16);
+    const uint32_t r = __SMLAD((fb >> 11) & 0x001F001FU, w, 128U) >> 8;
+    const uint32_t g = __SMLAD((fb >> 5) & 0x003F003FU, w, 128U) >> 8;
+    const uint32_t b = __SMLAD(fb & 0x001F001FU, w, 128U) >> 8;
+#else
+    const uint32_t na = 256U - a;
+    const uint32_t r = ((((fb >> 11) & 0x1FU) * a) + (((fb >> 27) & 0x1FU) * na) + 128U) >> 8;
+    const uint32_t g = ((((fb >> 5) & 0x3FU) * a) + (((fb >> 21) & 0x3FU) * na) + 128U) >> 8;
+    const uint32_t b = (((fb & 0x1FU) * a) + (((fb >> 16) & 0x1FU) * na) + 128U) >> 8;
+#endif
+
+    return (lcd_color565_t)((r << 11) | (g << 5) | b);
+}
+
+/**
+ * @brief 单像素混合：alpha = 0 输出 bg，alpha = 255 输出 fg。
+ */
+static inline lcd_color565_t gfx_blend565(lcd_color565_t fg, lcd_color565_t bg, uint8_t alpha)
+{
+    return gfx_blend565_packed((uint32_t)fg | ((uint32_t)bg << 16), alpha);
+}
+
+/* ----------------------------- 成段内核 ----------------------------- */
+
+/*
+ * 内核与 *_ref 参考实现逐像素结果完全一致（同一公式、同一取整）：
+ * - 内核：dst 先对齐到 4 字节，之后每次处理一个 32-bit 字（2 个像素），src 可不对齐
+ * - 参考：逐像素、逐分量直接按公式计算，用于等价性校验与周期对比（src/bench/bench_blend.h）
+ * 缓冲区允许在 SRAM / CCMRAM / 外部 SRAM 中，不使用 DMA。
+ */
+
+/** src-over：dst = blend(src, dst, alpha[i])，逐像素 alpha（0 = 保持 dst，255 = 拷贝 src）。 */
+void gfx_blend_span_over(lcd_color565_t *dst, const lcd_color565_t *src, const uint8_t *alpha, uint32_t n);
+
+/** 常数 alpha 交叉淡化：dst = blend(src, dst, alpha)。 */
+void gfx_blend_span_const(lcd_color565_t *dst, const lcd_color565_t *src, uint8_t alpha, uint32_t n);
+
+/** 向纯色淡化：dst = blend(color, dst, alpha)（淡入淡出、半透明遮罩）。 */
+void gfx_blend_span_fade(lcd_color565_t *dst, lcd_color565_t color, uint8_t alpha, uint32_t n);
+
+/** 加色混合：各分量 dst = min(dst + src, 最大值)（发光、高亮叠加）。 */
+void gfx_blend_span_add(lcd_color565_t *dst, const lcd_color565_t *src, uint32_t n);
+
+void gfx_blend_span_over_ref(lcd_color565_t *dst, const lcd_color565_t *src, const uint8_t *alpha, uint32_t n);
+void gfx_blend_span_const_ref(lcd_color565_t *dst, const lcd_color565_t *src, uint8_t alpha, uint32_t n);
+void gfx_blend_span_fade_ref(lcd_color565_t *dst, lcd_color565_t color, uint8_t alpha, uint32_t n);
+void gfx_blend_span_add_ref(lcd_color565_t *dst, const lcd_color565_t *src, uint32_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GFX_BLEND_H */
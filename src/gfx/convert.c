@@ -0,0 +1,255 @@
+#include "gfx/convert.h"
+
+#include "gfx/blend.h"
+
+/* 源字节流按字读取（允许非对齐，M4 的 LDR 支持；不会被合并成 LDRD/LDM） */
+typedef uint32_t __attribute__((may_alias, aligned(1))) gfx_conv_u32u_t;
+
+/* ----------------------------- 有序抖动 ----------------------------- */
+
+static const uint8_t gfx_conv_bayer[4][4] = {
+    {0U, 8U, 2U, 10U},
+    {12U, 4U, 14U, 6U},
+    {3U, 11U, 1U, 9U},
+    {15U, 7U, 13U, 5U},
+};
+
+/*
+ * 阈值按每个分量被截掉的位数缩放：5-bit 分量加 0..7，6-bit 分量加 0..3。
+ * 打包成与源像素同样的字节排布（R/B 对称，RGB888 与 ARGB8888 可共用），byte3（alpha）为 0。
+ */
+#define GFX_CONV_DW(b) (((uint32_t)(b) >> 1) | (((uint32_t)(b) >> 2) << 8) | (((uint32_t)(b) >> 1) << 16))
+
+/* 第 y 行的 4 个阈值字，按列 (x & 3) 取用 */
+static void gfx_conv_dither_row(uint32_t dw[4], uint16_t y)
+{
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        dw[i] = GFX_CONV_DW(gfx_conv_bayer[y & 3U][i]);
+    }
+}
+
+/* 逐字节饱和加：DSP 扩展下是一条 __UQADD8 */
+static inline uint32_t gfx_conv_qadd8(uint32_t a, uint32_t b)
+{
+#if GFX_BLEND_DSP
+    return __UQADD8(a, b);
+#else
+    uint32_t r = 0U;
+    for (uint32_t sh = 0U; sh < 32U; sh += 8U)
+    {
+        const uint32_t s = ((a >> sh) & 0xFFU) + ((b >> sh) & 0xFFU);
+        r |= ((s > 0xFFU) ? 0xFFU : s) << sh;
+    }
+    return r;
+#endif
+}
+
+/* ----------------------------- 打包 ----------------------------- */
+
+/* v = R | G << 8 | B << 16 */
+static inline lcd_color565_t gfx_conv_pack_rgb(uint32_t v)
+{
+    return (lcd_color565_t)(((v & 0xF8U) << 8) | ((v >> 5) & 0x07E0U) | ((v >> 19) & 0x1FU));
+}
+
+/* v = B | G << 8 | R << 16 | A << 24 */
+static inline lcd_color565_t gfx_conv_pack_bgr(uint32_t v)
+{
+    return (lcd_color565_t)(((v >> 8) & 0xF800U) | ((v >> 5) & 0x07E0U) | ((v >> 3) & 0x1FU));
+}
+
+/* ----------------------------- RGB888 ----------------------------- */
+
+/*
+ * 每次读 3 个字得到 4 个像素：
+ *   w0 = R0 G0 B0 R1 | w1 = G1 B1 R2 G2 | w2 = B2 R3 G3 B3（小端，括号内从低字节到高字节）
+ * 移位拼回 4 个 R|G<<8|B<<16，再统一打包。
+ */
+static inline void gfx_conv_rgb888_run(lcd_color565_t *dst, const uint8_t *src, uint32_t n,
+                                       const uint32_t *dw, uint32_t phase)
+{
+    while (n >= 4U)
+    {
+        const gfx_conv_u32u_t *s32 = (const gfx_conv_u32u_t *)(const void *)src;
+        const uint32_t w0 = s32[0];
+        const uint32_t w1 = s32[1];
+        const uint32_t w2 = s32[2];
+        uint32_t v0 = w0;
+        uint32_t v1 = (w0 >> 24) | (w1 << 8);
+        uint32_t v2 = (w1 >> 16) | (w2 << 16);
+        uint32_t v3 = w2 >> 8;
+
+        if (dw != 0)
+        {
+            /* 4 像素正好覆盖 Bayer 一行，阈值相位不变；逐字节饱和，高字节的残留不影响打包 */
+            v0 = gfx_conv_qadd8(v0, dw[phase]);
+            v1 = gfx_conv_qadd8(v1, dw[(phase + 1U) & 3U]);
+            v2 = gfx_conv_qadd8(v2, dw[(phase + 2U) & 3U]);
+            v3 = gfx_conv_qadd8(v3, dw[(phase + 3U) & 3U]);
+        }
+
+        dst[0] = gfx_conv_pack_rgb(v0);
+        dst[1] = gfx_conv_pack_rgb(v1);
+        dst[2] = gfx_conv_pack_rgb(v2);
+        dst[3] = gfx_conv_pack_rgb(v3);
+        dst += 4;
+        src += 12;
+        n -= 4U;
+    }
+
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        uint32_t v = (uint32_t)src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16);
+        if (dw != 0)
+        {
+            v = gfx_conv_qadd8(v, dw[(phase + i) & 3U]);
+        }
+        dst[i] = gfx_conv_pack_rgb(v);
+        src += 3;
+    }
+}
+
+void gfx_conv_rgb888(lcd_color565_t *dst, const uint8_t *src, uint32_t n)
+{
+    gfx_conv_rgb888_run(dst, src, n, 0, 0U);
+}
+
+void gfx_conv_rgb888_dither(lcd_color565_t *dst, const uint8_t *src, uint32_t n, uint16_t x, uint16_t y)
+{
+    uint32_t dw[4];
+
+    gfx_conv_dither_row(dw, y);
+    gfx_conv_rgb888_run(dst, src, n, dw, x & 3U);
+}
+
+/* ----------------------------- ARGB8888 ----------------------------- */
+
+static inline void gfx_conv_argb8888_run(lcd_color565_t *dst, uint8_t *alpha, const uint32_t *src, uint32_t n,
+                                         const uint32_t *dw, uint32_t phase)
+{
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        uint32_t v = src[i];
+        if (alpha != 0)
+        {
+            alpha[i] = (uint8_t)(v >> 24);
+        }
+        if (dw != 0)
+        {
+            v = gfx_conv_qadd8(v, dw[(phase + i) & 3U]);
+        }
+        dst[i] = gfx_conv_pack_bgr(v);
+    }
+}
+
+void gfx_conv_argb8888(lcd_color565_t *dst, uint8_t *alpha, const uint32_t *src, uint32_t n)
+{
+    gfx_conv_argb8888_run(dst, alpha, src, n, 0, 0U);
+}
+
+void gfx_conv_argb8888_dither(lcd_color565_t *dst, uint8_t *alpha, const uint32_t *src, uint32_t n,
+                              uint16_t x, uint16_t y)
+{
+    uint32_t dw[4];
+
+    gfx_conv_dither_row(dw, y);
+    gfx_conv_argb8888_run(dst, alpha, src, n, dw, x & 3U);
+}
+
+/* ----------------------------- GRAY8 ----------------------------- */
+
+static inline lcd_color565_t gfx_conv_gray_px(uint32_t g, const uint32_t *dw, uint32_t k)
+{
+    if (dw != 0)
+    {
+        /* 灰度复制到 R/G/B 三个字节后与 RGB888 走同一条抖动路径 */
+        return gfx_conv_pack_rgb(gfx_conv_qadd8(g * 0x00010101U, dw[k & 3U]));
+    }
+    return (lcd_color565_t)(((g & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (g >> 3));
+}
+
+static inline void gfx_conv_gray8_run(lcd_color565_t *dst, const uint8_t *src, uint32_t n,
+                                      const uint32_t *dw, uint32_t phase)
+{
+    /* 一次读 4 个灰度字节 */
+    while (n >= 4U)
+    {
+        const uint32_t w = *(const gfx_conv_u32u_t *)(const void *)src;
+        dst[0] = gfx_conv_gray_px(w & 0xFFU, dw, phase);
+        dst[1] = gfx_conv_gray_px((w >> 8) & 0xFFU, dw, phase + 1U);
+        dst[2] = gfx_conv_gray_px((w >> 16) & 0xFFU, dw, phase + 2U);
+        dst[3] = gfx_conv_gray_px(w >> 24, dw, phase + 3U);
+        dst += 4;
+        src += 4;
+        n -= 4U;
+    }
+
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        dst[i] = gfx_conv_gray_px(src[i], dw, phase + i);
+    }
+}
+
+void gfx_conv_gray8(lcd_color565_t *dst, const uint8_t *src, uint32_t n)
+{
+    gfx_conv_gray8_run(dst, src, n, 0, 0U);
+}
+
+void gfx_conv_gray8_dither(lcd_color565_t *dst, const uint8_t *src, uint32_t n, uint16_t x, uint16_t y)
+{
+    uint32_t dw[4];
+
+    gfx_conv_dither_row(dw, y);
+    gfx_conv_gray8_run(dst, src, n, dw, x & 3U);
+}
+
+/* ----------------------------- 直接上屏 ----------------------------- */
+
+static lcd_color565_t gfx_conv_line[LCD_PANEL_LONG_SIDE];
+
+void gfx_conv_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                   gfx_fmt_t fmt, const uint8_t *src, uint32_t stride, bool dither)
+{
+    if (src == 0)
+    {
+        return;
+    }
+
+    /* 坐标为无符号，裁剪只会截掉右/下部分，源起点不变 */
+    if (!lcd_clip_rect(&x, &y, &w, &h))
+    {
+        return;
+    }
+
+    lcd_set_window(x, y, w, h);
+
+    for (uint16_t row = 0U; row < h; row++)
+    {
+        const uint16_t sy = (uint16_t)(y + row);
+
+        if (fmt == GFX_FMT_GRAY8)
+        {
+            if (dither)
+            {
+                gfx_conv_gray8_dither(gfx_conv_line, src, w, x, sy);
+            }
+            else
+            {
+                gfx_conv_gray8(gfx_conv_line, src, w);
+            }
+        }
+        else if (dither)
+        {
+            gfx_conv_rgb888_dither(gfx_conv_line, src, w, x, sy);
+        }
+        else
+        {
+            gfx_conv_rgb888(gfx_conv_line, src, w);
+        }
+
+        /* 窗口内自动换行，逐行推送即可 */
+        lcd_write_pixels(gfx_conv_line, w);
+        src += stride;
+    }
+}
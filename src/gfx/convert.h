@@ -0,0 +1,62 @@
+#ifndef GFX_CONVERT_H
+#define GFX_CONVERT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lcd/lcd.h"
+
+/**
+ * @brief 像素格式转换（成段）：RGB888 / ARGB8888 / 8-bit 灰度 -> RGB565。
+ *
+ * 源格式（内存字节序）：
+ * - RGB888：每像素 3 字节 R, G, B
+ * - ARGB8888：每像素一个小端 uint32_t 0xAARRGGBB（内存中依次为 B, G, R, A）
+ * - GRAY8：每像素 1 字节亮度
+ *
+ * 截断模式直接取高位；抖动模式（*_dither）叠加 4×4 Bayer 有序抖动阈值后再截断，
+ * 消除渐变色带。抖动阈值由像素的屏幕坐标 (x, y) 决定，所以需要传入这一段首像素的坐标，
+ * 同一幅图分多段/多次转换时结果一致。
+ *
+ * 输出为连续 RGB565 段，可直接交给 lcd_blit() / lcd_write_pixels() 或 blend.h 的合成内核；
+ * gfx_conv_blit() 则一次设置窗口后逐行转换并推送。
+ *
+ * 详见: src/gfx/gfx.md
+ */
+
+typedef enum
+{
+    GFX_FMT_RGB888 = 0,
+    GFX_FMT_GRAY8,
+} gfx_fmt_t;
+
+/** RGB888 -> RGB565。 */
+void gfx_conv_rgb888(lcd_color565_t *dst, const uint8_t *src, uint32_t n);
+void gfx_conv_rgb888_dither(lcd_color565_t *dst, const uint8_t *src, uint32_t n, uint16_t x, uint16_t y);
+
+/** ARGB8888 -> RGB565 + 8-bit alpha（可直接交给 gfx_blend_span_over()）；alpha 传 0 时只转换颜色。 */
+void gfx_conv_argb8888(lcd_color565_t *dst, uint8_t *alpha, const uint32_t *src, uint32_t n);
+void gfx_conv_argb8888_dither(lcd_color565_t *dst, uint8_t *alpha, const uint32_t *src, uint32_t n,
+                              uint16_t x, uint16_t y);
+
+/** 8-bit 灰度 -> RGB565。 */
+void gfx_conv_gray8(lcd_color565_t *dst, const uint8_t *src, uint32_t n);
+void gfx_conv_gray8_dither(lcd_color565_t *dst, const uint8_t *src, uint32_t n, uint16_t x, uint16_t y);
+
+/**
+ * @brief 把 RGB888 / GRAY8 图像直接写到屏幕 (x,y)，默认裁剪（同 lcd_blit_stride()）。
+ *
+ * stride 为源图每行字节数。只设置一次窗口，每行先转换到行缓冲再连续写入。
+ */
+void gfx_conv_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                   gfx_fmt_t fmt, const uint8_t *src, uint32_t stride, bool dither);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GFX_CONVERT_H */
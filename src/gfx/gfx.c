@@ -0,0 +1,595 @@
+#include "gfx/gfx.h"
+
+/* ----------------------------- span 输出（裁剪后交给 lcd_fill_rect） ----------------------------- */
+
+/* 闭区间 [x0, x1] × y */
+static void gfx_span_h(int32_t x0, int32_t x1, int32_t y, lcd_color565_t color)
+{
+    if ((y < 0) || (y >= (int32_t)lcd_height()))
+    {
+        return;
+    }
+    if (x0 > x1)
+    {
+        const int32_t t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    if (x0 < 0)
+    {
+        x0 = 0;
+    }
+    if (x1 >= (int32_t)lcd_width())
+    {
+        x1 = (int32_t)lcd_width() - 1;
+    }
+    if (x0 > x1)
+    {
+        return;
+    }
+
+    lcd_fill_rect((uint16_t)x0, (uint16_t)y, (uint16_t)(x1 - x0 + 1), 1U, color);
+}
+
+/* 闭区间 x × [y0, y1] */
+static void gfx_span_v(int32_t x, int32_t y0, int32_t y1, lcd_color565_t color)
+{
+    if ((x < 0) || (x >= (int32_t)lcd_width()))
+    {
+        return;
+    }
+    if (y0 > y1)
+    {
+        const int32_t t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    if (y0 < 0)
+    {
+        y0 = 0;
+    }
+    if (y1 >= (int32_t)lcd_height())
+    {
+        y1 = (int32_t)lcd_height() - 1;
+    }
+    if (y0 > y1)
+    {
+        return;
+    }
+
+    lcd_fill_rect((uint16_t)x, (uint16_t)y0, 1U, (uint16_t)(y1 - y0 + 1), color);
+}
+
+static int32_t gfx_abs(int32_t v)
+{
+    return (v < 0) ? -v : v;
+}
+
+/* ----------------------------- 圆的逐行半宽 ----------------------------- */
+
+/*
+ * 半径 r 的圆在纵向偏移 dy 处的半宽：满足 x^2 + dy^2 <= r^2 + r 的最大 x（+r 相当于按 0.5 像素取整）。
+ * dy 单调递增时 x 单调递减，逐行递推，整体 O(r)。dy > r 时返回 -1。
+ */
+typedef struct
+{
+    int32_t r2;
+    int32_t x;
+} gfx_circle_iter_t;
+
+static void gfx_circle_iter_init(gfx_circle_iter_t *it, int32_t r)
+{
+    it->r2 = (r * r) + r;
+    it->x = r;
+}
+
+static int32_t gfx_circle_extent(gfx_circle_iter_t *it, int32_t dy)
+{
+    while ((it->x >= 0) && (((it->x * it->x) + (dy * dy)) > it->r2))
+    {
+        it->x--;
+    }
+    return it->x;
+}
+
+/*
+ * 圆角轮廓：左半部分以 cxl 为圆心、右半部分以 cxr 为圆心，上半以 cyt、下半以 cyb 为圆心。
+ * cxl == cxr 且 cyt == cyb 时即普通圆。
+ * 每行轮廓像素为 [inner, a]，其中 a 为本行半宽，inner = min(a, 下一行半宽 + 1)，保证 8 连通。
+ */
+static void gfx_round_outline(int32_t cxl, int32_t cxr, int32_t cyt, int32_t cyb, int32_t r,
+                              lcd_color565_t color)
+{
+    gfx_circle_iter_t it;
+    gfx_circle_iter_init(&it, r);
+
+    int32_t a = gfx_circle_extent(&it, 0);
+    for (int32_t dy = 0; dy <= r; dy++)
+    {
+        const int32_t b = (dy < r) ? gfx_circle_extent(&it, dy + 1) : -1;
+        const int32_t inner = ((b + 1) < a) ? (b + 1) : a;
+        const int32_t rows[2] = {cyt - dy, cyb + dy};
+        const int32_t nrows = ((dy == 0) && (cyt == cyb)) ? 1 : 2;
+
+        for (int32_t k = 0; k < nrows; k++)
+        {
+            if (inner == 0)
+            {
+                gfx_span_h(cxl - a, cxr + a, rows[k], color);
+            }
+            else
+            {
+                gfx_span_h(cxl - a, cxl - inner, rows[k], color);
+                gfx_span_h(cxr + inner, cxr + a, rows[k], color);
+            }
+        }
+
+        a = b;
+    }
+}
+
+/* 实心圆角：每行一段 [cxl - a, cxr + a] */
+static void gfx_round_fill(int32_t cxl, int32_t cxr, int32_t cyt, int32_t cyb, int32_t r,
+                           lcd_color565_t color)
+{
+    gfx_circle_iter_t it;
+    gfx_circle_iter_init(&it, r);
+
+    for (int32_t dy = 0; dy <= r; dy++)
+    {
+        const int32_t a = gfx_circle_extent(&it, dy);
+        gfx_span_h(cxl - a, cxr + a, cyt - dy, color);
+        if ((dy != 0) || (cyt != cyb))
+        {
+            gfx_span_h(cxl - a, cxr + a, cyb + dy, color);
+        }
+    }
+}
+
+/* ----------------------------- 角度（整数） ----------------------------- */
+
+/* sin(0..90°) × 16384 */
+static const int16_t gfx_sin_q14_table[91] = {
+    0,     286,   572,   857,   1143,  1428,  1713,  1997,  2280,  2563,  2845,  3126,  3406,
+    3686,  3964,  4240,  4516,  4790,  5063,  5334,  5604,  5872,  6138,  6402,  6664,  6924,
+    7182,  7438,  7692,  7943,  8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860,  10087,
+    10311, 10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365, 12551, 12733,
+    12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044, 14189, 14330, 14466, 14598, 14726,
+    14849, 14968, 15082, 15191, 15296, 15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964,
+    16026, 16083, 16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382, 16384,
+};
+
+static int32_t gfx_norm_deg(int32_t deg)
+{
+    deg %= 360;
+    return (deg < 0) ? (deg + 360) : deg;
+}
+
+static int32_t gfx_sin_q14(int32_t deg)
+{
+    deg = gfx_norm_deg(deg);
+    if (deg <= 90)
+    {
+        return gfx_sin_q14_table[deg];
+    }
+    if (deg <= 180)
+    {
+        return gfx_sin_q14_table[180 - deg];
+    }
+    if (deg <= 270)
+    {
+        return -gfx_sin_q14_table[deg - 180];
+    }
+    return -gfx_sin_q14_table[360 - deg];
+}
+
+static int32_t gfx_cos_q14(int32_t deg)
+{
+    return gfx_sin_q14(deg + 90);
+}
+
+typedef struct
+{
+    int32_t ax;
+    int32_t ay;
+    int32_t bx;
+    int32_t by;
+    bool full;
+    bool wide; /* 扫过角度 > 180° */
+} gfx_arc_range_t;
+
+/* 屏幕坐标（y 向下）中 cross(u, v) > 0 表示 v 在 u 的顺时针方向 */
+static int32_t gfx_cross(int32_t ux, int32_t uy, int32_t vx, int32_t vy)
+{
+    return (ux * vy) - (uy * vx);
+}
+
+static bool gfx_arc_contains(const gfx_arc_range_t *ar, int32_t px, int32_t py)
+{
+    if (ar->full)
+    {
+        return true;
+    }
+    if (!ar->wide)
+    {
+        return (gfx_cross(ar->ax, ar->ay, px, py) >= 0) && (gfx_cross(px, py, ar->bx, ar->by) >= 0);
+    }
+    return !((gfx_cross(ar->bx, ar->by, px, py) > 0) && (gfx_cross(px, py, ar->ax, ar->ay) > 0));
+}
+
+/* 把一段 [x0, x1]（相对圆心）按角度过滤，连续命中的像素合并为一段输出 */
+static void gfx_arc_span(const gfx_arc_range_t *ar, int32_t cx, int32_t cy,
+                         int32_t x0, int32_t x1, int32_t dy, lcd_color565_t color)
+{
+    if (ar->full)
+    {
+        gfx_span_h(cx + x0, cx + x1, cy + dy, color);
+        return;
+    }
+
+    int32_t run = 0;
+    bool in_run = false;
+    for (int32_t x = x0; x <= x1; x++)
+    {
+        const bool in = gfx_arc_contains(ar, x, dy);
+        if (in && !in_run)
+        {
+            run = x;
+            in_run = true;
+        }
+        else if (!in && in_run)
+        {
+            gfx_span_h(cx + run, cx + x - 1, cy + dy, color);
+            in_run = false;
+        }
+    }
+    if (in_run)
+    {
+        gfx_span_h(cx + run, cx + x1, cy + dy, color);
+    }
+}
+
+/* ----------------------------- 公共 API ----------------------------- */
+
+void gfx_hline(int16_t x, int16_t y, int16_t w, lcd_color565_t color)
+{
+    if (w > 0)
+    {
+        gfx_span_h(x, (int32_t)x + w - 1, y, color);
+    }
+}
+
+void gfx_vline(int16_t x, int16_t y, int16_t h, lcd_color565_t color)
+{
+    if (h > 0)
+    {
+        gfx_span_v(x, y, (int32_t)y + h - 1, color);
+    }
+}
+
+void gfx_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, lcd_color565_t color)
+{
+    /* 水平/垂直快速路径：整条线就是一段 */
+    if (y0 == y1)
+    {
+        gfx_span_h(x0, x1, y0, color);
+        return;
+    }
+    if (x0 == x1)
+    {
+        gfx_span_v(x0, y0, y1, color);
+        return;
+    }
+
+    const int32_t dx = gfx_abs((int32_t)x1 - x0);
+    const int32_t dy = -gfx_abs((int32_t)y1 - y0);
+    const int32_t sx = (x0 < x1) ? 1 : -1;
+    const int32_t sy = (y0 < y1) ? 1 : -1;
+    const bool x_major = (dx >= -dy);
+
+    int32_t err = dx + dy;
+    int32_t x = x0;
+    int32_t y = y0;
+    int32_t run_x = x;
+    int32_t run_y = y;
+
+    while ((x != x1) || (y != y1))
+    {
+        const int32_t px = x;
+        const int32_t py = y;
+        const int32_t e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y += sy;
+        }
+
+        /* 主方向为 x 时同一行的像素连成水平段；主方向为 y 时同一列的像素连成垂直段 */
+        if (x_major && (y != py))
+        {
+            gfx_span_h(run_x, px, py, color);
+            run_x = x;
+            run_y = y;
+        }
+        else if (!x_major && (x != px))
+        {
+            gfx_span_v(px, run_y, py, color);
+            run_x = x;
+            run_y = y;
+        }
+    }
+
+    if (x_major)
+    {
+        gfx_span_h(run_x, x, y, color);
+    }
+    else
+    {
+        gfx_span_v(x, run_y, y, color);
+    }
+}
+
+void gfx_rect(int16_t x, int16_t y, int16_t w, int16_t h, lcd_color565_t color)
+{
+    if ((w <= 0) || (h <= 0))
+    {
+        return;
+    }
+
+    const int32_t x1 = (int32_t)x + w - 1;
+    const int32_t y1 = (int32_t)y + h - 1;
+
+    gfx_span_h(x, x1, y, color);
+    if (h > 1)
+    {
+        gfx_span_h(x, x1, y1, color);
+    }
+    if (h > 2)
+    {
+        gfx_span_v(x, (int32_t)y + 1, y1 - 1, color);
+        if (w > 1)
+        {
+            gfx_span_v(x1, (int32_t)y + 1, y1 - 1, color);
+        }
+    }
+}
+
+void gfx_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, lcd_color565_t color)
+{
+    int32_t x0 = x;
+    int32_t y0 = y;
+    int32_t x1 = (int32_t)x + w;
+    int32_t y1 = (int32_t)y + h;
+
+    if (x0 < 0)
+    {
+        x0 = 0;
+    }
+    if (y0 < 0)
+    {
+        y0 = 0;
+    }
+    if ((x0 >= x1) || (y0 >= y1) || (x0 >= (int32_t)lcd_width()) || (y0 >= (int32_t)lcd_height()))
+    {
+        return;
+    }
+
+    /* 右/下越界由 lcd_fill_rect() 裁剪；整块只设置一次窗口 */
+    lcd_fill_rect((uint16_t)x0, (uint16_t)y0,
+                  (uint16_t)(((x1 - x0) > 0xFFFF) ? 0xFFFF : (x1 - x0)),
+                  (uint16_t)(((y1 - y0) > 0xFFFF) ? 0xFFFF : (y1 - y0)), color);
+}
+
+void gfx_circle(int16_t cx, int16_t cy, int16_t r, lcd_color565_t color)
+{
+    if (r >= 0)
+    {
+        gfx_round_outline(cx, cx, cy, cy, r, color);
+    }
+}
+
+void gfx_fill_circle(int16_t cx, int16_t cy, int16_t r, lcd_color565_t color)
+{
+    if (r >= 0)
+    {
+        gfx_round_fill(cx, cx, cy, cy, r, color);
+    }
+}
+
+void gfx_arc(int16_t cx, int16_t cy, int16_t r, int16_t thick,
+             int16_t start_deg, int16_t end_deg, lcd_color565_t color)
+{
+    if ((r < 0) || (thick <= 0))
+    {
+        return;
+    }
+
+    gfx_arc_range_t ar;
+    const int32_t sweep = (int32_t)end_deg - start_deg;
+    ar.full = (sweep >= 360) || (sweep <= -360);
+    const int32_t span = (gfx_norm_deg(sweep) == 0) ? 360 : gfx_norm_deg(sweep);
+    ar.wide = (span > 180);
+    ar.ax = gfx_cos_q14(start_deg);
+    ar.ay = gfx_sin_q14(start_deg);
+    ar.bx = gfx_cos_q14(end_deg);
+    ar.by = gfx_sin_q14(end_deg);
+    if (span == 360)
+    {
+        ar.full = true;
+    }
+
+    /* 环形带：外半宽 xo（半径 r），内半宽 xi（半径 r - thick，无内圆时为 -1） */
+    const int32_t ri = (int32_t)r - thick;
+    gfx_circle_iter_t outer;
+    gfx_circle_iter_t inner;
+    gfx_circle_iter_init(&outer, r);
+    gfx_circle_iter_init(&inner, (ri >= 0) ? ri : 0);
+
+    for (int32_t dy = 0; dy <= r; dy++)
+    {
+        const int32_t xo = gfx_circle_extent(&outer, dy);
+        const int32_t xi = (ri >= 0) ? gfx_circle_extent(&inner, dy) : -1;
+        const int32_t rows[2] = {dy, -dy};
+        const int32_t nrows = (dy == 0) ? 1 : 2;
+
+        for (int32_t k = 0; k < nrows; k++)
+        {
+            if (xi < 0)
+            {
+                gfx_arc_span(&ar, cx, cy, -xo, xo, rows[k], color);
+            }
+            else
+            {
+                gfx_arc_span(&ar, cx, cy, -xo, -xi - 1, rows[k], color);
+                gfx_arc_span(&ar, cx, cy, xi + 1, xo, rows[k], color);
+            }
+        }
+    }
+}
+
+static int32_t gfx_round_radius(int32_t w, int32_t h, int32_t r)
+{
+    const int32_t m = ((w < h) ? w : h) / 2;
+    if (r > m)
+    {
+        r = m;
+    }
+    return (r < 0) ? 0 : r;
+}
+
+void gfx_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, lcd_color565_t color)
+{
+    if ((w <= 0) || (h <= 0))
+    {
+        return;
+    }
+
+    const int32_t rr = gfx_round_radius(w, h, r);
+    const int32_t cxl = (int32_t)x + rr;
+    const int32_t cxr = (int32_t)x + w - 1 - rr;
+    const int32_t cyt = (int32_t)y + rr;
+    const int32_t cyb = (int32_t)y + h - 1 - rr;
+
+    /* 四个圆角 + 上下边（圆角最上/最下一行自然连成直边） */
+    gfx_round_outline(cxl, cxr, cyt, cyb, rr, color);
+
+    /* 左右直边 */
+    if ((cyb - cyt) > 1)
+    {
+        gfx_span_v(x, cyt + 1, cyb - 1, color);
+        gfx_span_v((int32_t)x + w - 1, cyt + 1, cyb - 1, color);
+    }
+}
+
+void gfx_fill_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, lcd_color565_t color)
+{
+    if ((w <= 0) || (h <= 0))
+    {
+        return;
+    }
+
+    const int32_t rr = gfx_round_radius(w, h, r);
+    const int32_t cxl = (int32_t)x + rr;
+    const int32_t cxr = (int32_t)x + w - 1 - rr;
+    const int32_t cyt = (int32_t)y + rr;
+    const int32_t cyb = (int32_t)y + h - 1 - rr;
+
+    gfx_round_fill(cxl, cxr, cyt, cyb, rr, color);
+
+    /* 中间整块一次窗口 */
+    if ((cyb - cyt) > 1)
+    {
+        gfx_fill_rect(x, (int16_t)(cyt + 1), w, (int16_t)(cyb - cyt - 1), color);
+    }
+}
+
+void gfx_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                  lcd_color565_t color)
+{
+    gfx_line(x0, y0, x1, y1, color);
+    gfx_line(x1, y1, x2, y2, color);
+    gfx_line(x2, y2, x0, y0, color);
+}
+
+/*
+ * 边 (x0, y0) -> (x0 + dx, y0 + d) 在第 t 行（0 <= t <= d，d > 0）的 x，四舍五入到最近像素。
+ * int16 顶点下 dx 可达 65535，dx * t * 2 会超出 int32：|dx|、d 都不超过 0x7FFF 时按 32 位算
+ * （屏幕尺寸的三角形都走这里），否则按 64 位算。
+ */
+static int32_t gfx_edge_x(int32_t x0, int32_t dx, int32_t t, int32_t d)
+{
+    const int32_t half = (dx >= 0) ? d : -d;
+
+    if ((dx <= 0x7FFF) && (dx >= -0x7FFF) && (d <= 0x7FFF))
+    {
+        return x0 + (((dx * t * 2) + half) / (2 * d));
+    }
+
+    return x0 + (int32_t)((((int64_t)dx * t * 2) + half) / ((int64_t)2 * d));
+}
+
+void gfx_fill_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                       lcd_color565_t color)
+{
+    int32_t ax = x0, ay = y0;
+    int32_t bx = x1, by = y1;
+    int32_t cx = x2, cy = y2;
+    int32_t t;
+
+    /* 按 y 排序：ay <= by <= cy */
+    if (ay > by)
+    {
+        t = ax; ax = bx; bx = t;
+        t = ay; ay = by; by = t;
+    }
+    if (by > cy)
+    {
+        t = bx; bx = cx; cx = t;
+        t = by; by = cy; cy = t;
+    }
+    if (ay > by)
+    {
+        t = ax; ax = bx; bx = t;
+        t = ay; ay = by; by = t;
+    }
+
+    if (ay == cy)
+    {
+        /* 退化为水平线 */
+        int32_t lo = ax;
+        int32_t hi = ax;
+        lo = (bx < lo) ? bx : lo;
+        lo = (cx < lo) ? cx : lo;
+        hi = (bx > hi) ? bx : hi;
+        hi = (cx > hi) ? cx : hi;
+        gfx_span_h(lo, hi, ay, color);
+        return;
+    }
+
+    /* 只扫描屏幕内的行 */
+    int32_t y_start = (ay < 0) ? 0 : ay;
+    int32_t y_end = (cy >= (int32_t)lcd_height()) ? ((int32_t)lcd_height() - 1) : cy;
+
+    for (int32_t y = y_start; y <= y_end; y++)
+    {
+        /* 长边 a->c；短边 a->b（上半）或 b->c（下半） */
+        const int32_t xl = gfx_edge_x(ax, cx - ax, y - ay, cy - ay);
+
+        int32_t xr;
+        if ((y < by) || (by == cy))
+        {
+            xr = (by == ay) ? bx : gfx_edge_x(ax, bx - ax, y - ay, by - ay);
+        }
+        else
+        {
+            xr = gfx_edge_x(bx, cx - bx, y - by, cy - by);
+        }
+
+        gfx_span_h(xl, xr, y, color);
+    }
+}
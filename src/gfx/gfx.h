@@ -0,0 +1,68 @@
+#ifndef GFX_GFX_H
+#define GFX_GFX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "lcd/lcd.h"
+
+/**
+ * @brief 基于水平/垂直 span 的 2D 图元库。
+ *
+ * 所有图元都分解为“一行（或一列）上连续的像素段”，每段只设置一次窗口后连续写入
+ * （lcd_fill_rect()：短段 CPU 写、长段 DMA2），不再逐像素设置窗口。
+ *
+ * - 坐标为有符号数，允许图元部分位于屏幕外（按段裁剪）
+ * - 角度单位为度，0° 指向 3 点钟方向，顺时针增加（屏幕坐标 y 向下）
+ *
+ * 详见: src/gfx/gfx.md
+ */
+
+/** 水平段 [x, x+w) × y。 */
+void gfx_hline(int16_t x, int16_t y, int16_t w, lcd_color565_t color);
+
+/** 垂直段 x × [y, y+h)。 */
+void gfx_vline(int16_t x, int16_t y, int16_t h, lcd_color565_t color);
+
+/**
+ * @brief 直线（Bresenham）。
+ *
+ * 水平/垂直线直接走单段；其余按主方向把同一行（或同一列）上连续的像素合并为一段输出。
+ */
+void gfx_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, lcd_color565_t color);
+
+/** 矩形边框 / 实心矩形（有符号坐标，自动裁剪）。 */
+void gfx_rect(int16_t x, int16_t y, int16_t w, int16_t h, lcd_color565_t color);
+void gfx_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, lcd_color565_t color);
+
+/** 圆（中点算法，按行输出左右两段） / 实心圆（每行一段）。 */
+void gfx_circle(int16_t cx, int16_t cy, int16_t r, lcd_color565_t color);
+void gfx_fill_circle(int16_t cx, int16_t cy, int16_t r, lcd_color565_t color);
+
+/**
+ * @brief 圆弧（环形带）：半径 (r - thick, r]，角度从 start_deg 顺时针到 end_deg。
+ *
+ * thick = 1 为单像素弧线；仪表盘刻度环可直接用较大的 thick。
+ * end_deg - start_deg >= 360 时画整环。
+ */
+void gfx_arc(int16_t cx, int16_t cy, int16_t r, int16_t thick,
+             int16_t start_deg, int16_t end_deg, lcd_color565_t color);
+
+/** 圆角矩形边框 / 实心圆角矩形（r 自动限制为 min(w,h)/2）。 */
+void gfx_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, lcd_color565_t color);
+void gfx_fill_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, lcd_color565_t color);
+
+/** 三角形边框 / 实心三角形（扫描线，每行一段）。 */
+void gfx_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                  lcd_color565_t color);
+void gfx_fill_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                       lcd_color565_t color);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GFX_GFX_H */
@@ -1,4 +1,6 @@
 #include "lcd.h"
+#include "lcd_dma.h"
+#include "lcd_port.h"
 
 #include "stm32f4xx.h"
 
@@ -12,18 +14,6 @@
 #define __ISB() __asm volatile("isb 0xF" ::: "memory")
 #endif
 
-/* ----------------------------- FSMC 地址映射 ----------------------------- */
-/*
- * Bank1 NE4 基地址：0x6C000000
- * RS(D/C) 接 FSMC_A6；16-bit 模式下 A6 对应 MCU 地址 bit7 -> 偏移 0x80
- * 详见: src/lcd/lcd.md
- */
-#define LCD_FSMC_NE4_BASE (0x6C000000UL)
-#define LCD_FSMC_RS_OFFS  (0x00000080UL)
-
-#define LCD_CMD_REG  (*((volatile uint16_t *)(LCD_FSMC_NE4_BASE + 0U)))
-#define LCD_DATA_REG (*((volatile uint16_t *)(LCD_FSMC_NE4_BASE + LCD_FSMC_RS_OFFS)))
-
 /* ----------------------------- 时序可调宏 ----------------------------- */
 /*
  * 说明：这些参数是以 HCLK=168MHz 为目标的“保守值”。
@@ -62,6 +52,64 @@
 #define LCD_FSMC_WRITE_ACCMOD (0x00U) /* Mode A */
 #endif
 
+/* ----------------------------- GRAM 读出格式 ----------------------------- */
+/*
+ * Memory Read(0x2E) 在 16-bit 总线上的数据格式（首个读周期为 dummy read）：
+ * - LCD_GRAM_READ_RGB565：每像素 1 个字，直接为 RGB565
+ * - LCD_GRAM_READ_RGB888：每 2 像素 3 个字 [R1:G1] [B1:R2] [G2:B2]，各分量 8-bit，
+ *   HX8357D 内部为 18-bit，分量高 6 位有效（写入的 RGB565 可无损读回）
+ */
+#define LCD_GRAM_READ_RGB565 (0U)
+#define LCD_GRAM_READ_RGB888 (1U)
+
+#ifndef LCD_GRAM_READ_FORMAT
+#define LCD_GRAM_READ_FORMAT LCD_GRAM_READ_RGB888
+#endif
+
+/*
+ * lcd_read_rect() 像素数不少于该值且 dst DMA 可达时走 DMA2 读取。
+ * RGB888 读格式下按 LCD_DMA_READ_CHUNK 像素分段，DMA 读下一段的同时 CPU 转换上一段。
+ */
+#ifndef LCD_DMA_READ_MIN_PIXELS
+#define LCD_DMA_READ_MIN_PIXELS (256U)
+#endif
+#ifndef LCD_DMA_READ_CHUNK
+#define LCD_DMA_READ_CHUNK (128U) /* 必须为偶数 */
+#endif
+
+/* ----------------------------- 时序校准参数 ----------------------------- */
+/* 测试区域边长（像素），位于屏幕左上角 */
+#ifndef LCD_FSMC_CAL_SIZE
+#define LCD_FSMC_CAL_SIZE (16U)
+#endif
+/* 在最快稳定档位基础上再放慢的档数 */
+#ifndef LCD_FSMC_CAL_MARGIN_STEPS
+#define LCD_FSMC_CAL_MARGIN_STEPS (1U)
+#endif
+/* 每档重复验证次数 */
+#ifndef LCD_FSMC_CAL_REPEAT
+#define LCD_FSMC_CAL_REPEAT (4U)
+#endif
+/* 带宽测量写入的像素数（在测试窗口内循环写） */
+#define LCD_FSMC_CAL_BW_PIXELS (16384U)
+
+/* ----------------------------- DMA 填充阈值 ----------------------------- */
+/*
+ * 像素数不少于该值时 lcd_fill_rect() 走 DMA2 填充；
+ * 更小的矩形（含单点）DMA 配置开销大于收益，仍走 CPU 循环。
+ */
+#ifndef LCD_DMA_FILL_MIN_PIXELS
+#define LCD_DMA_FILL_MIN_PIXELS (64U)
+#endif
+
+/*
+ * lcd_blit() 单段（整块或单行）像素数不少于该值且源缓冲区 DMA 可达时走 DMA2；
+ * 置为 0xFFFFFFFF 可强制只走 CPU 展开写。
+ */
+#ifndef LCD_DMA_BLIT_MIN_PIXELS
+#define LCD_DMA_BLIT_MIN_PIXELS (256U)
+#endif
+
 /* ----------------------------- GPIO 工具函数 ----------------------------- */
 static void gpio_set_af(GPIO_TypeDef *port, uint8_t pin, uint8_t af)
 {
@@ -205,7 +253,7 @@ static void lcd_fsmc_init(void)
 
     FSMC_Bank1->BTCR[6] = bcr; /* MBKEN=0 */
     FSMC_Bank1->BTCR[7] = btr_read;
-    FSMC_Bank1E->BWTR[3] = btr_write;
+    FSMC_Bank1E->BWTR[6] = btr_write;
 
     /* 使能 bank */
     SET_BIT(FSMC_Bank1->BTCR[6], FSMC_BCR4_MBKEN);
@@ -214,9 +262,110 @@ static void lcd_fsmc_init(void)
     __ISB();
 }
 
+static void lcd_fsmc_apply_timing(const lcd_fsmc_timing_t *timing)
+{
+    const uint32_t btr_read = fsmc_build_btr(timing->read_addset,
+                                             LCD_FSMC_READ_ADDHLD,
+                                             timing->read_datast,
+                                             LCD_FSMC_READ_BUSTURN,
+                                             LCD_FSMC_READ_ACCMOD);
+    const uint32_t btr_write = fsmc_build_btr(timing->write_addset,
+                                              LCD_FSMC_WRITE_ADDHLD,
+                                              timing->write_datast,
+                                              LCD_FSMC_WRITE_BUSTURN,
+                                              LCD_FSMC_WRITE_ACCMOD);
+
+    FSMC_Bank1->BTCR[7] = btr_read;
+    FSMC_Bank1E->BWTR[6] = btr_write;
+
+    /* 确保后续总线访问使用新时序 */
+    __DSB();
+}
+
 /* ----------------------------- 对外 API ----------------------------- */
+void lcd_fsmc_get_timing(lcd_fsmc_timing_t *timing)
+{
+    if (timing == 0)
+    {
+        return;
+    }
+
+    const uint32_t btr_read = FSMC_Bank1->BTCR[7];
+    const uint32_t btr_write = FSMC_Bank1E->BWTR[6];
+
+    timing->read_addset = (uint8_t)((btr_read & FSMC_BTR1_ADDSET_Msk) >> FSMC_BTR1_ADDSET_Pos);
+    timing->read_datast = (uint8_t)((btr_read & FSMC_BTR1_DATAST_Msk) >> FSMC_BTR1_DATAST_Pos);
+    timing->write_addset = (uint8_t)((btr_write & FSMC_BTR1_ADDSET_Msk) >> FSMC_BTR1_ADDSET_Pos);
+    timing->write_datast = (uint8_t)((btr_write & FSMC_BTR1_DATAST_Msk) >> FSMC_BTR1_DATAST_Pos);
+}
+
+void lcd_fsmc_set_timing(const lcd_fsmc_timing_t *timing)
+{
+    if (timing == 0)
+    {
+        return;
+    }
+
+    /* DMA 仍在推送数据时不能改时序 */
+    lcd_dma_wait();
+    lcd_fsmc_apply_timing(timing);
+}
+
+/* ----------------------------- 命令影子状态 ----------------------------- */
+/*
+ * 记录最近一次写入控制器的窗口/MADCTL 与 lcd_draw_pixel() 的写光标：
+ * - col/page：与上次相同则跳过 0x2A/0x2B（各省 5 次总线写）
+ * - madctl：与上次相同则跳过 0x36
+ * - cursor：lcd_draw_pixel() 的窗口为“当前行剩余部分”，下一个像素恰好是自动递增位置时只写 1 个数据字
+ * 任何命令都会使 cursor 失效；外部直接发送 0x2A/0x2B/0x36/0x01 时对应影子失效。
+ */
+typedef struct
+{
+    bool col_valid;
+    bool page_valid;
+    bool madctl_valid;
+    bool cursor_valid;
+    uint16_t col0;
+    uint16_t col1;
+    uint16_t page0;
+    uint16_t page1;
+    uint16_t cur_x;
+    uint16_t cur_y;
+    uint8_t madctl;
+} lcd_shadow_t;
+
+static lcd_shadow_t lcd_shadow;
+static lcd_cmd_stats_t lcd_cmd_stats;
+
+void lcd_cmd_invalidate(void)
+{
+    lcd_shadow.col_valid = false;
+    lcd_shadow.page_valid = false;
+    lcd_shadow.madctl_valid = false;
+    lcd_shadow.cursor_valid = false;
+}
+
+void lcd_cmd_get_stats(lcd_cmd_stats_t *out)
+{
+    if (out != 0)
+    {
+        *out = lcd_cmd_stats;
+    }
+}
+
+void lcd_cmd_reset_stats(void)
+{
+    lcd_cmd_stats.issued = 0U;
+    lcd_cmd_stats.saved = 0U;
+    lcd_cmd_stats.window_hits = 0U;
+    lcd_cmd_stats.cursor_hits = 0U;
+}
+
 void lcd_reset_assert(void)
 {
+    /* 硬件复位后控制器寄存器恢复默认值 */
+    lcd_cmd_invalidate();
+
     /* PD3 = 0 */
     SET_BIT(GPIOD->BSRR, (1UL << (3U + 16U)));
 }
@@ -261,29 +410,55 @@ void lcd_backlight_set(bool on)
 
 void lcd_write_cmd(uint16_t cmd)
 {
-    LCD_CMD_REG = cmd;
+    /* 每个总线事务都以命令开始：DMA 仍在推送 GRAM 数据时必须等其结束 */
+    lcd_dma_wait();
+    LCD_WR_CMD(cmd);
+
+    lcd_cmd_stats.issued++;
+    lcd_shadow.cursor_valid = false;
+
+    switch (cmd)
+    {
+    case 0x01U: /* Software Reset */
+        lcd_cmd_invalidate();
+        break;
+    case 0x2AU:
+        lcd_shadow.col_valid = false;
+        break;
+    case 0x2BU:
+        lcd_shadow.page_valid = false;
+        break;
+    case 0x36U:
+        lcd_shadow.madctl_valid = false;
+        break;
+    default:
+        break;
+    }
 }
 
 void lcd_write_data(uint16_t data)
 {
-    LCD_DATA_REG = data;
+    /* 外部直接写数据会移动 GRAM 地址指针 */
+    lcd_shadow.cursor_valid = false;
+    LCD_WR_DATA(data);
 }
 
 uint16_t lcd_read_data(void)
 {
-    return LCD_DATA_REG;
+    return LCD_RD_DATA();
 }
 
 uint16_t lcd_read_data_dummy(void)
 {
-    (void)LCD_DATA_REG;
-    return LCD_DATA_REG;
+    (void)LCD_RD_DATA();
+    return LCD_RD_DATA();
 }
 
 void lcd_init(void)
 {
     lcd_gpio_init();
     lcd_fsmc_init();
+    lcd_dma_init();
 
     /* 复位 + 背光默认打开 */
     lcd_backlight_on();
@@ -292,12 +467,28 @@ void lcd_init(void)
 
 /* ============================= 中上层（HX8357D） ============================= */
 
+#if LCD_DMA_ENABLE
+/* DMA 填充的源数据：必须位于 SRAM（DMA2 不能访问 CCMRAM / 寄存器变量） */
+static volatile lcd_color565_t lcd_dma_fill_color;
+#endif
+
+/*
+ * 当前方向下的逻辑宽高。旋转完全交给控制器的地址扫描顺序（MADCTL MY/MX/MV），
+ * 窗口与像素数据始终按逻辑坐标发送，blit 不需要软件转置。
+ * 低 4 位 0x0C（BGR 等）保持 lcd_panel_init() 原有 0x4C 的取值，只改 MY/MX/MV。
+ */
+static const uint8_t lcd_rotation_madctl[4] = {0x4CU, 0x2CU, 0x8CU, 0xECU};
+static lcd_rotation_t lcd_rotation = LCD_ROTATION_0;
+static uint16_t lcd_w = (uint16_t)LCD_PANEL_WIDTH;
+static uint16_t lcd_h = (uint16_t)LCD_PANEL_HEIGHT;
+
 static inline void lcd_write_u8(uint8_t v)
 {
     /* HX8357D 的一些寄存器在参考代码里是按 8-bit 数据写入。
      * 我们走 8080-16bit 总线时，直接把 8-bit 放在低 8 位写即可。
      */
-    lcd_write_data((uint16_t)v);
+    LCD_WR_DATA(v);
+    lcd_cmd_stats.issued++;
 }
 
 static bool lcd_clip_rect_u16(uint16_t *x,
@@ -338,52 +529,376 @@ static bool lcd_clip_rect_u16(uint16_t *x,
     return true;
 }
 
-void lcd_set_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+bool lcd_clip_rect(uint16_t *x, uint16_t *y, uint16_t *w, uint16_t *h)
 {
-    if (!lcd_clip_rect_u16(&x, &y, &w, &h, (uint16_t)LCD_PANEL_WIDTH, (uint16_t)LCD_PANEL_HEIGHT))
-    {
-        return;
-    }
+    return lcd_clip_rect_u16(x, y, w, h, lcd_w, lcd_h);
+}
 
+/* 发送 0x2A/0x2B 设置 GRAM 地址窗口（不发 0x2C/0x2E），矩形已裁剪；与影子状态相同的部分跳过 */
+static void lcd_set_address(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
     const uint16_t x0 = x;
     const uint16_t y0 = y;
     const uint16_t x1 = (uint16_t)(x + w - 1U);
     const uint16_t y1 = (uint16_t)(y + h - 1U);
 
-    /* Column Address Set (0x2A): x0..x1 */
-    lcd_write_cmd(0x2A);
-    lcd_write_u8((uint8_t)(x0 >> 8));
-    lcd_write_u8((uint8_t)(x0 & 0xFFU));
-    lcd_write_u8((uint8_t)(x1 >> 8));
-    lcd_write_u8((uint8_t)(x1 & 0xFFU));
+    /* 异步队列会在中断里改写窗口：先等 DMA 引擎（含队列）空闲再比对影子状态 */
+    lcd_dma_wait();
+
+    if (lcd_shadow.col_valid && (lcd_shadow.col0 == x0) && (lcd_shadow.col1 == x1))
+    {
+        lcd_cmd_stats.saved += 5U;
+        lcd_cmd_stats.window_hits++;
+    }
+    else
+    {
+        /* Column Address Set (0x2A): x0..x1 */
+        lcd_write_cmd(0x2A);
+        lcd_write_u8((uint8_t)(x0 >> 8));
+        lcd_write_u8((uint8_t)(x0 & 0xFFU));
+        lcd_write_u8((uint8_t)(x1 >> 8));
+        lcd_write_u8((uint8_t)(x1 & 0xFFU));
+
+        lcd_shadow.col0 = x0;
+        lcd_shadow.col1 = x1;
+        lcd_shadow.col_valid = true;
+    }
+
+    if (lcd_shadow.page_valid && (lcd_shadow.page0 == y0) && (lcd_shadow.page1 == y1))
+    {
+        lcd_cmd_stats.saved += 5U;
+        lcd_cmd_stats.window_hits++;
+    }
+    else
+    {
+        /* Page Address Set (0x2B): y0..y1 */
+        lcd_write_cmd(0x2B);
+        lcd_write_u8((uint8_t)(y0 >> 8));
+        lcd_write_u8((uint8_t)(y0 & 0xFFU));
+        lcd_write_u8((uint8_t)(y1 >> 8));
+        lcd_write_u8((uint8_t)(y1 & 0xFFU));
+
+        lcd_shadow.page0 = y0;
+        lcd_shadow.page1 = y1;
+        lcd_shadow.page_valid = true;
+    }
+}
 
-    /* Page Address Set (0x2B): y0..y1 */
-    lcd_write_cmd(0x2B);
-    lcd_write_u8((uint8_t)(y0 >> 8));
-    lcd_write_u8((uint8_t)(y0 & 0xFFU));
-    lcd_write_u8((uint8_t)(y1 >> 8));
-    lcd_write_u8((uint8_t)(y1 & 0xFFU));
+void lcd_set_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if (!lcd_clip_rect_u16(&x, &y, &w, &h, lcd_w, lcd_h))
+    {
+        return;
+    }
+
+    lcd_set_address(x, y, w, h);
 
     /* Memory Write (0x2C) */
     lcd_write_cmd(0x2C);
 }
 
+void lcd_set_madctl(uint8_t madctl)
+{
+    if (lcd_shadow.madctl_valid && (lcd_shadow.madctl == madctl))
+    {
+        lcd_cmd_stats.saved += 2U;
+        return;
+    }
+
+    lcd_write_cmd(0x36);
+    lcd_write_u8(madctl);
+
+    lcd_shadow.madctl = madctl;
+    lcd_shadow.madctl_valid = true;
+}
+
+void lcd_set_rotation(lcd_rotation_t rot)
+{
+    const uint32_t r = (uint32_t)rot & 3U;
+
+    /* 同一组 0x2A/0x2B 参数在不同扫描顺序下含义不同：窗口影子全部作废 */
+    lcd_cmd_invalidate();
+    lcd_set_madctl(lcd_rotation_madctl[r]);
+
+    lcd_rotation = (lcd_rotation_t)r;
+    if ((r & 1U) != 0U)
+    {
+        lcd_w = (uint16_t)LCD_PANEL_HEIGHT;
+        lcd_h = (uint16_t)LCD_PANEL_WIDTH;
+    }
+    else
+    {
+        lcd_w = (uint16_t)LCD_PANEL_WIDTH;
+        lcd_h = (uint16_t)LCD_PANEL_HEIGHT;
+    }
+}
+
+lcd_rotation_t lcd_get_rotation(void)
+{
+    return lcd_rotation;
+}
+
+uint16_t lcd_width(void)
+{
+    return lcd_w;
+}
+
+uint16_t lcd_height(void)
+{
+    return lcd_h;
+}
+
+bool lcd_set_scroll_area(uint16_t tfa, uint16_t vsa, uint16_t bfa)
+{
+    if (((uint32_t)tfa + vsa + bfa) != LCD_PANEL_HEIGHT)
+    {
+        return false;
+    }
+
+    lcd_write_cmd(0x33);
+    lcd_write_u8((uint8_t)(tfa >> 8));
+    lcd_write_u8((uint8_t)(tfa & 0xFFU));
+    lcd_write_u8((uint8_t)(vsa >> 8));
+    lcd_write_u8((uint8_t)(vsa & 0xFFU));
+    lcd_write_u8((uint8_t)(bfa >> 8));
+    lcd_write_u8((uint8_t)(bfa & 0xFFU));
+    return true;
+}
+
+void lcd_set_scroll_start(uint16_t vsp)
+{
+    lcd_write_cmd(0x37);
+    lcd_write_u8((uint8_t)(vsp >> 8));
+    lcd_write_u8((uint8_t)(vsp & 0xFFU));
+}
+
+void lcd_scroll_off(void)
+{
+    (void)lcd_set_scroll_area(0U, (uint16_t)LCD_PANEL_HEIGHT, 0U);
+    lcd_set_scroll_start(0U);
+    lcd_write_cmd(0x13);
+}
+
+void lcd_set_tear_on(bool on)
+{
+    if (on)
+    {
+        lcd_write_cmd(0x35);
+        lcd_write_u8(0x00);
+    }
+    else
+    {
+        lcd_write_cmd(0x34);
+    }
+}
+
+void lcd_set_tear_scanline(uint16_t line)
+{
+    lcd_write_cmd(0x44);
+    lcd_write_u8((uint8_t)(line >> 8));
+    lcd_write_u8((uint8_t)(line & 0xFFU));
+}
+
+uint16_t lcd_get_scanline(void)
+{
+    uint16_t hi;
+    uint16_t lo;
+
+    /* 参数依次为 dummy、STS[9:8]、STS[7:0]，各在数据总线低 8 位 */
+    lcd_write_cmd(0x45);
+    hi = lcd_read_data_dummy();
+    lo = lcd_read_data();
+    return (uint16_t)(((hi & 0x03U) << 8) | (lo & 0xFFU));
+}
+
+static inline lcd_color565_t lcd_rgb888_to_565(uint32_t r, uint32_t g, uint32_t b)
+{
+    return (lcd_color565_t)(((r & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (b >> 3));
+}
+
+/* 开始 Memory Read：设置地址窗口、发 0x2E，丢弃 dummy read 后返回第一个数据字 */
+static uint16_t lcd_read_begin(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    lcd_set_address(x, y, w, h);
+    lcd_write_cmd(0x2E);
+    return lcd_read_data_dummy();
+}
+
+/* 读格式下 pixels 个像素对应的总线字数 */
+static uint32_t lcd_read_words(uint32_t pixels)
+{
+#if LCD_GRAM_READ_FORMAT == LCD_GRAM_READ_RGB565
+    return pixels;
+#else
+    return ((pixels / 2U) * 3U) + (((pixels & 1U) != 0U) ? 2U : 0U);
+#endif
+}
+
+#if LCD_GRAM_READ_FORMAT != LCD_GRAM_READ_RGB565
+/* [R1:G1] [B1:R2] [G2:B2] -> 2 个 RGB565；奇数尾像素占 2 个字 */
+static void lcd_read_unpack(const uint16_t *raw, lcd_color565_t *dst, uint32_t pixels)
+{
+    uint32_t i = 0U;
+    while ((i + 1U) < pixels)
+    {
+        const uint32_t a = raw[0];
+        const uint32_t b = raw[1];
+        const uint32_t c = raw[2];
+        raw += 3;
+        dst[i++] = lcd_rgb888_to_565(a >> 8, a & 0xFFU, b >> 8);
+        dst[i++] = lcd_rgb888_to_565(b & 0xFFU, c >> 8, c & 0xFFU);
+    }
+    if (i < pixels)
+    {
+        const uint32_t a = raw[0];
+        const uint32_t b = raw[1];
+        dst[i] = lcd_rgb888_to_565(a >> 8, a & 0xFFU, b >> 8);
+    }
+}
+#endif
+
+/* CPU 逐字读取已裁剪矩形的 GRAM 内容（RGB565） */
+static void lcd_read_gram(uint16_t x, uint16_t y, uint16_t w, uint16_t h, lcd_color565_t *dst)
+{
+    const uint32_t pixels = (uint32_t)w * (uint32_t)h;
+
+    const uint16_t first = lcd_read_begin(x, y, w, h);
+
+#if LCD_GRAM_READ_FORMAT == LCD_GRAM_READ_RGB565
+    dst[0] = first;
+    for (uint32_t i = 1U; i < pixels; i++)
+    {
+        dst[i] = LCD_RD_DATA();
+    }
+#else
+    uint16_t raw[3];
+    uint32_t have = 1U; /* 第一组的首字已由 lcd_read_begin() 读出 */
+    uint32_t i = 0U;
+
+    raw[0] = first;
+    while (i < pixels)
+    {
+        const uint32_t n = ((pixels - i) >= 2U) ? 2U : 1U;
+        const uint32_t words = lcd_read_words(n);
+        for (uint32_t k = have; k < words; k++)
+        {
+            raw[k] = LCD_RD_DATA();
+        }
+        have = 0U;
+        lcd_read_unpack(raw, &dst[i], n);
+        i += n;
+    }
+#endif
+}
+
+#if LCD_DMA_ENABLE
+#if LCD_GRAM_READ_FORMAT != LCD_GRAM_READ_RGB565
+/* RGB888 读格式的 DMA 乒乓缓冲：DMA 读第 k+1 段时 CPU 转换第 k 段 */
+static uint16_t lcd_read_raw[2][(LCD_DMA_READ_CHUNK / 2U) * 3U];
+#endif
+
+static void lcd_read_gram_dma(uint16_t x, uint16_t y, uint16_t w, uint16_t h, lcd_color565_t *dst)
+{
+    const uint32_t pixels = (uint32_t)w * (uint32_t)h;
+
+    const uint16_t first = lcd_read_begin(x, y, w, h);
+
+#if LCD_GRAM_READ_FORMAT == LCD_GRAM_READ_RGB565
+    /* 1 字/像素：源固定 LCD_DATA，目的递增，直接落到 dst（首字已由 CPU 读出） */
+    dst[0] = first;
+    (void)lcd_dma_start(&LCD_DATA_REG, false, &dst[1], true, pixels - 1U, 0, 0);
+    lcd_dma_wait();
+#else
+    uint32_t done = 0U;
+    uint32_t cur = 0U;
+    uint32_t n = (pixels > LCD_DMA_READ_CHUNK) ? LCD_DMA_READ_CHUNK : pixels;
+
+    /* 第一段的首字已由 CPU 读出，DMA 从第 2 个字开始 */
+    lcd_read_raw[cur][0] = first;
+    (void)lcd_dma_start(&LCD_DATA_REG, false, &lcd_read_raw[cur][1], true, lcd_read_words(n) - 1U, 0, 0);
+    while (n != 0U)
+    {
+        lcd_dma_wait();
+
+        /* 先启动下一段，再转换本段 */
+        const uint32_t left = pixels - done - n;
+        const uint32_t next = (left > LCD_DMA_READ_CHUNK) ? LCD_DMA_READ_CHUNK : left;
+        if (next != 0U)
+        {
+            (void)lcd_dma_start(&LCD_DATA_REG, false, lcd_read_raw[cur ^ 1U], true,
+                                lcd_read_words(next), 0, 0);
+        }
+
+        lcd_read_unpack(lcd_read_raw[cur], &dst[done], n);
+
+        done += n;
+        n = next;
+        cur ^= 1U;
+    }
+#endif
+}
+#endif /* LCD_DMA_ENABLE */
+
+bool lcd_read_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, lcd_color565_t *dst)
+{
+    if (dst == 0)
+    {
+        return false;
+    }
+
+    /* 不做部分读取：裁剪后与 dst 布局不一致 */
+    uint16_t cx = x;
+    uint16_t cy = y;
+    uint16_t cw = w;
+    uint16_t ch = h;
+    if (!lcd_clip_rect_u16(&cx, &cy, &cw, &ch, lcd_w, lcd_h) ||
+        (cw != w) || (ch != h))
+    {
+        return false;
+    }
+
+#if LCD_DMA_ENABLE
+    if ((((uint32_t)w * (uint32_t)h) >= LCD_DMA_READ_MIN_PIXELS) && lcd_dma_addr_ok(dst))
+    {
+        lcd_read_gram_dma(x, y, w, h, dst);
+        return true;
+    }
+#endif
+
+    lcd_read_gram(x, y, w, h, dst);
+    return true;
+}
+
 void lcd_draw_pixel(uint16_t x, uint16_t y, lcd_color565_t color)
 {
-    uint16_t w = 1U;
-    uint16_t h = 1U;
-    if (!lcd_clip_rect_u16(&x, &y, &w, &h, (uint16_t)LCD_PANEL_WIDTH, (uint16_t)LCD_PANEL_HEIGHT))
+    if ((x >= lcd_w) || (y >= lcd_h))
     {
         return;
     }
 
-    lcd_set_window(x, y, 1U, 1U);
-    lcd_write_data(color);
+    if (lcd_shadow.cursor_valid && (lcd_shadow.cur_x == x) && (lcd_shadow.cur_y == y))
+    {
+        /* 正好是 GRAM 自动递增的下一个位置：免发窗口与 0x2C */
+        lcd_cmd_stats.saved += 11U;
+        lcd_cmd_stats.cursor_hits++;
+    }
+    else
+    {
+        /* 窗口取“本行剩余部分”：同一行向右连续画点时后续像素只需写数据 */
+        lcd_set_window(x, y, (uint16_t)(lcd_w - x), 1U);
+    }
+
+    LCD_WR_DATA(color);
+
+    /* 行尾之后会回绕，不再可预测 */
+    lcd_shadow.cur_x = (uint16_t)(x + 1U);
+    lcd_shadow.cur_y = y;
+    lcd_shadow.cursor_valid = (lcd_shadow.cur_x < lcd_w);
 }
 
 void lcd_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, lcd_color565_t color)
 {
-    if (!lcd_clip_rect_u16(&x, &y, &w, &h, (uint16_t)LCD_PANEL_WIDTH, (uint16_t)LCD_PANEL_HEIGHT))
+    if (!lcd_clip_rect_u16(&x, &y, &w, &h, lcd_w, lcd_h))
     {
         return;
     }
@@ -391,15 +906,329 @@ void lcd_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, lcd_color565_
     lcd_set_window(x, y, w, h);
 
     const uint32_t pixels = (uint32_t)w * (uint32_t)h;
+
+#if LCD_DMA_ENABLE
+    if (pixels >= LCD_DMA_FILL_MIN_PIXELS)
+    {
+        /* 源为固定颜色字，目的为固定 LCD_DATA；大于 65535 的部分由 DMA 中断自动分段。
+         * 启动后立即返回：下一次总线事务（命令 / 窗口）会先等 DMA 结束，
+         * lcd_dma_fill_color 也要等下一次 lcd_set_window() 之后才会改写 */
+        lcd_dma_fill_color = color;
+        if (lcd_dma_start(&lcd_dma_fill_color, false, &LCD_DATA_REG, false, pixels, 0, 0))
+        {
+            return;
+        }
+    }
+#endif
+
     for (uint32_t i = 0; i < pixels; i++)
     {
         lcd_write_data(color);
     }
 }
 
+/* 以 32-bit 方式读取 RGB565 缓冲区（may_alias：避免严格别名优化问题） */
+typedef uint32_t __attribute__((may_alias)) lcd_u32_alias_t;
+
+void lcd_write_pixels(const lcd_color565_t *src, uint32_t count)
+{
+    if ((src == 0) || (count == 0U))
+    {
+        return;
+    }
+
+    /* 对齐到 4 字节后按 32-bit 取数：一次 LDM 取 8 像素，再拆成 16-bit 写总线 */
+    if ((((uint32_t)src) & 0x3U) != 0U)
+    {
+        LCD_WR_DATA(*src++);
+        count--;
+    }
+
+    const lcd_u32_alias_t *src32 = (const lcd_u32_alias_t *)(const void *)src;
+    while (count >= 8U)
+    {
+        const uint32_t a = src32[0];
+        const uint32_t b = src32[1];
+        const uint32_t c = src32[2];
+        const uint32_t d = src32[3];
+        src32 += 4;
+
+        /* 小端：低半字为前一个像素 */
+        LCD_WR_DATA((uint16_t)a);
+        LCD_WR_DATA((uint16_t)(a >> 16));
+        LCD_WR_DATA((uint16_t)b);
+        LCD_WR_DATA((uint16_t)(b >> 16));
+        LCD_WR_DATA((uint16_t)c);
+        LCD_WR_DATA((uint16_t)(c >> 16));
+        LCD_WR_DATA((uint16_t)d);
+        LCD_WR_DATA((uint16_t)(d >> 16));
+        count -= 8U;
+    }
+
+    src = (const lcd_color565_t *)(const void *)src32;
+    while (count != 0U)
+    {
+        LCD_WR_DATA(*src++);
+        count--;
+    }
+}
+
+static void lcd_push_pixels(const lcd_color565_t *src, uint32_t count)
+{
+#if LCD_DMA_ENABLE
+    if ((count >= LCD_DMA_BLIT_MIN_PIXELS) && lcd_dma_addr_ok(src))
+    {
+        (void)lcd_dma_start(src, true, &LCD_DATA_REG, false, count, 0, 0);
+        lcd_dma_wait();
+        return;
+    }
+#endif
+
+    lcd_write_pixels(src, count);
+}
+
+void lcd_blit_stride(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     const lcd_color565_t *src, uint16_t stride)
+{
+    if ((src == 0) || (stride < w))
+    {
+        return;
+    }
+
+    /* 坐标为无符号，裁剪只会截掉右/下部分，源起点不变 */
+    if (!lcd_clip_rect_u16(&x, &y, &w, &h, lcd_w, lcd_h))
+    {
+        return;
+    }
+
+    lcd_set_window(x, y, w, h);
+
+    if (stride == w)
+    {
+        lcd_push_pixels(src, (uint32_t)w * (uint32_t)h);
+        return;
+    }
+
+    /* 窗口内自动换行，逐行推送即可，无需重设窗口 */
+    for (uint16_t row = 0U; row < h; row++)
+    {
+        lcd_push_pixels(src, w);
+        src += stride;
+    }
+}
+
+void lcd_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const lcd_color565_t *src)
+{
+    lcd_blit_stride(x, y, w, h, src, w);
+}
+
 void lcd_clear(lcd_color565_t color)
 {
-    lcd_fill_rect(0U, 0U, (uint16_t)LCD_PANEL_WIDTH, (uint16_t)LCD_PANEL_HEIGHT, color);
+    lcd_fill_rect(0U, 0U, lcd_w, lcd_h, color);
+}
+
+/* ============================= FSMC 时序校准 ============================= */
+
+typedef struct
+{
+    uint8_t addset;
+    uint8_t datast;
+} lcd_fsmc_step_t;
+
+/* 写：从快到慢，单次写周期约 ADDSET + DATAST + 1 个 HCLK；末档即默认保守值 */
+static const lcd_fsmc_step_t lcd_fsmc_write_steps[] = {
+    {0U, 1U}, {1U, 1U}, {1U, 2U}, {2U, 2U}, {2U, 3U}, {3U, 4U},
+    {4U, 5U}, {5U, 7U}, {8U, 10U}, {LCD_FSMC_WRITE_ADDSET, LCD_FSMC_WRITE_DATAST},
+};
+
+/* 读：面板读访问明显慢于写（RD 低电平时间由 DATAST 决定）；末档即默认保守值 */
+static const lcd_fsmc_step_t lcd_fsmc_read_steps[] = {
+    {0U, 4U}, {1U, 8U}, {2U, 12U}, {3U, 16U}, {4U, 24U},
+    {6U, 32U}, {8U, 48U}, {10U, 64U}, {LCD_FSMC_READ_ADDSET, LCD_FSMC_READ_DATAST},
+};
+
+#define LCD_FSMC_WRITE_STEP_COUNT (sizeof(lcd_fsmc_write_steps) / sizeof(lcd_fsmc_write_steps[0]))
+#define LCD_FSMC_READ_STEP_COUNT  (sizeof(lcd_fsmc_read_steps) / sizeof(lcd_fsmc_read_steps[0]))
+
+#define LCD_FSMC_CAL_PIXELS   (LCD_FSMC_CAL_SIZE * LCD_FSMC_CAL_SIZE)
+#define LCD_FSMC_CAL_PATTERNS (4U)
+
+static lcd_color565_t lcd_cal_buf[LCD_FSMC_CAL_PIXELS];
+
+static lcd_color565_t lcd_cal_pattern(uint32_t kind, uint32_t i)
+{
+    switch (kind)
+    {
+    case 0U: return ((i & 1U) != 0U) ? 0xFFFFU : 0x0000U;         /* 全部位同时翻转 */
+    case 1U: return ((i & 1U) != 0U) ? 0xAAAAU : 0x5555U;         /* 相邻数据线反相 */
+    case 2U: return (lcd_color565_t)(1UL << (i & 0xFU));          /* walking one */
+    default: return (lcd_color565_t)((i * 0x9E37UL) ^ (i >> 3)); /* 伪随机 */
+    }
+}
+
+/*
+ * 命令与读回使用 base 时序；仅像素数据写入使用 data 时序。
+ * 这样写时序过快时只会写错 GRAM，不会把命令写乱。
+ */
+static bool lcd_cal_check(const lcd_fsmc_timing_t *base, const lcd_fsmc_timing_t *data)
+{
+    for (uint32_t rep = 0U; rep < LCD_FSMC_CAL_REPEAT; rep++)
+    {
+        for (uint32_t kind = 0U; kind < LCD_FSMC_CAL_PATTERNS; kind++)
+        {
+            lcd_set_address(0U, 0U, (uint16_t)LCD_FSMC_CAL_SIZE, (uint16_t)LCD_FSMC_CAL_SIZE);
+            lcd_write_cmd(0x2C);
+
+            lcd_fsmc_apply_timing(data);
+            for (uint32_t i = 0U; i < LCD_FSMC_CAL_PIXELS; i++)
+            {
+                LCD_WR_DATA(lcd_cal_pattern(kind + rep, i));
+            }
+            lcd_fsmc_apply_timing(base);
+
+            lcd_read_gram(0U, 0U, (uint16_t)LCD_FSMC_CAL_SIZE, (uint16_t)LCD_FSMC_CAL_SIZE, lcd_cal_buf);
+            for (uint32_t i = 0U; i < LCD_FSMC_CAL_PIXELS; i++)
+            {
+                if (lcd_cal_buf[i] != lcd_cal_pattern(kind + rep, i))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static void lcd_cal_set_step(lcd_fsmc_timing_t *t, const lcd_fsmc_step_t *step, bool write)
+{
+    if (write)
+    {
+        t->write_addset = step->addset;
+        t->write_datast = step->datast;
+    }
+    else
+    {
+        t->read_addset = step->addset;
+        t->read_datast = step->datast;
+    }
+}
+
+/*
+ * 从快到慢扫描，返回最快且“本档 + 余量档”都通过的档位；全部失败返回 count。
+ * t 为工作时序：扫描读时 t 的写部分为保守值；扫描写时 t 的读部分已确定。
+ */
+static uint32_t lcd_cal_search(const lcd_fsmc_step_t *steps, uint32_t count, bool write,
+                               const lcd_fsmc_timing_t *t)
+{
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint32_t margin = i + LCD_FSMC_CAL_MARGIN_STEPS;
+        if (margin >= count)
+        {
+            margin = count - 1U;
+        }
+
+        bool pass = true;
+        const uint32_t probe[2] = {i, margin};
+        for (uint32_t k = 0U; (k < 2U) && pass; k++)
+        {
+            lcd_fsmc_timing_t data = *t;
+            lcd_cal_set_step(&data, &steps[probe[k]], write);
+            /* 扫描读时序时命令/读回都使用候选读时序；扫描写时序时仅数据使用候选写时序 */
+            pass = lcd_cal_check(write ? t : &data, &data);
+        }
+
+        if (pass)
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+bool lcd_fsmc_calibrate(lcd_fsmc_cal_result_t *out)
+{
+    lcd_fsmc_cal_result_t res = {0};
+    lcd_fsmc_timing_t orig;
+    lcd_fsmc_timing_t work;
+
+    lcd_dma_wait();
+    lcd_fsmc_get_timing(&orig);
+
+    /* 过快的时序可能干扰控制器状态：校准前后都不信任影子状态 */
+    lcd_cmd_invalidate();
+
+    /* 1) 读时序：写使用保守值 */
+    work = orig;
+    lcd_cal_set_step(&work, &lcd_fsmc_write_steps[LCD_FSMC_WRITE_STEP_COUNT - 1U], true);
+    const uint32_t rd = lcd_cal_search(lcd_fsmc_read_steps, LCD_FSMC_READ_STEP_COUNT, false, &work);
+    if (rd >= LCD_FSMC_READ_STEP_COUNT)
+    {
+        /* 读回始终不一致（读格式不匹配或硬件问题），保持原时序 */
+        lcd_fsmc_apply_timing(&orig);
+        lcd_cmd_invalidate();
+        if (out != 0)
+        {
+            *out = res;
+        }
+        return false;
+    }
+
+    uint32_t rd_applied = rd + LCD_FSMC_CAL_MARGIN_STEPS;
+    if (rd_applied >= LCD_FSMC_READ_STEP_COUNT)
+    {
+        rd_applied = LCD_FSMC_READ_STEP_COUNT - 1U;
+    }
+    lcd_cal_set_step(&res.fastest, &lcd_fsmc_read_steps[rd], false);
+    lcd_cal_set_step(&work, &lcd_fsmc_read_steps[rd_applied], false);
+    lcd_fsmc_apply_timing(&work);
+
+    /* 2) 写时序：读已确定；末档为保守值，理论上必然通过 */
+    uint32_t wr = lcd_cal_search(lcd_fsmc_write_steps, LCD_FSMC_WRITE_STEP_COUNT, true, &work);
+    if (wr >= LCD_FSMC_WRITE_STEP_COUNT)
+    {
+        wr = LCD_FSMC_WRITE_STEP_COUNT - 1U;
+    }
+
+    uint32_t wr_applied = wr + LCD_FSMC_CAL_MARGIN_STEPS;
+    if (wr_applied >= LCD_FSMC_WRITE_STEP_COUNT)
+    {
+        wr_applied = LCD_FSMC_WRITE_STEP_COUNT - 1U;
+    }
+    lcd_cal_set_step(&res.fastest, &lcd_fsmc_write_steps[wr], true);
+    lcd_cal_set_step(&work, &lcd_fsmc_write_steps[wr_applied], true);
+    lcd_fsmc_apply_timing(&work);
+    res.applied = work;
+
+    /* 3) 实测写带宽：DWT 周期计数，窗口内循环写 */
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+
+    lcd_set_window(0U, 0U, (uint16_t)LCD_FSMC_CAL_SIZE, (uint16_t)LCD_FSMC_CAL_SIZE);
+    const uint32_t t0 = DWT->CYCCNT;
+    for (uint32_t i = 0U; i < LCD_FSMC_CAL_BW_PIXELS; i++)
+    {
+        LCD_WR_DATA(0x0000U);
+    }
+    __DSB();
+    res.write_cycles = DWT->CYCCNT - t0;
+    res.write_pixels = LCD_FSMC_CAL_BW_PIXELS;
+    if (res.write_cycles != 0U)
+    {
+        res.write_mpix_x100 = (uint32_t)(((uint64_t)LCD_FSMC_CAL_BW_PIXELS * (SystemCoreClock / 10000U)) /
+                                         res.write_cycles);
+    }
+
+    lcd_cmd_invalidate();
+
+    res.ok = true;
+    if (out != 0)
+    {
+        *out = res;
+    }
+    return true;
 }
 
 void lcd_panel_init(void)
@@ -428,8 +1257,7 @@ void lcd_panel_init(void)
     lcd_write_u8(0x07);
     lcd_write_u8(0x80);
 
-    lcd_write_cmd(0x36); /* MADCTL */
-    lcd_write_u8(0x4C);
+    lcd_set_rotation(LCD_ROTATION_0); /* MADCTL 0x4C */
 
     lcd_write_cmd(0xC1);
     lcd_write_u8(0x10);
@@ -16,12 +16,14 @@ extern "C" {
 
 /* ============================= 面板参数（HX8357D） ============================= */
 /**
- * @brief HX8357D 典型 3.5" TFT 分辨率（竖屏/Portrait）。
+ * @brief HX8357D 典型 3.5" TFT 物理分辨率（竖屏/Portrait）。
  *
- * 说明：若后续支持旋转（MADCTL），可在中上层维护当前 width/height。
+ * 运行时的逻辑宽高随 lcd_set_rotation() 变化，绘图与裁剪以 lcd_width()/lcd_height() 为准；
+ * 行缓冲区等静态数组按长边 LCD_PANEL_LONG_SIDE 分配。
  */
-#define LCD_PANEL_WIDTH  (320U)
-#define LCD_PANEL_HEIGHT (480U)
+#define LCD_PANEL_WIDTH     (320U)
+#define LCD_PANEL_HEIGHT    (480U)
+#define LCD_PANEL_LONG_SIDE (LCD_PANEL_HEIGHT)
 
 typedef uint16_t lcd_color565_t;
 
@@ -56,6 +58,139 @@ uint16_t lcd_read_data(void);
 /** @brief 读数据（先 dummy read 一次，再返回第二次读到的数据）。 */
 uint16_t lcd_read_data_dummy(void);
 
+/* ============================= 命令合并（影子状态） ============================= */
+
+/**
+ * @brief 命令层统计：窗口/MADCTL 与上次相同则不再发送，lcd_draw_pixel() 利用 GRAM 地址自动递增。
+ *
+ * 详见: src/lcd/lcd.md 第 17 节
+ */
+typedef struct
+{
+    uint32_t issued;      /* 实际发出的命令 + 参数总线写（不含像素数据） */
+    uint32_t saved;       /* 因影子状态命中而省掉的总线写 */
+    uint32_t window_hits; /* 0x2A 或 0x2B 被跳过的次数 */
+    uint32_t cursor_hits; /* lcd_draw_pixel() 免发窗口、只写 1 个数据字的次数 */
+} lcd_cmd_stats_t;
+
+void lcd_cmd_get_stats(lcd_cmd_stats_t *out);
+void lcd_cmd_reset_stats(void);
+
+/**
+ * @brief 丢弃影子状态，下一次窗口/MADCTL 设置必定完整发送。
+ *
+ * 硬件复位、0x01 软件复位以及通过 lcd_write_cmd() 直接发送 0x2A/0x2B/0x36 时会自动失效；
+ * 绕过本驱动改写控制器状态后需手动调用。
+ */
+void lcd_cmd_invalidate(void);
+
+/** @brief 写 MADCTL(0x36)，与当前值相同时跳过。 */
+void lcd_set_madctl(uint8_t madctl);
+
+/* ============================= 显示方向 ============================= */
+
+/** 顺时针旋转角度；0 为竖屏（FPC 在下方），90/270 为横屏 480×320。 */
+typedef enum
+{
+    LCD_ROTATION_0 = 0,
+    LCD_ROTATION_90,
+    LCD_ROTATION_180,
+    LCD_ROTATION_270,
+} lcd_rotation_t;
+
+/**
+ * @brief 改写 MADCTL（0x4C / 0x2C / 0x8C / 0xEC）并更新逻辑宽高与裁剪范围。
+ *
+ * 旋转由控制器的地址扫描顺序完成，lcd_blit() 等写入的数据仍按逻辑坐标行优先排列，无需软件转置。
+ * 已显示的内容不会随之旋转，切换后应重绘。lcd_panel_init() 恢复为 LCD_ROTATION_0。
+ */
+void lcd_set_rotation(lcd_rotation_t rot);
+lcd_rotation_t lcd_get_rotation(void);
+
+/** 当前方向下的逻辑宽 / 高（像素）。 */
+uint16_t lcd_width(void);
+uint16_t lcd_height(void);
+
+/* ============================= 硬件垂直滚动 ============================= */
+
+/**
+ * @brief 0x33 Vertical Scrolling Definition：上固定区 tfa 行 + 滚动区 vsa 行 + 下固定区 bfa 行。
+ *
+ * 行指面板扫描方向（LCD_ROTATION_0 下即 y），与当前旋转无关；三者之和必须等于 LCD_PANEL_HEIGHT，否则不发送并返回 false。
+ */
+bool lcd_set_scroll_area(uint16_t tfa, uint16_t vsa, uint16_t bfa);
+
+/**
+ * @brief 0x37 Vertical Scrolling Start Address：滚动区第一条显示行对应的 GRAM 行（tfa <= vsp < tfa + vsa）。
+ *
+ * 只改变 GRAM -> 显示行的映射，绘图仍按 GRAM 坐标进行。
+ */
+void lcd_set_scroll_start(uint16_t vsp);
+
+/** 恢复整屏滚动区与起始行 0，并发送 0x13（Normal Display Mode On）退出滚动。 */
+void lcd_scroll_off(void);
+
+/* ============================= 撕裂效应（TE）/ 扫描行 ============================= */
+
+/** 0x35（TELOM = 0，只在 V-blank/设定扫描行输出脉冲）/ 0x34 关闭 TE 输出。 */
+void lcd_set_tear_on(bool on);
+
+/** 0x44 Set Tear Scanline：扫描到第 line 行（面板扫描方向，0..LCD_PANEL_HEIGHT-1）时输出 TE 脉冲。 */
+void lcd_set_tear_scanline(uint16_t line);
+
+/**
+ * @brief 0x45 Get Scanline：读回控制器当前扫描行（面板扫描方向，与旋转无关）。
+ *
+ * TE 引脚未接到 MCU 时可轮询本函数代替中断；每次约 5 个总线周期。
+ */
+uint16_t lcd_get_scanline(void);
+
+/* ============================= FSMC 时序（运行时调整） ============================= */
+
+/**
+ * @brief NE4 读/写时序（单位：HCLK 周期，168MHz 下约 5.95ns）。
+ *
+ * ADDHLD/BUSTURN/ACCMOD 固定取 lcd.c 中的宏值，只开放对吞吐率影响最大的两项。
+ */
+typedef struct
+{
+    uint8_t read_addset;  /* 0..15 */
+    uint8_t read_datast;  /* 1..255 */
+    uint8_t write_addset; /* 0..15 */
+    uint8_t write_datast; /* 1..255 */
+} lcd_fsmc_timing_t;
+
+/** @brief 读取当前 BTR4/BWTR4 中的时序。 */
+void lcd_fsmc_get_timing(lcd_fsmc_timing_t *timing);
+
+/** @brief 写入 BTR4/BWTR4（立即生效，调用前需确保 LCD 总线空闲）。 */
+void lcd_fsmc_set_timing(const lcd_fsmc_timing_t *timing);
+
+/** @brief lcd_fsmc_calibrate() 的结果。 */
+typedef struct
+{
+    bool ok;                    /* false：读回始终不一致，已恢复原时序 */
+    lcd_fsmc_timing_t fastest;  /* 通过全部测试图样的最快时序 */
+    lcd_fsmc_timing_t applied;  /* 加上余量后实际写入的时序 */
+    uint32_t write_cycles;      /* 带宽测量：写 write_pixels 个像素耗时（HCLK 周期） */
+    uint32_t write_pixels;
+    uint32_t write_mpix_x100;   /* 实测写带宽：MPix/s × 100 */
+} lcd_fsmc_cal_result_t;
+
+/**
+ * @brief FSMC 时序自动校准（需在 lcd_panel_init() 之后调用）。
+ *
+ * 流程：
+ * 1) 以保守写时序写入测试图样，读时序从快到慢扫描，Memory Read(0x2E) 读回比对，确定读时序；
+ * 2) 读时序固定（含余量）后，写时序从快到慢扫描，同样写入/读回比对，确定写时序；
+ * 3) 在最快稳定档位基础上再放慢 LCD_FSMC_CAL_MARGIN_STEPS 档写入 BTR4/BWTR4，并实测写带宽。
+ *
+ * 注意：测试会覆盖屏幕左上角 LCD_FSMC_CAL_SIZE×LCD_FSMC_CAL_SIZE 区域。
+ *
+ * @return 校准成功返回 true（out 可为 NULL）。
+ */
+bool lcd_fsmc_calibrate(lcd_fsmc_cal_result_t *out);
+
 /* ============================= 中上层（面板层：HX8357D） ============================= */
 
 /**
@@ -73,19 +208,66 @@ void lcd_panel_init(void);
  *
  * 坐标系：左上角(0,0)，x 向右，y 向下。
  * 参数：x,y 为左上角；w,h 为宽高。
- * 默认裁剪到 [0..LCD_PANEL_WIDTH)×[0..LCD_PANEL_HEIGHT)。
+ * 默认裁剪到 [0..lcd_width())×[0..lcd_height())。
  */
 void lcd_set_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 
-/** 清屏（填充全屏为指定 RGB565 颜色）。 */
+/**
+ * @brief 将矩形裁剪到屏幕范围内（原地修改）。
+ * @return 裁剪后仍有可见区域返回 true；完全越界或 w/h 为 0 返回 false。
+ */
+bool lcd_clip_rect(uint16_t *x, uint16_t *y, uint16_t *w, uint16_t *h);
+
+/** 清屏（填充全屏为指定 RGB565 颜色），与 lcd_fill_rect() 一样不等 DMA 完成。 */
 void lcd_clear(lcd_color565_t color);
 
-/** 填充矩形（RGB565），默认裁剪。 */
+/**
+ * @brief 填充矩形（RGB565），默认裁剪。
+ *
+ * 走 DMA 时启动后立即返回，GRAM 在后台写完；之后任何命令 / 窗口设置都会先等待 DMA 结束，
+ * 需要确认写完（例如计时）时调用 lcd_dma_wait()。
+ */
 void lcd_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, lcd_color565_t color);
 
-/** 画一个像素点（RGB565），默认裁剪。 */
+/**
+ * @brief 画一个像素点（RGB565），默认裁剪。
+ *
+ * 窗口设为“本行剩余部分”：同一行向右连续画点时，后续像素只写 1 个数据字。
+ */
 void lcd_draw_pixel(uint16_t x, uint16_t y, lcd_color565_t color);
 
+/**
+ * @brief 向当前窗口连续写入 count 个像素（CPU 展开写，不设置窗口）。
+ *
+ * 需先调用 lcd_set_window()；可多次调用分批推送同一窗口的数据。
+ */
+void lcd_write_pixels(const lcd_color565_t *src, uint32_t count);
+
+/**
+ * @brief 把 w*h 的 RGB565 缓冲区（行优先、连续存放）写到 (x,y)，默认裁剪。
+ *
+ * 只设置一次窗口；像素数较多且缓冲区 DMA 可达时走 DMA2，否则走 CPU 展开写。
+ */
+void lcd_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const lcd_color565_t *src);
+
+/**
+ * @brief 同 lcd_blit()，但源缓冲区每行间隔 stride 个像素（stride >= w），
+ *        可直接从大图/帧缓冲区中截取子区域。
+ */
+void lcd_blit_stride(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     const lcd_color565_t *src, uint16_t stride);
+
+/**
+ * @brief 从 GRAM 读回矩形区域到 dst（w*h 个 RGB565，行优先连续存放）。
+ *
+ * 发送 0x2A/0x2B/0x2E，丢弃首个 dummy read，并按 LCD_GRAM_READ_FORMAT 把
+ * 16-bit 或 18-bit(每 2 像素 3 字) 读出格式统一转换为 RGB565。
+ * 像素数较多且 dst 可被 DMA 访问时走 DMA2（边读边转换）。
+ *
+ * @return 矩形需完全位于屏幕内，否则不读取并返回 false。
+ */
+bool lcd_read_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, lcd_color565_t *dst);
+
 #ifdef __cplusplus
 }
 #endif
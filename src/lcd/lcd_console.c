@@ -0,0 +1,191 @@
+#include "lcd/lcd_console.h"
+
+typedef struct
+{
+    const font_t *font;
+    lcd_color565_t fg;
+    lcd_color565_t bg;
+    uint16_t top;          /* 滚动区首行（GRAM 行） */
+    uint16_t lines;        /* 滚动区文本行数 */
+    uint16_t cols;         /* 每行字符数 */
+    uint16_t head;         /* 显示在滚动区顶部的文本行（GRAM 中的序号） */
+    uint16_t row;          /* 光标所在文本行（GRAM 中的序号） */
+    uint16_t used;         /* 已使用的文本行数（含光标行），到 lines 后开始滚动 */
+    uint16_t col;          /* 光标列 */
+    uint16_t drawn;        /* 本行已上屏的字符数 */
+    bool active;
+    char line[LCD_CONSOLE_MAX_COLS + 1U];
+} lcd_console_t;
+
+static lcd_console_t lcd_console;
+
+static uint16_t lcd_console_row_y(uint16_t row)
+{
+    return (uint16_t)(lcd_console.top + (row * lcd_console.font->height));
+}
+
+/* 把本行尚未上屏的字符一次画出（一次窗口） */
+static void lcd_console_flush(void)
+{
+    if (lcd_console.col > lcd_console.drawn)
+    {
+        font_draw_string((uint16_t)(lcd_console.drawn * lcd_console.font->width),
+                         lcd_console_row_y(lcd_console.row), &lcd_console.line[lcd_console.drawn],
+                         lcd_console.font, lcd_console.fg, lcd_console.bg);
+        lcd_console.drawn = lcd_console.col;
+    }
+}
+
+static void lcd_console_home(void)
+{
+    lcd_console.col = 0U;
+    lcd_console.drawn = 0U;
+    lcd_console.line[0] = '\0';
+}
+
+static void lcd_console_newline(void)
+{
+    lcd_console_flush();
+    lcd_console_home();
+
+    lcd_console.row = (uint16_t)((lcd_console.row + 1U) % lcd_console.lines);
+
+    if (lcd_console.used < lcd_console.lines)
+    {
+        /* 滚动区还没写满：新行在 init/clear 时已清空 */
+        lcd_console.used++;
+        return;
+    }
+
+    /* 写满：最旧的一行（当前顶部）清空后作为新的底行，再把显示起点下移一行 */
+    lcd_fill_rect(0U, lcd_console_row_y(lcd_console.row), LCD_PANEL_WIDTH, lcd_console.font->height,
+                  lcd_console.bg);
+    lcd_console.head = (uint16_t)((lcd_console.head + 1U) % lcd_console.lines);
+    lcd_set_scroll_start(lcd_console_row_y(lcd_console.head));
+}
+
+/* 只更新行缓冲区，不上屏 */
+static void lcd_console_put(char c)
+{
+    if (c == '\n')
+    {
+        lcd_console_newline();
+        return;
+    }
+    if (c == '\r')
+    {
+        lcd_console_flush();
+        lcd_console_home();
+        return;
+    }
+
+    if (lcd_console.col >= lcd_console.cols)
+    {
+        lcd_console_newline();
+    }
+    lcd_console.line[lcd_console.col] = c;
+    lcd_console.col++;
+    lcd_console.line[lcd_console.col] = '\0';
+}
+
+bool lcd_console_init(const font_t *font, uint16_t top, uint16_t bottom,
+                      lcd_color565_t fg, lcd_color565_t bg)
+{
+    uint32_t vsa;
+    uint32_t cols;
+
+    lcd_console.active = false;
+
+    if ((font == 0) || (font->width == 0U) || (font->height == 0U)
+        || (lcd_get_rotation() != LCD_ROTATION_0) || (((uint32_t)top + bottom) >= LCD_PANEL_HEIGHT))
+    {
+        return false;
+    }
+
+    vsa = LCD_PANEL_HEIGHT - top - bottom;
+    if (vsa < font->height)
+    {
+        return false;
+    }
+
+    cols = LCD_PANEL_WIDTH / font->width;
+    if (cols > LCD_CONSOLE_MAX_COLS)
+    {
+        cols = LCD_CONSOLE_MAX_COLS;
+    }
+
+    lcd_console.font = font;
+    lcd_console.fg = fg;
+    lcd_console.bg = bg;
+    lcd_console.top = top;
+    lcd_console.lines = (uint16_t)(vsa / font->height);
+    lcd_console.cols = (uint16_t)cols;
+    lcd_console.active = true;
+
+    lcd_console_clear();
+    return true;
+}
+
+void lcd_console_set_color(lcd_color565_t fg, lcd_color565_t bg)
+{
+    /* 已缓冲的字符按原颜色画出 */
+    lcd_console_flush();
+    lcd_console.fg = fg;
+    lcd_console.bg = bg;
+}
+
+void lcd_console_clear(void)
+{
+    uint16_t vsa;
+
+    if (!lcd_console.active)
+    {
+        return;
+    }
+
+    vsa = (uint16_t)(lcd_console.lines * lcd_console.font->height);
+
+    lcd_fill_rect(0U, lcd_console.top, LCD_PANEL_WIDTH, vsa, lcd_console.bg);
+    (void)lcd_set_scroll_area(lcd_console.top, vsa, (uint16_t)(LCD_PANEL_HEIGHT - lcd_console.top - vsa));
+    lcd_set_scroll_start(lcd_console.top);
+
+    lcd_console.head = 0U;
+    lcd_console.row = 0U;
+    lcd_console.used = 1U;
+    lcd_console_home();
+}
+
+void lcd_console_putc(char c)
+{
+    if (!lcd_console.active)
+    {
+        return;
+    }
+    lcd_console_put(c);
+    lcd_console_flush();
+}
+
+void lcd_console_write(const char *str)
+{
+    if (!lcd_console.active || (str == 0))
+    {
+        return;
+    }
+    while (*str != '\0')
+    {
+        lcd_console_put(*str);
+        str++;
+    }
+    lcd_console_flush();
+}
+
+void lcd_console_deinit(void)
+{
+    if (!lcd_console.active)
+    {
+        return;
+    }
+    lcd_console_flush();
+    lcd_scroll_off();
+    lcd_console.active = false;
+}
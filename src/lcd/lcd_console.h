@@ -0,0 +1,62 @@
+#ifndef LCD_LCD_CONSOLE_H
+#define LCD_LCD_CONSOLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "font/font.h"
+#include "lcd/lcd.h"
+
+/**
+ * @brief 基于 HX8357D 硬件垂直滚动（0x33/0x37）的文本控制台，用于设备上的日志视图。
+ *
+ * 屏幕按行分为：上固定区（top 行，标题栏等，控制台不触碰）+ 滚动区 + 下固定区（bottom 行）。
+ * 滚动区按字体高度划分为若干文本行，在 GRAM 中循环使用：写满后再换行，只需清空最旧的一行
+ * 并写一次 0x37 滚动起始地址，其余内容不重绘，代价与屏幕内容无关。
+ *
+ * - 单实例；要求 LCD_ROTATION_0：控制器的“垂直”滚动沿面板扫描方向，与 lcd_set_rotation() 无关
+ * - 控制台启用期间滚动区内 GRAM 行与显示行不再一一对应，不要在滚动区内直接绘图
+ *
+ * 详见: src/lcd/lcd.md 第 18 节
+ */
+
+/** 每行最多字符数（行缓冲区大小），按最窄 6 像素字宽估计。 */
+#ifndef LCD_CONSOLE_MAX_COLS
+#define LCD_CONSOLE_MAX_COLS (LCD_PANEL_WIDTH / 6U)
+#endif
+
+/**
+ * @brief 初始化控制台：清空滚动区、设置滚动区并复位滚动起始地址。
+ *
+ * 滚动区高度向下取整为字体高度的整数倍，零头并入下固定区。
+ * @return 参数无效（字体为空、固定区占满屏幕、放不下一行文本）或当前不是 LCD_ROTATION_0 时返回 false。
+ */
+bool lcd_console_init(const font_t *font, uint16_t top, uint16_t bottom,
+                      lcd_color565_t fg, lcd_color565_t bg);
+
+/** 后续文本的前景/背景色。 */
+void lcd_console_set_color(lcd_color565_t fg, lcd_color565_t bg);
+
+/**
+ * @brief 输出一个字符：'\n' 换行（必要时滚动），'\r' 回到行首，行满自动换行。
+ */
+void lcd_console_putc(char c);
+
+/** 输出字符串：同一行连续的字符合并为一次 font_draw_string()。 */
+void lcd_console_write(const char *str);
+
+/** 清空滚动区，光标回到第一行。 */
+void lcd_console_clear(void);
+
+/** 退出滚动模式（lcd_scroll_off()）；滚动区内容需由调用方重绘。 */
+void lcd_console_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCD_LCD_CONSOLE_H */
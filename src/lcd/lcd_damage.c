@@ -0,0 +1,191 @@
+#include "lcd_damage.h"
+
+/* 内部用半开区间 [x0,x1)×[y0,y1)，便于求外接矩形与面积 */
+typedef struct
+{
+    uint16_t x0;
+    uint16_t y0;
+    uint16_t x1;
+    uint16_t y1;
+} lcd_damage_box_t;
+
+static lcd_damage_box_t lcd_damage_boxes[LCD_DAMAGE_MAX_RECTS];
+static uint32_t lcd_damage_n = 0U;
+static lcd_damage_stats_t lcd_damage_stats;
+
+static uint32_t lcd_damage_area(const lcd_damage_box_t *b)
+{
+    return (uint32_t)(b->x1 - b->x0) * (uint32_t)(b->y1 - b->y0);
+}
+
+static lcd_damage_box_t lcd_damage_union(const lcd_damage_box_t *a, const lcd_damage_box_t *b)
+{
+    lcd_damage_box_t u;
+    u.x0 = (a->x0 < b->x0) ? a->x0 : b->x0;
+    u.y0 = (a->y0 < b->y0) ? a->y0 : b->y0;
+    u.x1 = (a->x1 > b->x1) ? a->x1 : b->x1;
+    u.y1 = (a->y1 > b->y1) ? a->y1 : b->y1;
+    return u;
+}
+
+/*
+ * 合并 a、b 的代价增量：cost(bbox) - cost(a) - cost(b)
+ *   = area(bbox) - area(a) - area(b) - LCD_DAMAGE_RECT_COST
+ * <= 0 表示合并不亏（少一次窗口设置抵得过多刷的像素）。
+ */
+static int32_t lcd_damage_merge_delta(const lcd_damage_box_t *a, const lcd_damage_box_t *b)
+{
+    const lcd_damage_box_t u = lcd_damage_union(a, b);
+    return (int32_t)lcd_damage_area(&u) - (int32_t)lcd_damage_area(a) -
+           (int32_t)lcd_damage_area(b) - (int32_t)LCD_DAMAGE_RECT_COST;
+}
+
+static void lcd_damage_remove(uint32_t i)
+{
+    lcd_damage_n--;
+    lcd_damage_boxes[i] = lcd_damage_boxes[lcd_damage_n];
+}
+
+void lcd_damage_clear(void)
+{
+    lcd_damage_n = 0U;
+}
+
+void lcd_damage_add(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if (!lcd_clip_rect(&x, &y, &w, &h))
+    {
+        return;
+    }
+
+    lcd_damage_stats.added++;
+
+    lcd_damage_box_t nb = {x, y, (uint16_t)(x + w), (uint16_t)(y + h)};
+
+    /* 反复吸收“合并不亏”的已有矩形：合并后外接矩形变大，可能又能与别的矩形合并 */
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (uint32_t i = 0U; i < lcd_damage_n; i++)
+        {
+            /* 包含关系的增量必为负，同样走这里 */
+            if (lcd_damage_merge_delta(&nb, &lcd_damage_boxes[i]) <= 0)
+            {
+                nb = lcd_damage_union(&nb, &lcd_damage_boxes[i]);
+                lcd_damage_remove(i);
+                lcd_damage_stats.merges++;
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    if (lcd_damage_n >= LCD_DAMAGE_MAX_RECTS)
+    {
+        /* 集合已满：并入代价增量最小的矩形 */
+        uint32_t best = 0U;
+        int32_t best_delta = INT32_MAX;
+        for (uint32_t i = 0U; i < lcd_damage_n; i++)
+        {
+            const int32_t d = lcd_damage_merge_delta(&nb, &lcd_damage_boxes[i]);
+            if (d < best_delta)
+            {
+                best_delta = d;
+                best = i;
+            }
+        }
+
+        nb = lcd_damage_union(&nb, &lcd_damage_boxes[best]);
+        lcd_damage_remove(best);
+        lcd_damage_stats.merges++;
+    }
+
+    lcd_damage_boxes[lcd_damage_n++] = nb;
+}
+
+void lcd_damage_add_all(void)
+{
+    lcd_damage_n = 0U;
+    lcd_damage_add(0U, 0U, lcd_width(), lcd_height());
+}
+
+uint32_t lcd_damage_count(void)
+{
+    return lcd_damage_n;
+}
+
+uint32_t lcd_damage_pixels(void)
+{
+    uint32_t sum = 0U;
+    for (uint32_t i = 0U; i < lcd_damage_n; i++)
+    {
+        sum += lcd_damage_area(&lcd_damage_boxes[i]);
+    }
+    return sum;
+}
+
+void lcd_damage_for_each(lcd_damage_fn_t fn, void *ctx)
+{
+    for (uint32_t i = 0U; i < lcd_damage_n; i++)
+    {
+        const lcd_damage_box_t *b = &lcd_damage_boxes[i];
+        const lcd_damage_rect_t r = {
+            .x = b->x0,
+            .y = b->y0,
+            .w = (uint16_t)(b->x1 - b->x0),
+            .h = (uint16_t)(b->y1 - b->y0),
+        };
+
+        lcd_damage_stats.flushed_rects++;
+        lcd_damage_stats.flushed_pixels += lcd_damage_area(b);
+
+        if (fn != 0)
+        {
+            fn(&r, ctx);
+        }
+    }
+
+    lcd_damage_n = 0U;
+}
+
+typedef struct
+{
+    const lcd_color565_t *src;
+    uint16_t stride;
+} lcd_damage_src_t;
+
+static void lcd_damage_blit_rect(const lcd_damage_rect_t *r, void *ctx)
+{
+    const lcd_damage_src_t *s = (const lcd_damage_src_t *)ctx;
+    lcd_blit_stride(r->x, r->y, r->w, r->h,
+                    s->src + ((uint32_t)r->y * s->stride) + r->x, s->stride);
+}
+
+void lcd_damage_flush(const lcd_color565_t *src, uint16_t stride)
+{
+    if ((src == 0) || (stride < lcd_width()))
+    {
+        lcd_damage_n = 0U;
+        return;
+    }
+
+    lcd_damage_src_t s = {src, stride};
+    lcd_damage_for_each(lcd_damage_blit_rect, &s);
+}
+
+void lcd_damage_get_stats(lcd_damage_stats_t *out)
+{
+    if (out != 0)
+    {
+        *out = lcd_damage_stats;
+    }
+}
+
+void lcd_damage_reset_stats(void)
+{
+    lcd_damage_stats.added = 0U;
+    lcd_damage_stats.merges = 0U;
+    lcd_damage_stats.flushed_rects = 0U;
+    lcd_damage_stats.flushed_pixels = 0U;
+}
@@ -0,0 +1,91 @@
+#ifndef LCD_LCD_DAMAGE_H
+#define LCD_LCD_DAMAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lcd/lcd.h"
+
+/**
+ * @brief 脏矩形跟踪与合并：只把真正变化的区域刷到 LCD。
+ *
+ * - lcd_damage_add() 记录失效矩形（自动裁剪），并按代价模型与已有矩形合并：
+ *     cost(rect) = LCD_DAMAGE_RECT_COST + w*h
+ *   若两矩形外接矩形的代价 <= 两者代价之和，则合并（重叠/相邻/很近的矩形都会被合并）。
+ * - 矩形数达到 LCD_DAMAGE_MAX_RECTS 时，新矩形并入使代价增量最小的已有矩形。
+ * - lcd_damage_flush() 对合并后的每个矩形只设置一次窗口，再从源图像批量推送像素。
+ *
+ * 详见: src/lcd/lcd.md 第 14 节
+ */
+
+/** 最多同时跟踪的矩形数。 */
+#ifndef LCD_DAMAGE_MAX_RECTS
+#define LCD_DAMAGE_MAX_RECTS (16U)
+#endif
+
+/**
+ * 每个矩形的固定开销（折算为像素）：
+ * 0x2A/0x2B/0x2C 窗口设置共 11 次总线写，加上 DMA/循环启动开销，默认按 32 像素计。
+ */
+#ifndef LCD_DAMAGE_RECT_COST
+#define LCD_DAMAGE_RECT_COST (32U)
+#endif
+
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+} lcd_damage_rect_t;
+
+/** @brief 统计信息（lcd_damage_reset_stats() 清零）。 */
+typedef struct
+{
+    uint32_t added;          /* lcd_damage_add() 接收的可见矩形数 */
+    uint32_t merges;         /* 合并次数 */
+    uint32_t flushed_rects;  /* 实际刷新的矩形数 */
+    uint32_t flushed_pixels; /* 实际刷新的像素数 */
+} lcd_damage_stats_t;
+
+/** 逐矩形处理回调（用于不依赖源图像的重绘，例如直接调用 lcd_fill_rect()）。 */
+typedef void (*lcd_damage_fn_t)(const lcd_damage_rect_t *rect, void *ctx);
+
+/** @brief 清空当前脏矩形集合。 */
+void lcd_damage_clear(void);
+
+/** @brief 记录一个失效矩形（默认裁剪，完全越界时忽略）。 */
+void lcd_damage_add(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/** @brief 标记整屏失效。 */
+void lcd_damage_add_all(void);
+
+/** @brief 当前（合并后）矩形数。 */
+uint32_t lcd_damage_count(void);
+
+/** @brief 当前（合并后）矩形覆盖的像素总数（即 flush 的像素代价）。 */
+uint32_t lcd_damage_pixels(void);
+
+/**
+ * @brief 把脏区域从源图像刷到 LCD，并清空集合。
+ *
+ * @param src    整屏源图像（行优先，例如 lcd_fb_back()）
+ * @param stride 源图像每行像素数（>= lcd_width()）
+ */
+void lcd_damage_flush(const lcd_color565_t *src, uint16_t stride);
+
+/** @brief 对每个脏矩形调用 fn（同样计入统计），并清空集合。 */
+void lcd_damage_for_each(lcd_damage_fn_t fn, void *ctx);
+
+void lcd_damage_get_stats(lcd_damage_stats_t *out);
+void lcd_damage_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCD_LCD_DAMAGE_H */
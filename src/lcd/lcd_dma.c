@@ -0,0 +1,219 @@
+#include "lcd_dma.h"
+
+#include "stm32f4xx.h"
+
+/* DMA2 Stream0 / Channel0：M2M 模式只有 DMA2 支持，通道号在 M2M 下无意义，取 0 即可。 */
+#define LCD_DMA_STREAM (DMA2_Stream0)
+#define LCD_DMA_IRQN   (DMA2_Stream0_IRQn)
+
+/* CCMRAM 只挂在 D-bus 上，DMA 不可达 */
+#define LCD_DMA_CCMRAM_BASE (0x10000000UL)
+#define LCD_DMA_CCMRAM_END  (0x10010000UL)
+
+/* Stream0 的全部中断标志（LISR/LIFCR 低 6 位） */
+#define LCD_DMA_FLAGS_ALL (DMA_LIFCR_CTCIF0 | DMA_LIFCR_CHTIF0 | DMA_LIFCR_CTEIF0 | \
+                           DMA_LIFCR_CDMEIF0 | DMA_LIFCR_CFEIF0)
+
+typedef struct
+{
+    uint32_t src;
+    uint32_t dst;
+    uint32_t remaining; /* 尚未启动的数据项 */
+    uint32_t chunk;     /* 当前段的数据项 */
+    bool src_inc;
+    bool dst_inc;
+    lcd_dma_done_cb_t cb;
+    void *ctx;
+} lcd_dma_job_t;
+
+static lcd_dma_job_t lcd_dma_job;
+static volatile bool lcd_dma_active = false;
+static volatile uint32_t lcd_dma_errors = 0U;
+
+#if LCD_DMA_ENABLE
+static void lcd_dma_start_chunk(void)
+{
+    lcd_dma_job_t *job = &lcd_dma_job;
+
+    job->chunk = (job->remaining > LCD_DMA_MAX_ITEMS) ? LCD_DMA_MAX_ITEMS : job->remaining;
+    job->remaining -= job->chunk;
+
+    /* M2M：PAR 为源地址，M0AR 为目的地址 */
+    WRITE_REG(LCD_DMA_STREAM->PAR, job->src);
+    WRITE_REG(LCD_DMA_STREAM->M0AR, job->dst);
+    WRITE_REG(LCD_DMA_STREAM->NDTR, job->chunk);
+
+    WRITE_REG(DMA2->LIFCR, LCD_DMA_FLAGS_ALL);
+    SET_BIT(LCD_DMA_STREAM->CR, DMA_SxCR_EN);
+}
+
+static void lcd_dma_finish(void)
+{
+    lcd_dma_done_cb_t cb = lcd_dma_job.cb;
+    void *ctx = lcd_dma_job.ctx;
+
+    /* 先释放引擎再回调：回调内可以立即启动下一次传输（队列/分段场景） */
+    lcd_dma_active = false;
+
+    if (cb != 0)
+    {
+        cb(ctx);
+    }
+}
+#endif /* LCD_DMA_ENABLE */
+
+void lcd_dma_init(void)
+{
+#if LCD_DMA_ENABLE
+    /* 使能 DMA2 时钟 */
+    SET_BIT(RCC->AHB1ENR, RCC_AHB1ENR_DMA2EN);
+    (void)READ_BIT(RCC->AHB1ENR, RCC_AHB1ENR_DMA2EN);
+
+    /* 先关闭 stream 再配置 */
+    CLEAR_BIT(LCD_DMA_STREAM->CR, DMA_SxCR_EN);
+    while (READ_BIT(LCD_DMA_STREAM->CR, DMA_SxCR_EN) != 0U)
+    {
+        /* wait stream disable */
+    }
+
+    /* CR：
+     * - CHSEL=0, MBURST/PBURST=single
+     * - PL=11 (Very high)
+     * - MSIZE=PSIZE=01 (16-bit)
+     * - DIR=10 (Memory-to-Memory)
+     * - TCIE/TEIE 使能
+     * PINC/MINC 每次启动时按需设置
+     */
+    WRITE_REG(LCD_DMA_STREAM->CR,
+              DMA_SxCR_PL | DMA_SxCR_MSIZE_0 | DMA_SxCR_PSIZE_0 |
+                  DMA_SxCR_DIR_1 | DMA_SxCR_TCIE | DMA_SxCR_TEIE);
+
+    /* M2M 必须使用 FIFO 模式（禁止 direct mode），阈值取满 FIFO */
+    WRITE_REG(LCD_DMA_STREAM->FCR, DMA_SxFCR_DMDIS | DMA_SxFCR_FTH);
+
+    WRITE_REG(DMA2->LIFCR, LCD_DMA_FLAGS_ALL);
+
+    NVIC_EnableIRQ(LCD_DMA_IRQN);
+#endif
+    lcd_dma_active = false;
+}
+
+bool lcd_dma_start(const volatile void *src,
+                   bool src_inc,
+                   volatile void *dst,
+                   bool dst_inc,
+                   uint32_t count,
+                   lcd_dma_done_cb_t cb,
+                   void *ctx)
+{
+    if ((count == 0U) || lcd_dma_active)
+    {
+        return false;
+    }
+
+#if LCD_DMA_ENABLE
+    lcd_dma_job.src = (uint32_t)src;
+    lcd_dma_job.dst = (uint32_t)dst;
+    lcd_dma_job.remaining = count;
+    lcd_dma_job.src_inc = src_inc;
+    lcd_dma_job.dst_inc = dst_inc;
+    lcd_dma_job.cb = cb;
+    lcd_dma_job.ctx = ctx;
+
+    MODIFY_REG(LCD_DMA_STREAM->CR,
+               DMA_SxCR_PINC | DMA_SxCR_MINC,
+               (src_inc ? DMA_SxCR_PINC : 0U) | (dst_inc ? DMA_SxCR_MINC : 0U));
+
+    lcd_dma_active = true;
+    lcd_dma_start_chunk();
+#else
+    /* 无 DMA：CPU 同步拷贝，行为与 DMA 路径一致（完成后回调） */
+    const volatile uint16_t *s = (const volatile uint16_t *)src;
+    volatile uint16_t *d = (volatile uint16_t *)dst;
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        *d = *s;
+        if (src_inc)
+        {
+            s++;
+        }
+        if (dst_inc)
+        {
+            d++;
+        }
+    }
+
+    if (cb != 0)
+    {
+        cb(ctx);
+    }
+#endif
+    return true;
+}
+
+bool lcd_dma_busy(void)
+{
+    return lcd_dma_active;
+}
+
+void lcd_dma_wait(void)
+{
+    while (lcd_dma_active)
+    {
+        /* 等待 DMA 中断释放引擎 */
+    }
+}
+
+bool lcd_dma_addr_ok(const volatile void *p)
+{
+    const uint32_t addr = (uint32_t)p;
+    return !((addr >= LCD_DMA_CCMRAM_BASE) && (addr < LCD_DMA_CCMRAM_END));
+}
+
+uint32_t lcd_dma_error_count(void)
+{
+    return lcd_dma_errors;
+}
+
+#if LCD_DMA_ENABLE
+void DMA2_Stream0_IRQHandler(void)
+{
+    const uint32_t isr = READ_REG(DMA2->LISR);
+    WRITE_REG(DMA2->LIFCR, LCD_DMA_FLAGS_ALL);
+
+    if ((isr & DMA_LISR_TEIF0) != 0U)
+    {
+        /* 传输错误：硬件已自动关闭 stream，放弃剩余部分 */
+        lcd_dma_errors++;
+        lcd_dma_job.remaining = 0U;
+        lcd_dma_finish();
+        return;
+    }
+
+    if ((isr & DMA_LISR_TCIF0) == 0U)
+    {
+        return;
+    }
+
+    /* 推进地址到下一段 */
+    const uint32_t bytes = lcd_dma_job.chunk * 2U;
+    if (lcd_dma_job.src_inc)
+    {
+        lcd_dma_job.src += bytes;
+    }
+    if (lcd_dma_job.dst_inc)
+    {
+        lcd_dma_job.dst += bytes;
+    }
+
+    if (lcd_dma_job.remaining != 0U)
+    {
+        /* TC 后硬件已清 EN，直接重装下一段 */
+        lcd_dma_start_chunk();
+    }
+    else
+    {
+        lcd_dma_finish();
+    }
+}
+#endif /* LCD_DMA_ENABLE */
@@ -0,0 +1,77 @@
+#ifndef LCD_LCD_DMA_H
+#define LCD_LCD_DMA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief LCD 专用 DMA 引擎：DMA2 Stream0，Memory-to-Memory 模式，16-bit 数据项。
+ *
+ * - 源/目的地址可分别选择“固定”或“递增”，例如：
+ *   - 纯色填充：源=SRAM 中的一个 16-bit 颜色字（固定），目的=LCD_DATA（0x6C000080，固定）
+ *   - 缓冲区推送：源=像素缓冲区（递增），目的=LCD_DATA（固定）
+ * - 单次 NDTR 最多 65535 项；超过时在传输完成中断里自动重装下一段，直到全部完成。
+ *
+ * 注意：
+ * - DMA2 无法访问 CCMRAM(0x10000000)，源/目的缓冲区必须位于 SRAM / FLASH / FSMC。
+ * - 同一时刻只有一个传输；传输进行中不要直接访问 LCD 总线（lcd_write_cmd() 内部会先等待 DMA 空闲）。
+ *
+ * 详见: src/lcd/lcd.md 第 8 节
+ */
+
+/** 是否启用 DMA 路径（0 则 lcd_dma_start() 退化为 CPU 同步拷贝，便于调试对比）。 */
+#ifndef LCD_DMA_ENABLE
+#define LCD_DMA_ENABLE (1)
+#endif
+
+/** NDTR 单段最大数据项数（16-bit 计数器）。 */
+#define LCD_DMA_MAX_ITEMS (65535U)
+
+/** 传输完成回调（在 DMA 中断上下文中执行，应尽量简短）。 */
+typedef void (*lcd_dma_done_cb_t)(void *ctx);
+
+/** 初始化 DMA2 时钟与中断（由 lcd_init() 调用）。 */
+void lcd_dma_init(void);
+
+/**
+ * @brief 启动一次 16-bit 数据项搬运（非阻塞）。
+ *
+ * @param src     源地址
+ * @param src_inc 源地址是否递增
+ * @param dst     目的地址
+ * @param dst_inc 目的地址是否递增
+ * @param count   数据项个数（可大于 65535，内部自动分段）
+ * @param cb      全部完成后的回调，可为 NULL
+ * @param ctx     回调参数
+ *
+ * @return 成功启动返回 true；count 为 0 或引擎忙返回 false。
+ */
+bool lcd_dma_start(const volatile void *src,
+                   bool src_inc,
+                   volatile void *dst,
+                   bool dst_inc,
+                   uint32_t count,
+                   lcd_dma_done_cb_t cb,
+                   void *ctx);
+
+/** @brief 当前是否有传输在进行。 */
+bool lcd_dma_busy(void);
+
+/** @brief 阻塞等待当前传输完成。 */
+void lcd_dma_wait(void);
+
+/** @brief 地址是否可被 DMA2 访问（CCMRAM 返回 false）。 */
+bool lcd_dma_addr_ok(const volatile void *p);
+
+/** @brief 传输错误（TEIF）累计次数，用于调试。 */
+uint32_t lcd_dma_error_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCD_LCD_DMA_H */
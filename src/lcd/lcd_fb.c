@@ -0,0 +1,224 @@
+#include "lcd_fb.h"
+#include "lcd_dma.h"
+#include "lcd_port.h"
+
+#include "stm32f4xx.h"
+
+/* 两块整帧缓冲区放在外部 SRAM（链接脚本 .extsram 段，NOLOAD，由 lcd_fb_init() 清屏） */
+static lcd_color565_t lcd_fb_mem[2][LCD_FB_PIXELS] __attribute__((section(".extsram"), aligned(4)));
+
+static uint32_t lcd_fb_back_idx = 0U;
+static volatile bool lcd_fb_flushing = false;
+static volatile uint32_t lcd_fb_frames = 0U;
+
+static void lcd_fb_on_flush_done(void *unused)
+{
+    (void)unused;
+
+    lcd_fb_frames++;
+    lcd_fb_flushing = false;
+}
+
+static void lcd_fb_on_copy_done(void *ctx)
+{
+    *(volatile bool *)ctx = true;
+}
+
+/* 行内填充：先对齐到 4 字节，中间按 32-bit 双像素写，减少外部 SRAM 总线事务 */
+static void lcd_fb_fill_span(lcd_color565_t *dst, uint32_t count, lcd_color565_t color)
+{
+    if ((((uint32_t)dst & 2U) != 0U) && (count != 0U))
+    {
+        *dst++ = color;
+        count--;
+    }
+
+    uint32_t *d32 = (uint32_t *)(void *)dst;
+    const uint32_t c32 = ((uint32_t)color << 16) | (uint32_t)color;
+    uint32_t pairs = count >> 1;
+
+    while (pairs >= 4U)
+    {
+        d32[0] = c32;
+        d32[1] = c32;
+        d32[2] = c32;
+        d32[3] = c32;
+        d32 += 4;
+        pairs -= 4U;
+    }
+    while (pairs != 0U)
+    {
+        *d32++ = c32;
+        pairs--;
+    }
+
+    if ((count & 1U) != 0U)
+    {
+        *(lcd_color565_t *)(void *)d32 = color;
+    }
+}
+
+/* 按缓冲区自身的 320×480 布局裁剪（lcd_clip_rect() 跟随旋转，横屏时是 480×320） */
+static bool lcd_fb_clip(uint16_t *x, uint16_t *y, uint16_t *w, uint16_t *h)
+{
+    if ((*w == 0U) || (*h == 0U) || (*x >= LCD_FB_WIDTH) || (*y >= LCD_FB_HEIGHT))
+    {
+        return false;
+    }
+
+    if (((uint32_t)(*x) + (uint32_t)(*w)) > LCD_FB_WIDTH)
+    {
+        *w = (uint16_t)(LCD_FB_WIDTH - *x);
+    }
+    if (((uint32_t)(*y) + (uint32_t)(*h)) > LCD_FB_HEIGHT)
+    {
+        *h = (uint16_t)(LCD_FB_HEIGHT - *y);
+    }
+    return true;
+}
+
+void lcd_fb_init(lcd_color565_t color)
+{
+    lcd_fb_wait();
+
+    lcd_fb_fill_span(lcd_fb_mem[0], LCD_FB_PIXELS, color);
+    lcd_fb_fill_span(lcd_fb_mem[1], LCD_FB_PIXELS, color);
+
+    lcd_fb_back_idx = 0U;
+    lcd_fb_frames = 0U;
+}
+
+lcd_color565_t *lcd_fb_back(void)
+{
+    return lcd_fb_mem[lcd_fb_back_idx];
+}
+
+const lcd_color565_t *lcd_fb_front(void)
+{
+    return lcd_fb_mem[lcd_fb_back_idx ^ 1U];
+}
+
+void lcd_fb_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, lcd_color565_t color)
+{
+    if (!lcd_fb_clip(&x, &y, &w, &h))
+    {
+        return;
+    }
+
+    lcd_color565_t *row = lcd_fb_back() + ((uint32_t)y * LCD_FB_WIDTH) + x;
+    for (uint16_t r = 0U; r < h; r++)
+    {
+        lcd_fb_fill_span(row, w, color);
+        row += LCD_FB_WIDTH;
+    }
+}
+
+void lcd_fb_draw_pixel(uint16_t x, uint16_t y, lcd_color565_t color)
+{
+    if ((x >= LCD_FB_WIDTH) || (y >= LCD_FB_HEIGHT))
+    {
+        return;
+    }
+
+    lcd_fb_back()[((uint32_t)y * LCD_FB_WIDTH) + x] = color;
+}
+
+void lcd_fb_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const lcd_color565_t *src)
+{
+    if (src == 0)
+    {
+        return;
+    }
+
+    const uint16_t src_w = w;
+    const uint16_t x0 = x;
+    const uint16_t y0 = y;
+    if (!lcd_fb_clip(&x, &y, &w, &h))
+    {
+        return;
+    }
+
+    /* 裁剪后跳过源缓冲区中被裁掉的左/上部分 */
+    const lcd_color565_t *s = src + ((uint32_t)(y - y0) * src_w) + (uint32_t)(x - x0);
+    lcd_color565_t *row = lcd_fb_back() + ((uint32_t)y * LCD_FB_WIDTH) + x;
+    for (uint16_t r = 0U; r < h; r++)
+    {
+        for (uint16_t i = 0U; i < w; i++)
+        {
+            row[i] = s[i];
+        }
+        s += src_w;
+        row += LCD_FB_WIDTH;
+    }
+}
+
+void lcd_fb_copy_front(void)
+{
+    lcd_fb_wait();
+    lcd_dma_wait();
+
+    volatile bool done = false;
+    if (lcd_dma_start(lcd_fb_front(), true, lcd_fb_back(), true, LCD_FB_PIXELS,
+                      lcd_fb_on_copy_done, (void *)&done))
+    {
+        while (!done)
+        {
+            /* 等待 SRAM->SRAM 整帧复制完成 */
+        }
+        return;
+    }
+
+    /* DMA 不可用：CPU 按 32-bit 复制 */
+    const uint32_t *s = (const uint32_t *)(const void *)lcd_fb_front();
+    uint32_t *d = (uint32_t *)(void *)lcd_fb_back();
+    for (uint32_t i = 0U; i < (LCD_FB_PIXELS / 2U); i++)
+    {
+        d[i] = s[i];
+    }
+}
+
+bool lcd_fb_flip(void)
+{
+    const lcd_rotation_t rot = lcd_get_rotation();
+    if ((rot == LCD_ROTATION_90) || (rot == LCD_ROTATION_270))
+    {
+        /* 横屏下全屏窗口是 480×320，与缓冲区布局不符，推送会错位 */
+        return false;
+    }
+
+    /* 上一帧推送完成前，旧前台（即将成为新后台）仍被 DMA 读取 */
+    lcd_fb_wait();
+
+    lcd_fb_back_idx ^= 1U;
+
+    /* 窗口命令会先等待 DMA 引擎空闲（含异步队列） */
+    lcd_set_window(0U, 0U, LCD_FB_WIDTH, LCD_FB_HEIGHT);
+
+    lcd_fb_flushing = true;
+    if (!lcd_dma_start(lcd_fb_front(), true, &LCD_DATA_REG, false, LCD_FB_PIXELS,
+                       lcd_fb_on_flush_done, 0))
+    {
+        /* 引擎被占用（不应发生）：退化为 CPU 同步推送 */
+        lcd_write_pixels(lcd_fb_front(), LCD_FB_PIXELS);
+        lcd_fb_on_flush_done(0);
+    }
+    return true;
+}
+
+bool lcd_fb_busy(void)
+{
+    return lcd_fb_flushing;
+}
+
+void lcd_fb_wait(void)
+{
+    while (lcd_fb_flushing)
+    {
+        /* 等待 DMA 完成中断 */
+    }
+}
+
+uint32_t lcd_fb_frame_count(void)
+{
+    return lcd_fb_frames;
+}
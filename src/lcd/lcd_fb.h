@@ -0,0 +1,75 @@
+#ifndef LCD_LCD_FB_H
+#define LCD_LCD_FB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lcd/lcd.h"
+
+/**
+ * @brief 外部 SRAM 双缓冲帧缓冲区（IS62WV51216 @ FSMC Bank1 NE3，0x68000000）。
+ *
+ * - 两块整帧缓冲区（各 320×480×2 = 300KB）放在 .extsram 段，总线由 SystemInit_ExtMemCtl() 配置。
+ * - 应用只在“后台缓冲区”上绘制；lcd_fb_flip() 交换前后台，并用 DMA2 把新的前台整帧推送到 LCD，
+ *   推送期间 CPU 可以继续绘制下一帧。
+ * - 交换前会等待上一帧推送完成，因此后台缓冲区永远不会与正在推送的缓冲区重叠。
+ * - 缓冲区按物理竖屏 320×480 布局，只能在 LCD_ROTATION_0 / LCD_ROTATION_180 下使用。
+ *
+ * 详见: src/lcd/lcd.md 第 13 节
+ */
+
+#define LCD_FB_WIDTH  (LCD_PANEL_WIDTH)
+#define LCD_FB_HEIGHT (LCD_PANEL_HEIGHT)
+#define LCD_FB_PIXELS (LCD_FB_WIDTH * LCD_FB_HEIGHT)
+
+/** 初始化：清空两块缓冲区（需在 lcd_panel_init() 之后调用）。 */
+void lcd_fb_init(lcd_color565_t color);
+
+/** @brief 当前后台缓冲区（行优先，stride = LCD_FB_WIDTH）。 */
+lcd_color565_t *lcd_fb_back(void);
+
+/** @brief 当前前台缓冲区（最近一次 flip 提交的帧，只读）。 */
+const lcd_color565_t *lcd_fb_front(void);
+
+/** 在后台缓冲区填充矩形（按 LCD_FB_WIDTH × LCD_FB_HEIGHT 裁剪，与当前旋转无关）。 */
+void lcd_fb_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, lcd_color565_t color);
+
+/** 在后台缓冲区画点（按 LCD_FB_WIDTH × LCD_FB_HEIGHT 裁剪）。 */
+void lcd_fb_draw_pixel(uint16_t x, uint16_t y, lcd_color565_t color);
+
+/** 把 w*h 的 RGB565 缓冲区（行优先、连续存放）拷贝到后台缓冲区 (x,y)，按 LCD_FB_WIDTH × LCD_FB_HEIGHT 裁剪。 */
+void lcd_fb_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const lcd_color565_t *src);
+
+/**
+ * @brief 把前台缓冲区内容复制到后台缓冲区（等待推送完成后用 DMA2 整帧复制）。
+ *
+ * 用于增量绘制：flip 之后后台缓冲区里是“两帧之前”的内容，
+ * 若下一帧只改动局部，先调用本函数再绘制。
+ */
+void lcd_fb_copy_front(void);
+
+/**
+ * @brief 提交后台缓冲区：等待上一帧推送完成 -> 交换前后台 -> DMA 推送新前台（非阻塞）。
+ *
+ * @return 当前为 LCD_ROTATION_90 / LCD_ROTATION_270 时不交换、不推送，返回 false；否则 true。
+ */
+bool lcd_fb_flip(void);
+
+/** @brief 前台缓冲区是否仍在推送。 */
+bool lcd_fb_busy(void);
+
+/** @brief 阻塞等待前台缓冲区推送完成。 */
+void lcd_fb_wait(void);
+
+/** @brief 已完成推送的帧数（自 lcd_fb_init() 起）。 */
+uint32_t lcd_fb_frame_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCD_LCD_FB_H */
@@ -0,0 +1,152 @@
+#include "lcd_pipe.h"
+#include "lcd_dma.h"
+#include "lcd_port.h"
+
+#include "stm32f4xx.h"
+
+#if LCD_PIPE_BUFFERS < 2U
+#error "LCD_PIPE_BUFFERS must be >= 2"
+#endif
+
+/* 按长边分配：横屏下仍能容纳 LCD_PIPE_LINES 条全宽扫描行 */
+#define LCD_PIPE_BUF_PIXELS (LCD_PANEL_LONG_SIDE * LCD_PIPE_LINES)
+
+static lcd_color565_t lcd_pipe_buf[LCD_PIPE_BUFFERS][LCD_PIPE_BUF_PIXELS] __attribute__((aligned(4)));
+static uint32_t lcd_pipe_len[LCD_PIPE_BUFFERS];
+
+/*
+ * submitted/done 为自由递增计数，取模得到缓冲区下标：
+ * - 主循环渲染完一块后 submitted++
+ * - DMA 推送完一块后（中断中）done++
+ * submitted - done 即已占用的缓冲区数。
+ */
+static volatile uint32_t lcd_pipe_submitted = 0U;
+static volatile uint32_t lcd_pipe_done = 0U;
+static volatile bool lcd_pipe_running = false;
+static volatile uint32_t lcd_pipe_idle_t0 = 0U;
+static volatile uint32_t lcd_pipe_idle_cycles = 0U;
+
+static void lcd_pipe_on_done(void *unused);
+
+static void lcd_pipe_start_slot(void)
+{
+    const uint32_t slot = lcd_pipe_done % LCD_PIPE_BUFFERS;
+    if (!lcd_dma_start(lcd_pipe_buf[slot], true, &LCD_DATA_REG, false,
+                       lcd_pipe_len[slot], lcd_pipe_on_done, 0))
+    {
+        /* 引擎被别处占用：不会有完成中断，由 CPU 推送这一块并按完成处理 */
+        lcd_write_pixels(lcd_pipe_buf[slot], lcd_pipe_len[slot]);
+        lcd_pipe_on_done(0);
+    }
+}
+
+static void lcd_pipe_on_done(void *unused)
+{
+    (void)unused;
+
+    lcd_pipe_done++;
+
+    if (lcd_pipe_submitted != lcd_pipe_done)
+    {
+        /* 下一块已就绪：在中断里直接接力 */
+        lcd_pipe_start_slot();
+    }
+    else
+    {
+        lcd_pipe_running = false;
+        lcd_pipe_idle_t0 = DWT->CYCCNT;
+    }
+}
+
+static void lcd_pipe_submit(uint32_t pixels)
+{
+    lcd_pipe_len[lcd_pipe_submitted % LCD_PIPE_BUFFERS] = pixels;
+    __COMPILER_BARRIER(); /* 像素与长度先于计数可见 */
+
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    const bool first = (lcd_pipe_submitted == 0U);
+    lcd_pipe_submitted++;
+
+    if (!lcd_pipe_running)
+    {
+        if (!first)
+        {
+            lcd_pipe_idle_cycles += DWT->CYCCNT - lcd_pipe_idle_t0;
+        }
+        lcd_pipe_running = true;
+        lcd_pipe_start_slot();
+    }
+
+    __set_PRIMASK(primask);
+}
+
+void lcd_pipe_run(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                  lcd_strip_render_fn_t fn, void *ctx,
+                  lcd_pipe_stats_t *stats)
+{
+    lcd_pipe_stats_t st = {0};
+
+    if ((fn == 0) || !lcd_clip_rect(&x, &y, &w, &h))
+    {
+        if (stats != 0)
+        {
+            *stats = st;
+        }
+        return;
+    }
+
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+
+    const uint16_t lines = (uint16_t)(LCD_PIPE_BUF_PIXELS / w);
+    const uint32_t t_start = DWT->CYCCNT;
+
+    /* 整个区域只设置一次窗口（会等待 DMA 引擎空闲），各块数据首尾相接 */
+    lcd_set_window(x, y, w, h);
+
+    lcd_pipe_submitted = 0U;
+    lcd_pipe_done = 0U;
+    lcd_pipe_running = false;
+    lcd_pipe_idle_cycles = 0U;
+
+    for (uint16_t row = 0U; row < h; row = (uint16_t)(row + lines))
+    {
+        /* 等待一块空闲缓冲区 */
+        const uint32_t t_wait = DWT->CYCCNT;
+        while ((lcd_pipe_submitted - lcd_pipe_done) >= LCD_PIPE_BUFFERS)
+        {
+            /* DMA 仍在推送全部缓冲区 */
+        }
+        const uint32_t t_render = DWT->CYCCNT;
+        st.cpu_stall_cycles += t_render - t_wait;
+
+        const lcd_strip_band_t band = {
+            .buf = lcd_pipe_buf[lcd_pipe_submitted % LCD_PIPE_BUFFERS],
+            .x = x,
+            .y = (uint16_t)(y + row),
+            .w = w,
+            .h = ((h - row) < lines) ? (uint16_t)(h - row) : lines,
+        };
+        fn(&band, ctx);
+        st.render_cycles += DWT->CYCCNT - t_render;
+
+        lcd_pipe_submit((uint32_t)band.w * band.h);
+        st.chunks++;
+        st.lines += band.h;
+    }
+
+    while (lcd_pipe_running)
+    {
+        /* 等待最后一块推送完成 */
+    }
+
+    st.total_cycles = DWT->CYCCNT - t_start;
+    st.dma_idle_cycles = lcd_pipe_idle_cycles;
+
+    if (stats != 0)
+    {
+        *stats = st;
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef LCD_LCD_PIPE_H
+#define LCD_LCD_PIPE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lcd/lcd.h"
+#include "lcd/lcd_strip.h"
+
+/**
+ * @brief 乒乓扫描行流水线：CPU 渲染第 N+1 块行缓冲区的同时，DMA2 把第 N 块推送到 LCD_DATA。
+ *
+ * - SRAM 中 LCD_PIPE_BUFFERS 块行缓冲区（每块 LCD_PIPE_LINES 条全宽扫描行）轮转使用；
+ * - 渲染回调与条带渲染器相同（lcd_strip_band_t + lcd_strip_* 绘制辅助），可直接复用同一场景函数；
+ * - DMA 完成中断里直接启动下一块已就绪的缓冲区，CPU 只在“没有空闲缓冲区”时等待。
+ *
+ * 与 lcd_strip 的区别：直接在 DMA 可达的 SRAM 中渲染，没有 CCM -> SRAM 拷贝，缓冲区可多于两块。
+ *
+ * 详见: src/lcd/lcd.md 第 16 节
+ */
+
+/** 行缓冲区块数（>= 2）。 */
+#ifndef LCD_PIPE_BUFFERS
+#define LCD_PIPE_BUFFERS (2U)
+#endif
+
+/** 每块缓冲区的全宽扫描行数；窗口较窄时按像素容量自动容纳更多行。 */
+#ifndef LCD_PIPE_LINES
+#define LCD_PIPE_LINES (2U)
+#endif
+
+/** @brief 单帧统计（周期数为 HCLK 周期，DWT CYCCNT 计量）。 */
+typedef struct
+{
+    uint32_t lines;            /* 输出的扫描行数 */
+    uint32_t chunks;           /* 推送的缓冲区块数 */
+    uint32_t total_cycles;     /* 整帧耗时（设置窗口到最后一块推送完成） */
+    uint32_t render_cycles;    /* 回调渲染耗时合计 */
+    uint32_t cpu_stall_cycles; /* CPU 等待空闲缓冲区的时间（DMA 是瓶颈） */
+    uint32_t dma_idle_cycles;  /* 首块启动后 DMA 无数据可推的时间（渲染是瓶颈） */
+} lcd_pipe_stats_t;
+
+/**
+ * @brief 以流水线方式渲染并输出矩形区域（默认裁剪，阻塞到最后一块推送完成）。
+ *
+ * @param stats 可为 NULL
+ */
+void lcd_pipe_run(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                  lcd_strip_render_fn_t fn, void *ctx,
+                  lcd_pipe_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCD_LCD_PIPE_H */
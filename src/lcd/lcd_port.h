@@ -0,0 +1,46 @@
+#ifndef LCD_LCD_PORT_H
+#define LCD_LCD_PORT_H
+
+/**
+ * @brief LCD 模块内部头文件：FSMC(NE4) 命令/数据地址映射。
+ *
+ * 仅供 src/lcd/ 内部各 .c 文件使用（lcd.c / lcd_dma.c ...），不对应用层公开。
+ * 地址推导见: src/lcd/lcd.md 1.1
+ *
+ * 总线读写统一经过 LCD_WR_CMD / LCD_WR_DATA / LCD_RD_DATA；
+ * 定义 LCD_PORT_HOST 时（tools/lcdsim 主机仿真）改为调用 HX8357D 软件模型，
+ * LCD_DATA_REG 只作为 DMA 端点地址使用。
+ */
+
+#include <stdint.h>
+
+#if defined(LCD_PORT_HOST)
+
+#include "hx8357d_sim.h"
+
+#define LCD_CMD_REG  (lcdsim_cmd_port)
+#define LCD_DATA_REG (lcdsim_data_port)
+
+#define LCD_WR_CMD(v)  lcdsim_write_cmd((uint16_t)(v))
+#define LCD_WR_DATA(v) lcdsim_write_data((uint16_t)(v))
+#define LCD_RD_DATA()  lcdsim_read_data()
+
+#else
+
+/*
+ * Bank1 NE4 基地址：0x6C000000
+ * RS(D/C) 接 FSMC_A6；16-bit 模式下 A6 对应 MCU 地址 bit7 -> 偏移 0x80
+ */
+#define LCD_FSMC_NE4_BASE (0x6C000000UL)
+#define LCD_FSMC_RS_OFFS  (0x00000080UL)
+
+#define LCD_CMD_REG  (*((volatile uint16_t *)(LCD_FSMC_NE4_BASE + 0U)))
+#define LCD_DATA_REG (*((volatile uint16_t *)(LCD_FSMC_NE4_BASE + LCD_FSMC_RS_OFFS)))
+
+#define LCD_WR_CMD(v)  (LCD_CMD_REG = (uint16_t)(v))
+#define LCD_WR_DATA(v) (LCD_DATA_REG = (uint16_t)(v))
+#define LCD_RD_DATA()  (LCD_DATA_REG)
+
+#endif
+
+#endif /* LCD_LCD_PORT_H */
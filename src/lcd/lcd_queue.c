@@ -0,0 +1,195 @@
+#include "lcd_queue.h"
+#include "lcd_dma.h"
+#include "lcd_port.h"
+
+#include "stm32f4xx.h"
+
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    const lcd_color565_t *src; /* NULL => 纯色填充 */
+    lcd_color565_t color;      /* 纯色作业的 DMA 源：随作业槽保存在 SRAM 中 */
+    lcd_queue_cb_t cb;
+    void *ctx;
+} lcd_queue_job_t;
+
+/* head/tail 为自由递增计数，取模得到槽位；tail - head 即待完成作业数 */
+static lcd_queue_job_t lcd_queue_jobs[LCD_QUEUE_DEPTH];
+static volatile uint32_t lcd_queue_head = 0U;
+static volatile uint32_t lcd_queue_tail = 0U;
+static volatile bool lcd_queue_running = false;
+static volatile uint32_t lcd_queue_errors = 0U;
+
+static void lcd_queue_start_head(void);
+
+static void lcd_queue_on_done(void *unused)
+{
+    (void)unused;
+
+    const lcd_queue_job_t *job = &lcd_queue_jobs[lcd_queue_head % LCD_QUEUE_DEPTH];
+    const lcd_queue_cb_t cb = job->cb;
+    void *ctx = job->ctx;
+
+    /* 先释放槽位再回调：回调内允许继续入队 */
+    lcd_queue_head++;
+
+    if (cb != 0)
+    {
+        cb(ctx);
+    }
+
+    lcd_queue_start_head();
+}
+
+static void lcd_queue_start_head(void)
+{
+    while (lcd_queue_head != lcd_queue_tail)
+    {
+        const lcd_queue_job_t *job = &lcd_queue_jobs[lcd_queue_head % LCD_QUEUE_DEPTH];
+        const uint32_t pixels = (uint32_t)job->w * (uint32_t)job->h;
+        bool started;
+
+        /* 窗口命令由 CPU 直接发送（11 次总线写，远小于像素数据），随后交给 DMA */
+        lcd_set_window(job->x, job->y, job->w, job->h);
+
+        if (job->src != 0)
+        {
+            started = lcd_dma_start(job->src, true, &LCD_DATA_REG, false, pixels, lcd_queue_on_done, 0);
+        }
+        else
+        {
+            started = lcd_dma_start(&job->color, false, &LCD_DATA_REG, false, pixels, lcd_queue_on_done, 0);
+        }
+
+        if (started)
+        {
+            return;
+        }
+
+        /* 引擎被别处占用：不会有完成中断，丢弃该作业并照常回调，否则队列永远停在 running */
+        lcd_queue_errors++;
+
+        const lcd_queue_cb_t cb = job->cb;
+        void *ctx = job->ctx;
+        lcd_queue_head++;
+        if (cb != 0)
+        {
+            cb(ctx);
+        }
+    }
+
+    lcd_queue_running = false;
+}
+
+static bool lcd_queue_push(const lcd_queue_job_t *job)
+{
+    if ((lcd_queue_tail - lcd_queue_head) >= LCD_QUEUE_DEPTH)
+    {
+        return false;
+    }
+
+    lcd_queue_jobs[lcd_queue_tail % LCD_QUEUE_DEPTH] = *job;
+    __COMPILER_BARRIER(); /* 槽位内容先于 tail 可见 */
+    lcd_queue_tail++;
+
+    /* 队列空闲时由主循环启动第一个作业；运行中则由 DMA 中断接力 */
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    const bool idle = !lcd_queue_running;
+    lcd_queue_running = true;
+    __set_PRIMASK(primask);
+
+    if (idle)
+    {
+        lcd_queue_start_head();
+    }
+
+    return true;
+}
+
+void lcd_queue_flag_cb(void *ctx)
+{
+    if (ctx != 0)
+    {
+        *(volatile bool *)ctx = true;
+    }
+}
+
+bool lcd_queue_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                    lcd_color565_t color,
+                    lcd_queue_cb_t cb, void *ctx)
+{
+    if (!lcd_clip_rect(&x, &y, &w, &h))
+    {
+        /* 无可见区域：视为立即完成 */
+        if (cb != 0)
+        {
+            cb(ctx);
+        }
+        return true;
+    }
+
+    const lcd_queue_job_t job = {
+        .x = x, .y = y, .w = w, .h = h,
+        .src = 0,
+        .color = color,
+        .cb = cb,
+        .ctx = ctx,
+    };
+    return lcd_queue_push(&job);
+}
+
+bool lcd_queue_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                      const lcd_color565_t *src,
+                      lcd_queue_cb_t cb, void *ctx)
+{
+    if ((src == 0) || !lcd_dma_addr_ok(src))
+    {
+        return false;
+    }
+
+    /* 不允许裁剪：裁剪后窗口与缓冲区布局不再一致 */
+    uint16_t cx = x;
+    uint16_t cy = y;
+    uint16_t cw = w;
+    uint16_t ch = h;
+    if (!lcd_clip_rect(&cx, &cy, &cw, &ch) || (cw != w) || (ch != h))
+    {
+        return false;
+    }
+
+    const lcd_queue_job_t job = {
+        .x = x, .y = y, .w = w, .h = h,
+        .src = src,
+        .color = 0U,
+        .cb = cb,
+        .ctx = ctx,
+    };
+    return lcd_queue_push(&job);
+}
+
+uint32_t lcd_queue_pending(void)
+{
+    return lcd_queue_tail - lcd_queue_head;
+}
+
+bool lcd_queue_busy(void)
+{
+    return lcd_queue_running;
+}
+
+void lcd_queue_wait(void)
+{
+    while (lcd_queue_running)
+    {
+        /* 等待 DMA 中断把队列排空 */
+    }
+}
+
+uint32_t lcd_queue_error_count(void)
+{
+    return lcd_queue_errors;
+}
@@ -0,0 +1,79 @@
+#ifndef LCD_LCD_QUEUE_H
+#define LCD_LCD_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lcd/lcd.h"
+
+/**
+ * @brief LCD 异步传输队列：入队“窗口设置 + 像素数据”作业，由 DMA 背靠背执行。
+ *
+ * - 入队函数立即返回；作业按 FIFO 顺序执行：CPU 发送 0x2A/0x2B/0x2C 后启动 DMA 推送数据，
+ *   DMA 完成中断里回调并启动下一个作业，主循环无需等待。
+ * - 完成通知：回调（中断上下文）或标志位（使用 lcd_queue_flag_cb + volatile bool）。
+ * - 同步 API（lcd_fill_rect / lcd_draw_pixel / lcd_write_cmd ...）会先等待队列排空。
+ *
+ * 详见: src/lcd/lcd.md 第 9 节
+ */
+
+/** 队列深度（作业槽数）。 */
+#ifndef LCD_QUEUE_DEPTH
+#define LCD_QUEUE_DEPTH (8U)
+#endif
+
+/** 作业完成回调（DMA 中断上下文）。 */
+typedef void (*lcd_queue_cb_t)(void *ctx);
+
+/**
+ * @brief 现成的“置标志”回调：ctx 指向 volatile bool，完成时置 true。
+ *
+ * 用法：
+ *   static volatile bool done;
+ *   done = false;
+ *   lcd_queue_fill(0, 0, 320, 480, 0x0000, lcd_queue_flag_cb, (void *)&done);
+ */
+void lcd_queue_flag_cb(void *ctx);
+
+/**
+ * @brief 入队纯色填充作业（矩形自动裁剪）。
+ * @return 入队成功返回 true；队列满返回 false；完全越界视为成功（立即回调）。
+ */
+bool lcd_queue_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                    lcd_color565_t color,
+                    lcd_queue_cb_t cb, void *ctx);
+
+/**
+ * @brief 入队像素缓冲区推送作业（w*h 个 RGB565，行优先连续存放）。
+ *
+ * 要求：
+ * - 矩形必须完全位于屏幕内（不做裁剪，否则数据错位）
+ * - src 在作业完成前必须保持有效且不被改写，且不能位于 CCMRAM
+ *
+ * @return 入队成功返回 true；参数非法或队列满返回 false。
+ */
+bool lcd_queue_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                      const lcd_color565_t *src,
+                      lcd_queue_cb_t cb, void *ctx);
+
+/** @brief 队列中尚未完成的作业数（含正在执行的）。 */
+uint32_t lcd_queue_pending(void);
+
+/** @brief 队列是否仍在执行。 */
+bool lcd_queue_busy(void);
+
+/** @brief 阻塞等待队列排空。 */
+void lcd_queue_wait(void);
+
+/** @brief 因 lcd_dma_start() 失败而丢弃的作业数（这些作业的回调仍会被调用），用于调试。 */
+uint32_t lcd_queue_error_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCD_LCD_QUEUE_H */
@@ -0,0 +1,168 @@
+#include "lcd_strip.h"
+#include "lcd_dma.h"
+#include "lcd_port.h"
+
+/* 绘制缓冲区在 CCMRAM（.ccmbss，NOLOAD）；DMA 发送缓冲区必须在 SRAM */
+static lcd_color565_t lcd_strip_band_buf[LCD_STRIP_PIXELS] __attribute__((section(".ccmbss"), aligned(4)));
+static lcd_color565_t lcd_strip_tx_buf[LCD_STRIP_PIXELS] __attribute__((aligned(4)));
+
+/* 与条带求交；返回相对条带的起点与尺寸 */
+static bool lcd_strip_intersect(const lcd_strip_band_t *band,
+                                int32_t x, int32_t y, int32_t w, int32_t h,
+                                uint32_t *bx, uint32_t *by, uint32_t *bw, uint32_t *bh)
+{
+    int32_t x0 = x;
+    int32_t y0 = y;
+    int32_t x1 = x + w;
+    int32_t y1 = y + h;
+
+    if (x0 < (int32_t)band->x)
+    {
+        x0 = (int32_t)band->x;
+    }
+    if (y0 < (int32_t)band->y)
+    {
+        y0 = (int32_t)band->y;
+    }
+    if (x1 > ((int32_t)band->x + (int32_t)band->w))
+    {
+        x1 = (int32_t)band->x + (int32_t)band->w;
+    }
+    if (y1 > ((int32_t)band->y + (int32_t)band->h))
+    {
+        y1 = (int32_t)band->y + (int32_t)band->h;
+    }
+
+    if ((x0 >= x1) || (y0 >= y1))
+    {
+        return false;
+    }
+
+    *bx = (uint32_t)(x0 - (int32_t)band->x);
+    *by = (uint32_t)(y0 - (int32_t)band->y);
+    *bw = (uint32_t)(x1 - x0);
+    *bh = (uint32_t)(y1 - y0);
+    return true;
+}
+
+void lcd_strip_fill_rect(const lcd_strip_band_t *band,
+                         int16_t x, int16_t y, uint16_t w, uint16_t h,
+                         lcd_color565_t color)
+{
+    uint32_t bx, by, bw, bh;
+    if (!lcd_strip_intersect(band, x, y, w, h, &bx, &by, &bw, &bh))
+    {
+        return;
+    }
+
+    lcd_color565_t *row = band->buf + (by * band->w) + bx;
+    for (uint32_t r = 0U; r < bh; r++)
+    {
+        for (uint32_t i = 0U; i < bw; i++)
+        {
+            row[i] = color;
+        }
+        row += band->w;
+    }
+}
+
+void lcd_strip_draw_pixel(const lcd_strip_band_t *band, int16_t x, int16_t y, lcd_color565_t color)
+{
+    uint32_t bx, by, bw, bh;
+    if (lcd_strip_intersect(band, x, y, 1, 1, &bx, &by, &bw, &bh))
+    {
+        band->buf[(by * band->w) + bx] = color;
+    }
+}
+
+void lcd_strip_blit(const lcd_strip_band_t *band,
+                    int16_t x, int16_t y, uint16_t w, uint16_t h,
+                    const lcd_color565_t *src)
+{
+    uint32_t bx, by, bw, bh;
+    if ((src == 0) || !lcd_strip_intersect(band, x, y, w, h, &bx, &by, &bw, &bh))
+    {
+        return;
+    }
+
+    /* 源图像中与条带相交部分的起点 */
+    const uint32_t sx = (uint32_t)(((int32_t)band->x + (int32_t)bx) - (int32_t)x);
+    const uint32_t sy = (uint32_t)(((int32_t)band->y + (int32_t)by) - (int32_t)y);
+    const lcd_color565_t *s = src + (sy * w) + sx;
+    lcd_color565_t *row = band->buf + (by * band->w) + bx;
+
+    for (uint32_t r = 0U; r < bh; r++)
+    {
+        for (uint32_t i = 0U; i < bw; i++)
+        {
+            row[i] = s[i];
+        }
+        s += w;
+        row += band->w;
+    }
+}
+
+/* CCM -> SRAM 拷贝：32-bit 展开，两块缓冲区都 4 字节对齐 */
+static void lcd_strip_copy(lcd_color565_t *dst, const lcd_color565_t *src, uint32_t pixels)
+{
+    uint32_t *d = (uint32_t *)(void *)dst;
+    const uint32_t *s = (const uint32_t *)(const void *)src;
+    uint32_t words = pixels >> 1;
+
+    while (words >= 4U)
+    {
+        d[0] = s[0];
+        d[1] = s[1];
+        d[2] = s[2];
+        d[3] = s[3];
+        d += 4;
+        s += 4;
+        words -= 4U;
+    }
+    while (words != 0U)
+    {
+        *d++ = *s++;
+        words--;
+    }
+
+    if ((pixels & 1U) != 0U)
+    {
+        dst[pixels - 1U] = src[pixels - 1U];
+    }
+}
+
+void lcd_strip_render(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                      lcd_strip_render_fn_t fn, void *ctx)
+{
+    if ((fn == 0) || !lcd_clip_rect(&x, &y, &w, &h))
+    {
+        return;
+    }
+
+    const uint16_t lines = (uint16_t)(LCD_STRIP_PIXELS / w);
+
+    /* 整个区域只设置一次窗口；之后各条带依次推送，GRAM 地址自动递增 */
+    lcd_set_window(x, y, w, h);
+
+    for (uint16_t row = 0U; row < h; row = (uint16_t)(row + lines))
+    {
+        const lcd_strip_band_t band = {
+            .buf = lcd_strip_band_buf,
+            .x = x,
+            .y = (uint16_t)(y + row),
+            .w = w,
+            .h = ((h - row) < lines) ? (uint16_t)(h - row) : lines,
+        };
+        const uint32_t pixels = (uint32_t)band.w * band.h;
+
+        /* 与上一条带的 DMA 推送并行 */
+        fn(&band, ctx);
+
+        /* 发送缓冲区空闲后再覆盖 */
+        lcd_dma_wait();
+        lcd_strip_copy(lcd_strip_tx_buf, lcd_strip_band_buf, pixels);
+        (void)lcd_dma_start(lcd_strip_tx_buf, true, &LCD_DATA_REG, false, pixels, 0, 0);
+    }
+
+    lcd_dma_wait();
+}
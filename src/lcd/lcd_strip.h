@@ -0,0 +1,69 @@
+#ifndef LCD_LCD_STRIP_H
+#define LCD_LCD_STRIP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lcd/lcd.h"
+
+/**
+ * @brief 条带渲染器：不需要整帧缓冲区的全屏合成绘制。
+ *
+ * - 目标区域按行切成若干条带（band），每条带在 CCMRAM 的小缓冲区中由回调完整绘制（合成所有图层）；
+ * - 条带完成后拷贝到 SRAM 发送缓冲区，由 DMA2 推送到 LCD，同时 CPU 开始绘制下一条带。
+ * - 整个区域只设置一次窗口，条带数据依靠 GRAM 地址自动递增首尾相接。
+ *
+ * CCMRAM 只挂在 D-bus 上：CPU 绘制时不与 DMA（SRAM/FSMC 总线）争用；
+ * 但 DMA2 也无法读取 CCMRAM，因此需要一次 CCM -> SRAM 的 32-bit 拷贝（远快于 LCD 总线写）。
+ *
+ * 详见: src/lcd/lcd.md 第 15 节
+ */
+
+/** 条带缓冲区容量（像素），位于 CCMRAM；全宽 320 时默认每条带 16 行。 */
+#ifndef LCD_STRIP_PIXELS
+#define LCD_STRIP_PIXELS (LCD_PANEL_WIDTH * 16U)
+#endif
+
+/** 当前条带：buf 为 w*h 像素（行优先，stride = w），(x,y) 为其在屏幕上的左上角。 */
+typedef struct
+{
+    lcd_color565_t *buf;
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+} lcd_strip_band_t;
+
+/** 绘制一条带的回调：应把与该条带相交的全部内容画进 band->buf。 */
+typedef void (*lcd_strip_render_fn_t)(const lcd_strip_band_t *band, void *ctx);
+
+/**
+ * @brief 以条带方式渲染并输出矩形区域（默认裁剪，阻塞到最后一条带推送完成）。
+ *
+ * 渲染期间不要调用其它 LCD API（会打断连续的 GRAM 写）。
+ */
+void lcd_strip_render(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                      lcd_strip_render_fn_t fn, void *ctx);
+
+/* -------- 条带内绘制辅助（屏幕坐标，自动裁剪到条带） -------- */
+
+void lcd_strip_fill_rect(const lcd_strip_band_t *band,
+                         int16_t x, int16_t y, uint16_t w, uint16_t h,
+                         lcd_color565_t color);
+
+void lcd_strip_draw_pixel(const lcd_strip_band_t *band, int16_t x, int16_t y, lcd_color565_t color);
+
+/** 把 w*h 的 RGB565 图像（行优先、连续存放）放到屏幕 (x,y)，只拷贝与条带相交的部分。 */
+void lcd_strip_blit(const lcd_strip_band_t *band,
+                    int16_t x, int16_t y, uint16_t w, uint16_t h,
+                    const lcd_color565_t *src);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCD_LCD_STRIP_H */
@@ -0,0 +1,243 @@
+#include "lcd/lcd_te.h"
+
+#include "stm32f4xx.h"
+
+/* 面板扫描行数（与旋转无关） */
+#define LCD_TE_LINES (LCD_PANEL_HEIGHT)
+
+static bool lcd_te_ok;
+static bool lcd_te_have_last;
+static uint32_t lcd_te_last_start;
+static lcd_present_stats_t lcd_te_stats;
+
+#if LCD_TE_EXTI_ENABLE
+static volatile uint32_t lcd_te_pulses;
+
+void LCD_TE_IRQHandler(void)
+{
+    if ((READ_REG(EXTI->PR) & (1UL << LCD_TE_PIN)) != 0U)
+    {
+        WRITE_REG(EXTI->PR, 1UL << LCD_TE_PIN);
+        lcd_te_pulses++;
+    }
+}
+
+static void lcd_te_exti_init(void)
+{
+    const uint32_t sh = (LCD_TE_PIN & 3U) * 4U;
+
+    SET_BIT(RCC->AHB1ENR, LCD_TE_GPIO_EN);
+    SET_BIT(RCC->APB2ENR, RCC_APB2ENR_SYSCFGEN);
+    (void)READ_REG(RCC->APB2ENR);
+
+    /* 输入，无上下拉（TE 为推挽输出） */
+    CLEAR_BIT(LCD_TE_GPIO->MODER, 3UL << (LCD_TE_PIN * 2U));
+    CLEAR_BIT(LCD_TE_GPIO->PUPDR, 3UL << (LCD_TE_PIN * 2U));
+
+    MODIFY_REG(SYSCFG->EXTICR[LCD_TE_PIN >> 2], 0xFUL << sh, (uint32_t)LCD_TE_EXTI_PORT << sh);
+    SET_BIT(EXTI->RTSR, 1UL << LCD_TE_PIN);
+    CLEAR_BIT(EXTI->FTSR, 1UL << LCD_TE_PIN);
+    WRITE_REG(EXTI->PR, 1UL << LCD_TE_PIN);
+    SET_BIT(EXTI->IMR, 1UL << LCD_TE_PIN);
+
+    NVIC_EnableIRQ(LCD_TE_IRQN);
+}
+#endif
+
+/*
+ * 等待扫描线到达 line：
+ * - EXTI：0x44 设定触发行后等下一个 TE 脉冲
+ * - 轮询：反复读 0x45，落在 [line, line + window)（模扫描行数）内即返回
+ * 超过 timeout 个周期返回 false。
+ */
+static bool lcd_te_wait(uint16_t line, uint32_t window, uint32_t timeout)
+{
+    const uint32_t t0 = DWT->CYCCNT;
+
+#if LCD_TE_EXTI_ENABLE
+    (void)window;
+    lcd_set_tear_scanline(line);
+    const uint32_t n = lcd_te_pulses;
+    while (lcd_te_pulses == n)
+    {
+        if ((DWT->CYCCNT - t0) > timeout)
+        {
+            return false;
+        }
+    }
+    return true;
+#else
+    for (;;)
+    {
+        const uint32_t d = ((uint32_t)lcd_get_scanline() + LCD_TE_LINES - line) % LCD_TE_LINES;
+        if (d < window)
+        {
+            return true;
+        }
+        if ((DWT->CYCCNT - t0) > timeout)
+        {
+            return false;
+        }
+    }
+#endif
+}
+
+/*
+ * 区域在面板扫描方向上覆盖的行 [r0, r1]，由 lcd_set_rotation() 的 MADCTL 推导：
+ * MY 反转行序，MV 交换行列（横屏时逻辑 x 对应扫描行）。
+ */
+static void lcd_te_native_rows(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t *r0, uint32_t *r1)
+{
+    const uint32_t last = LCD_TE_LINES - 1U;
+
+    switch (lcd_get_rotation())
+    {
+    case LCD_ROTATION_90:
+        *r0 = x;
+        *r1 = (uint32_t)x + w - 1U;
+        break;
+    case LCD_ROTATION_180:
+        *r0 = last - ((uint32_t)y + h - 1U);
+        *r1 = last - y;
+        break;
+    case LCD_ROTATION_270:
+        *r0 = last - ((uint32_t)x + w - 1U);
+        *r1 = last - x;
+        break;
+    case LCD_ROTATION_0:
+    default:
+        *r0 = y;
+        *r1 = (uint32_t)y + h - 1U;
+        break;
+    }
+}
+
+bool lcd_te_init(void)
+{
+    const uint32_t timeout = SystemCoreClock / 10U;
+    uint32_t t0;
+
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+
+    lcd_te_ok = false;
+    lcd_te_have_last = false;
+    lcd_present_reset_stats();
+    lcd_te_stats.period_cycles = 0U;
+
+    lcd_set_tear_on(true);
+#if LCD_TE_EXTI_ENABLE
+    lcd_te_exti_init();
+#endif
+
+    /* 第 0 行 -> 中间 -> 第 0 行：一个完整刷新周期（窗口取 2 行，读一次扫描行远快于一行的时间） */
+    if (!lcd_te_wait(0U, 2U, timeout))
+    {
+        return false;
+    }
+    t0 = DWT->CYCCNT;
+    if (!lcd_te_wait((uint16_t)(LCD_TE_LINES / 2U), 2U, timeout) || !lcd_te_wait(0U, 2U, timeout))
+    {
+        return false;
+    }
+
+    lcd_te_stats.period_cycles = DWT->CYCCNT - t0;
+    lcd_te_ok = true;
+    return true;
+}
+
+void lcd_present(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const lcd_color565_t *src)
+{
+    uint16_t cx = x;
+    uint16_t cy = y;
+    uint16_t cw = w;
+    uint16_t ch = h;
+    uint32_t r0;
+    uint32_t r1;
+    uint32_t rows;
+    uint32_t target;
+    uint32_t window;
+    uint32_t budget;
+    uint32_t t0;
+    uint32_t t1;
+    uint32_t t2;
+
+    /* 只用裁剪结果计算扫描行范围；推送仍交给 lcd_blit()（其内部按原宽度作为源 stride 裁剪） */
+    if ((src == 0) || !lcd_clip_rect(&cx, &cy, &cw, &ch))
+    {
+        return;
+    }
+
+    lcd_te_native_rows(cx, cy, cw, ch, &r0, &r1);
+    rows = r1 - r0 + 1U;
+
+    if (lcd_get_rotation() == LCD_ROTATION_0)
+    {
+        /* 追光：写指针与扫描线同向，推送速度快于扫描即不撕裂 */
+        target = (r0 + LCD_TE_LINES - LCD_TE_MARGIN_LINES) % LCD_TE_LINES;
+        /* 只接受 [r0 - 余量, r0)：扫描线一旦进入区域再开始写，就会在区域内撕裂 */
+        window = LCD_TE_MARGIN_LINES;
+        budget = (lcd_te_stats.period_cycles / LCD_TE_LINES) * rows;
+    }
+    else
+    {
+        /* 扫后写：扫描线离开区域后开始，须在它绕回区域前写完 */
+        target = (r1 + 1U) % LCD_TE_LINES;
+        window = LCD_TE_WINDOW_LINES;
+        budget = (lcd_te_stats.period_cycles / LCD_TE_LINES) * (LCD_TE_LINES - rows);
+    }
+
+    t0 = DWT->CYCCNT;
+    if (lcd_te_ok && !lcd_te_wait((uint16_t)target, window, 2U * lcd_te_stats.period_cycles))
+    {
+        lcd_te_stats.timeouts++;
+    }
+    t1 = DWT->CYCCNT;
+
+    lcd_blit(x, y, w, h, src);
+    t2 = DWT->CYCCNT;
+
+    /* 与上一帧启动时刻相差 n 个周期（四舍五入），n > 1 即掉了 n - 1 个刷新周期 */
+    if (lcd_te_ok && lcd_te_have_last)
+    {
+        const uint32_t n = ((t1 - lcd_te_last_start) + (lcd_te_stats.period_cycles / 2U)) / lcd_te_stats.period_cycles;
+        if (n > 1U)
+        {
+            lcd_te_stats.missed_vsyncs += n - 1U;
+        }
+    }
+    lcd_te_last_start = t1;
+    lcd_te_have_last = true;
+
+    lcd_te_stats.frames++;
+    lcd_te_stats.wait_cycles_last = t1 - t0;
+    lcd_te_stats.flush_cycles_last = t2 - t1;
+    if ((t2 - t1) > lcd_te_stats.flush_cycles_max)
+    {
+        lcd_te_stats.flush_cycles_max = t2 - t1;
+    }
+    if (lcd_te_ok && ((t2 - t1) > budget))
+    {
+        lcd_te_stats.late++;
+    }
+}
+
+void lcd_present_get_stats(lcd_present_stats_t *out)
+{
+    if (out != 0)
+    {
+        *out = lcd_te_stats;
+    }
+}
+
+void lcd_present_reset_stats(void)
+{
+    /* 刷新周期是测量结果，不随统计清零 */
+    lcd_te_stats.frames = 0U;
+    lcd_te_stats.missed_vsyncs = 0U;
+    lcd_te_stats.late = 0U;
+    lcd_te_stats.timeouts = 0U;
+    lcd_te_stats.wait_cycles_last = 0U;
+    lcd_te_stats.flush_cycles_last = 0U;
+    lcd_te_stats.flush_cycles_max = 0U;
+}
@@ -0,0 +1,92 @@
+#ifndef LCD_LCD_TE_H
+#define LCD_LCD_TE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lcd/lcd.h"
+
+/**
+ * @brief 与控制器扫描同步的帧推送（防撕裂）。
+ *
+ * 控制器以约 60Hz 从 GRAM 第 0 行扫到第 479 行（面板扫描方向）。推送若与扫描线交叉，
+ * 同一帧里就会出现一半新、一半旧的画面（撕裂）。lcd_present() 先等扫描线到达合适位置再启动推送：
+ *
+ * - 推送方向与扫描方向一致（LCD_ROTATION_0）：“追光”——扫描线刚到区域上方 LCD_TE_MARGIN_LINES 行时开始，
+ *   只要推送速度快于扫描速度，写指针始终领先于扫描线
+ * - 其它方向：“扫后写”——扫描线刚离开区域时开始，须在扫描线绕回区域之前写完
+ *
+ * 扫描位置来源：
+ * - LCD_TE_EXTI_ENABLE = 1：TE 引脚接到 MCU，0x44 设定触发行，EXTI 上升沿中断
+ * - 否则（本板引脚表未引出 TE，默认）：轮询 0x45 Get Scanline
+ *
+ * 详见: src/lcd/lcd.md 第 20 节
+ */
+
+/** TE 是否接到 MCU 并使用 EXTI；默认 0（轮询 0x45）。 */
+#ifndef LCD_TE_EXTI_ENABLE
+#define LCD_TE_EXTI_ENABLE (0)
+#endif
+
+/** TE 引脚（仅 LCD_TE_EXTI_ENABLE = 1 时使用，按实际飞线修改；默认 PB6 / EXTI9_5）。 */
+#ifndef LCD_TE_GPIO
+#define LCD_TE_GPIO        GPIOB
+#define LCD_TE_GPIO_EN     RCC_AHB1ENR_GPIOBEN
+#define LCD_TE_EXTI_PORT   (1U) /* SYSCFG_EXTICR 端口号：A=0, B=1, ... */
+#define LCD_TE_PIN         (6U)
+#define LCD_TE_IRQN        EXTI9_5_IRQn
+#define LCD_TE_IRQHandler  EXTI9_5_IRQHandler
+#endif
+
+/** “追光”模式下提前量（行）：吸收触发到 DMA 启动之间的延迟。 */
+#ifndef LCD_TE_MARGIN_LINES
+#define LCD_TE_MARGIN_LINES (8U)
+#endif
+
+/**
+ * 轮询模式下“扫后写”接受的触发窗口（行）：扫描线落在 [目标, 目标 + 窗口) 内即开始推送。
+ * “追光”模式的窗口固定为 LCD_TE_MARGIN_LINES，扫描线进入区域后不再开始推送。
+ */
+#ifndef LCD_TE_WINDOW_LINES
+#define LCD_TE_WINDOW_LINES (16U)
+#endif
+
+/** @brief 帧节奏统计（周期数为 HCLK 周期，DWT CYCCNT 计量）。 */
+typedef struct
+{
+    uint32_t frames;            /* lcd_present() 次数 */
+    uint32_t missed_vsyncs;     /* 相邻两次推送之间多跨过的刷新周期数（掉帧） */
+    uint32_t late;              /* 推送耗时超出不撕裂预算的帧数 */
+    uint32_t timeouts;          /* 等不到触发行（约 2 个刷新周期）而直接推送的帧数 */
+    uint32_t period_cycles;     /* lcd_te_init() 测得的刷新周期 */
+    uint32_t wait_cycles_last;  /* 最近一帧等待扫描线的时间 */
+    uint32_t flush_cycles_last; /* 最近一帧推送耗时 */
+    uint32_t flush_cycles_max;
+} lcd_present_stats_t;
+
+/**
+ * @brief 打开 TE 输出、（EXTI 模式）配置中断，并测量刷新周期。需在 lcd_panel_init() 之后调用。
+ *
+ * @return 读不到变化的扫描行 / 等不到 TE（约 100ms）时返回 false，此后 lcd_present() 不做同步。
+ */
+bool lcd_te_init(void);
+
+/**
+ * @brief 在合适的扫描位置把 w*h 的 RGB565 缓冲区推送到 (x,y)（同 lcd_blit()，阻塞到推送完成）。
+ *
+ * 源缓冲区 DMA 可达时走 DMA2，否则 CPU 展开写。
+ */
+void lcd_present(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const lcd_color565_t *src);
+
+void lcd_present_get_stats(lcd_present_stats_t *out);
+void lcd_present_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCD_LCD_TE_H */
@@ -1,5 +1,6 @@
 #include "clock/clock.h"
 #include "delay/delay.h"
+#include "timebase/timebase.h"
 
 #include "timer/basic_timer.h"
 
@@ -9,6 +10,9 @@
 
 #include "lcd/lcd.h"
 
+#include "bench/bench_lcd_app.h"
+#include "selftest/selftest.h"
+
 int main(void)
 {
     /* 1) 时钟树：HSE=8MHz -> HCLK=168MHz */
@@ -20,6 +24,9 @@ int main(void)
         }
     }
 
+    /* 1.1) 64-bit 周期/微秒时间基准（DWT CYCCNT，按最终 HCLK 计时） */
+    time_init();
+
     /* 2) SysTick 1ms 时基（必须在主频最终确定后配置） */
     delay_init();
 
@@ -32,11 +39,19 @@ int main(void)
     key_init();
     lcd_panel_init();
 
+#if SELFTEST_APP
+    /* selftest.elf：时钟 / 延时 / LCD 自检，结果输出到 USART1 后进入下面的循环 */
+    (void)selftest_run();
+#elif BENCH_LCD_APP
+    /* bench_lcd.elf：LCD 吞吐率测试，报告输出到 USART1 与屏幕后进入下面的循环 */
+    bench_lcd_app_run();
+#else
     /* 上电后简单清屏+色块，便于验证窗口/填充 */
     lcd_clear((lcd_color565_t)0x0000); /* BLACK */
     lcd_fill_rect(0, 0, 80, 80, (lcd_color565_t)0xF800);   /* RED */
     lcd_fill_rect(80, 0, 80, 80, (lcd_color565_t)0x07E0);  /* GREEN */
     lcd_fill_rect(160, 0, 80, 80, (lcd_color565_t)0x001F); /* BLUE */
+#endif
 
     /* 4) 简单跑灯/蜂鸣器验证 */
     while (1)
@@ -0,0 +1,230 @@
+#include "selftest/selftest.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "bench/bench.h"
+#include "bench/bench_timer.h"
+#include "clock/clock.h"
+#include "delay/delay.h"
+#include "lcd/lcd.h"
+#include "timebase/timebase.h"
+#include "timer/basic_timer.h"
+#include "usart/usart.h"
+
+#include "stm32f4xx.h"
+
+/* 每次阻塞延时的固定开销上限（HCLK 周期）：函数调用、TIM6 的 1us tick 粒度与轮询 */
+#define SELFTEST_DELAY_OVERHEAD_CYCLES (2000U)
+
+/* LCD 读回区域：8x8，放在 SRAM（lcd_read_rect() 大块读走 DMA2） */
+#define SELFTEST_LCD_N (8U)
+
+static lcd_color565_t selftest_lcd_buf[SELFTEST_LCD_N * SELFTEST_LCD_N];
+static uint32_t selftest_failures;
+
+static void selftest_line(const char *fmt, ...)
+{
+    char buf[96];
+    va_list ap;
+
+    va_start(ap, fmt);
+    (void)vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+
+    usart_puts(buf);
+    usart_puts("\n");
+}
+
+static void selftest_result(const char *name, bool ok, const char *detail)
+{
+    selftest_line("selftest %-12s %s  %s", name, ok ? "PASS" : "FAIL", detail);
+    if (!ok)
+    {
+        selftest_failures++;
+    }
+}
+
+/* ----------------------------- 时钟 ----------------------------- */
+
+static void selftest_clock(void)
+{
+    char d[64];
+
+    (void)snprintf(d, sizeof(d), "HCLK %lu Hz", (unsigned long)clock_get_hclk_hz());
+    selftest_result("hclk", clock_get_hclk_hz() == 168000000U, d);
+
+    selftest_result("sysclk_pll", READ_BIT(RCC->CFGR, RCC_CFGR_SWS) == RCC_CFGR_SWS_PLL, "RCC_CFGR.SWS");
+    selftest_result("flash_ws", READ_BIT(FLASH->ACR, FLASH_ACR_LATENCY) == FLASH_ACR_LATENCY_5WS, "FLASH_ACR.LATENCY");
+}
+
+/* ----------------------------- 延时 ----------------------------- */
+
+/*
+ * 以 DWT 周期核对一次延时：不超过上限；min_exact 时还要求不短于请求值。
+ * SysTick 延时从节拍边沿起算，边沿本身要到轮询发现才开始计时，可能略短，下限放宽同样比例。
+ */
+static void selftest_delay_check(const char *name, uint32_t us, uint32_t cycles, bool min_exact)
+{
+    const uint64_t expect = ((uint64_t)us * SystemCoreClock) / 1000000U;
+    const uint64_t limit = ((expect * (100U + SELFTEST_DELAY_SLACK_PCT)) / 100U) + SELFTEST_DELAY_OVERHEAD_CYCLES;
+    const uint64_t lo = min_exact ? expect : ((expect * (100U - SELFTEST_DELAY_SLACK_PCT)) / 100U);
+    char d[64];
+
+    (void)snprintf(d, sizeof(d), "%lu us -> %lu cyc (expect %lu)", (unsigned long)us, (unsigned long)cycles,
+                   (unsigned long)expect);
+    selftest_result(name, (cycles >= lo) && (cycles <= limit), d);
+}
+
+static void selftest_delay(void)
+{
+    static const uint32_t us_cases[] = {1U, 2U, 5U, 10U, 100U, 1000U, 10000U};
+    uint32_t t0;
+
+    /* 1..100us 走 DWT 周期计数，更长的走自由运行的 TIM6 */
+    for (uint32_t i = 0U; i < (sizeof(us_cases) / sizeof(us_cases[0])); i++)
+    {
+        t0 = bench_cycles();
+        basic_timer_delay_us(us_cases[i]);
+        selftest_delay_check("timer_us", us_cases[i], bench_cycles() - t0, true);
+    }
+
+    /* 亚微秒：不短于请求值，超出部分不超过 1us */
+    const uint32_t mhz = SystemCoreClock / 1000000U;
+    const uint32_t expect = (500U * mhz) / 1000U;
+    char d[64];
+
+    t0 = bench_cycles();
+    basic_timer_delay_ns(500U);
+    const uint32_t cycles = bench_cycles() - t0;
+    (void)snprintf(d, sizeof(d), "500 ns -> %lu cyc (expect %lu)", (unsigned long)cycles, (unsigned long)expect);
+    selftest_result("timer_ns", (cycles >= expect) && (cycles <= (expect + mhz)), d);
+
+    /* SysTick 1ms 粒度：先对齐到节拍边沿，delay_ms(10) 才是完整的 10ms */
+    const uint32_t tick = delay_get_tick();
+    while (delay_get_tick() == tick)
+    {
+        /* 等待下一个节拍 */
+    }
+    t0 = bench_cycles();
+    delay_ms(10U);
+    selftest_delay_check("delay_ms", 10000U, bench_cycles() - t0, false);
+}
+
+/* 精度表只作记录，不计入失败：每行 请求 ns / 期望周期 / 实测最小..最大 / 单次计数参考实现 */
+static void selftest_timer_table(void)
+{
+    static bench_timer_row_t rows[BENCH_TIMER_CASES];
+
+    bench_timer_delays(rows, bench_timer_cases_ns, BENCH_TIMER_CASES);
+
+    selftest_line("timer table  overhead %lu cyc", (unsigned long)basic_timer_overhead_cycles());
+    selftest_line("%9s %9s %9s %9s %9s %9s", "req_ns", "expect", "min", "max", "ref_min", "ref_max");
+    for (uint32_t i = 0U; i < BENCH_TIMER_CASES; i++)
+    {
+        const bench_timer_row_t *r = &rows[i];
+        selftest_line("%9lu %9lu %9lu %9lu %9lu %9lu", (unsigned long)r->req_ns, (unsigned long)r->expect_cycles,
+                      (unsigned long)r->min_cycles, (unsigned long)r->max_cycles, (unsigned long)r->ref_min_cycles,
+                      (unsigned long)r->ref_max_cycles);
+    }
+}
+
+/* ----------------------------- 时间基准 ----------------------------- */
+
+static void selftest_timebase(void)
+{
+    uint64_t prev = time_now_cycles();
+    uint32_t backwards = 0U;
+    char d[64];
+
+    for (uint32_t i = 0U; i < 1000U; i++)
+    {
+        const uint64_t now = time_now_cycles();
+        if (now < prev)
+        {
+            backwards++;
+        }
+        prev = now;
+    }
+    (void)snprintf(d, sizeof(d), "%lu/1000 reads went backwards", (unsigned long)backwards);
+    selftest_result("time_mono", backwards == 0U, d);
+
+    /* time_now_us() 与 TIM6 两个独立时钟源互相印证 */
+    const uint64_t us0 = time_now_us();
+    basic_timer_delay_us(1000U);
+    const uint64_t us = time_now_us() - us0;
+    (void)snprintf(d, sizeof(d), "1000 us -> %lu us", (unsigned long)us);
+    selftest_result("time_us", (us >= 1000U) && (us <= ((1000U * (100U + SELFTEST_DELAY_SLACK_PCT)) / 100U) + 20U), d);
+}
+
+/* ----------------------------- LCD ----------------------------- */
+
+/*
+ * 写一块纯色再读回。读回全部为 0x0000 / 0xFFFF 且与写入值不同，视为没有接屏（仿真器里 FSMC 未建模），
+ * 记为 SKIP 而不是失败。
+ */
+static void selftest_lcd(void)
+{
+    const lcd_color565_t color = (lcd_color565_t)0xA5A5U;
+    uint32_t mismatches = 0U;
+    bool blank = true;
+    char d[64];
+
+    lcd_fill_rect(0U, 0U, SELFTEST_LCD_N, SELFTEST_LCD_N, color);
+    if (!lcd_read_rect(0U, 0U, SELFTEST_LCD_N, SELFTEST_LCD_N, selftest_lcd_buf))
+    {
+        selftest_result("lcd_readback", false, "lcd_read_rect() rejected");
+        return;
+    }
+
+    for (uint32_t i = 0U; i < (SELFTEST_LCD_N * SELFTEST_LCD_N); i++)
+    {
+        if (selftest_lcd_buf[i] != color)
+        {
+            mismatches++;
+        }
+        if ((selftest_lcd_buf[i] != 0x0000U) && (selftest_lcd_buf[i] != 0xFFFFU))
+        {
+            blank = false;
+        }
+    }
+
+    if (blank && (mismatches != 0U))
+    {
+        selftest_line("selftest %-12s SKIP  no panel", "lcd_readback");
+        return;
+    }
+
+    (void)snprintf(d, sizeof(d), "%lu/%lu px differ", (unsigned long)mismatches,
+                   (unsigned long)(SELFTEST_LCD_N * SELFTEST_LCD_N));
+    selftest_result("lcd_readback", mismatches == 0U, d);
+}
+
+uint32_t selftest_run(void)
+{
+    usart_init(USART_DEFAULT_BAUD);
+    bench_init();
+    selftest_failures = 0U;
+
+    selftest_line("selftest start  HCLK %lu MHz  tick %lu ms", (unsigned long)(SystemCoreClock / 1000000U),
+                  (unsigned long)delay_get_tick());
+
+    selftest_clock();
+    selftest_delay();
+    selftest_timer_table();
+    selftest_timebase();
+    selftest_lcd();
+
+    if (selftest_failures == 0U)
+    {
+        selftest_line("SELFTEST PASS");
+    }
+    else
+    {
+        selftest_line("SELFTEST FAIL %lu", (unsigned long)selftest_failures);
+    }
+    usart_flush();
+
+    return selftest_failures;
+}
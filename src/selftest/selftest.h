@@ -0,0 +1,36 @@
+#ifndef SELFTEST_SELFTEST_H
+#define SELFTEST_SELFTEST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief selftest 固件入口：启动后检查时钟树、延时精度与 LCD 读回，结果逐行输出到 USART1。
+ *
+ * CMake 目标 selftest.elf 定义 SELFTEST_APP=1，main() 在外设初始化后调用本函数；
+ * 普通 firmware.elf 不调用。报告最后一行固定为 "SELFTEST PASS" 或 "SELFTEST FAIL <n>"，
+ * 仿真器（tools/renode/selftest.resc）与主机构建（fwhost selftest）都按这一行判定结果。
+ *
+ * 详见: src/selftest/selftest.md
+ */
+
+#ifndef SELFTEST_APP
+#define SELFTEST_APP (0)
+#endif
+
+/** 延时检查允许的上限：实测不超过请求值 × (100 + SELFTEST_DELAY_SLACK_PCT)% + 固定开销。 */
+#ifndef SELFTEST_DELAY_SLACK_PCT
+#define SELFTEST_DELAY_SLACK_PCT (10U)
+#endif
+
+/** 跑完全部检查并输出报告，返回失败项数。需先完成时钟、delay、basic_timer 与 lcd_panel_init()。 */
+uint32_t selftest_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SELFTEST_SELFTEST_H */
@@ -0,0 +1,58 @@
+#include "timebase/timebase.h"
+
+#include <stdbool.h>
+
+#include "stm32f4xx.h"
+
+static uint32_t time_hi;      /* 扩展的高 32 位（CYCCNT 回绕次数） */
+static uint32_t time_last;    /* 上次读到的 CYCCNT */
+static bool time_ready;
+
+void time_init(void)
+{
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    if (!time_ready)
+    {
+        WRITE_REG(DWT->CYCCNT, 0U);
+        time_hi = 0U;
+        time_last = 0U;
+        time_ready = true;
+    }
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+
+    __set_PRIMASK(primask);
+}
+
+uint64_t time_now_cycles(void)
+{
+    /* 读 CYCCNT 与更新扩展状态必须不可分割：否则中断里的读取可能让高位重复进位 */
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    const uint32_t now = DWT->CYCCNT;
+    if (now < time_last)
+    {
+        time_hi++;
+    }
+    time_last = now;
+    const uint32_t hi = time_hi;
+
+    __set_PRIMASK(primask);
+
+    return ((uint64_t)hi << 32) | now;
+}
+
+uint64_t time_cycles_to_us(uint64_t cycles)
+{
+    const uint32_t per_us = SystemCoreClock / 1000000U;
+
+    return (per_us != 0U) ? (cycles / per_us) : 0U;
+}
+
+uint64_t time_now_us(void)
+{
+    return time_cycles_to_us(time_now_cycles());
+}
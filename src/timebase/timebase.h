@@ -0,0 +1,40 @@
+#ifndef TIMEBASE_TIMEBASE_H
+#define TIMEBASE_TIMEBASE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief 64-bit 单调时间基准：DWT CYCCNT（HCLK 周期）+ 软件扩展的高 32 位。
+ *
+ * - CYCCNT 为 32-bit，168MHz 下约 25.5s 回绕；每次读取时与上次读数比较，变小即高位加 1
+ * - 读取在 PRIMASK 临界区内完成（十几个周期），主循环与任意中断里都可以调用
+ * - 只要两次读取间隔不超过一个回绕周期，结果就连续；SysTick_Handler 每 1024ms 读一次兜底
+ *
+ * 详见: src/timebase/timebase.md
+ */
+
+/**
+ * @brief 使能 DWT 周期计数。第一次调用时把 CYCCNT 与扩展高位清零，之后重复调用不影响计时。
+ *
+ * 在时钟树配置完成后调用；之前的计数按当时的 HCLK 计，time_now_us() 的换算会有偏差。
+ */
+void time_init(void);
+
+/** 自 time_init() 以来的 HCLK 周期数（64-bit，不回绕）。 */
+uint64_t time_now_cycles(void);
+
+/** 自 time_init() 以来的微秒数；含一次 64-bit 除法，热路径中建议先记 cycles、事后再换算。 */
+uint64_t time_now_us(void);
+
+/** 周期数换算为微秒（按当前 SystemCoreClock）。 */
+uint64_t time_cycles_to_us(uint64_t cycles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMEBASE_TIMEBASE_H */
@@ -1,13 +1,20 @@
 #include "timer/basic_timer.h"
 
+#include "timebase/timebase.h"
+
 #include "stm32f4xx.h"
 
-/* TIM6 为 16-bit 基本定时器，ARR 最大 0xFFFF。
- * 将计数频率配置为 1MHz（1us/tick），单次计数模式（OPM）下：
- * - 置位 CEN 后开始从 0 计数到 ARR
- * - 产生更新事件并置 UIF
+/* TIM6 为 16-bit 基本定时器，计数频率配置为 1MHz（1us/tick）。
+ * 自由运行：ARR = 0xFFFF、不开 OPM，CNT 每 65.536ms 回绕一次；
+ * 延时只读 CNT，按 16-bit 差值累加已过的 tick，轮询间隔只要小于一个回绕周期即可。
  */
 
+/* 每 us 的 HCLK 周期数，init 时由 SystemCoreClock 算出 */
+static uint32_t basic_timer_hclk_mhz;
+
+/* 一次 DWT 延时调用的固定开销（HCLK 周期）：调用 / 换算 / 退出循环，init 时实测 */
+static uint32_t basic_timer_dwt_overhead;
+
 static uint32_t basic_timer_get_apb_prescaler(uint32_t ppre_bits)
 {
     /* PPRE[2:0] 编码：
@@ -52,38 +59,47 @@ static uint32_t basic_timer_tim6_clk_hz(void)
     return 2U * pclk1_hz;
 }
 
-static void basic_timer_delay_us_chunk(uint16_t us)
+/* 从 t0（CYCCNT）起忙等 cycles 个周期，扣除固定开销 */
+static inline void basic_timer_spin_from(uint32_t t0, uint32_t cycles)
 {
-    if (us == 0U)
+    if (cycles <= basic_timer_dwt_overhead)
     {
         return;
     }
+    cycles -= basic_timer_dwt_overhead;
 
-    /* 停止并清标志 */
-    CLEAR_BIT(TIM6->CR1, TIM_CR1_CEN);
-    WRITE_REG(TIM6->SR, 0U);
-
-    /* 单次计数：计数 us 个 tick（1 tick = 1us） */
-    WRITE_REG(TIM6->CNT, 0U);
-    WRITE_REG(TIM6->ARR, (uint32_t)us - 1U);
-
-    /* 触发更新事件，将 PSC/ARR 立即装载 */
-    WRITE_REG(TIM6->EGR, TIM_EGR_UG);
-
-    /* UG 会触发一次更新事件并可能置位 UIF，需要清除后再开始计数 */
-    WRITE_REG(TIM6->SR, 0U);
+    while ((READ_REG(DWT->CYCCNT) - t0) < cycles)
+    {
+        /* busy wait */
+    }
+}
 
-    /* 启动计数 */
-    SET_BIT(TIM6->CR1, TIM_CR1_CEN);
+/*
+ * 自由运行的 TIM6 上等待 ticks 个 tick。
+ * 起点读数落在某个 tick 的中间，要等到差值超过 ticks（多跨一个边沿）才能保证不短于请求值，
+ * 因此实际耗时在 (ticks, ticks + 1] us 之间。
+ */
+static void basic_timer_wait_ticks(uint64_t ticks)
+{
+    uint16_t last = (uint16_t)READ_REG(TIM6->CNT);
+    uint64_t elapsed = 0U;
 
-    /* 阻塞等待更新完成 */
-    while ((READ_BIT(TIM6->SR, TIM_SR_UIF)) == 0U)
+    while (elapsed <= ticks)
     {
-        /* busy wait */
+        const uint16_t now = (uint16_t)READ_REG(TIM6->CNT);
+        elapsed += (uint16_t)(now - last);
+        last = now;
     }
+}
 
-    /* 清除 UIF，避免下次误判 */
+/* ARR = 0xFFFF、OPM = 0，UG 装载 PSC 后开始计数 */
+static void basic_timer_start_free_run(void)
+{
+    CLEAR_BIT(TIM6->CR1, TIM_CR1_CEN | TIM_CR1_OPM);
+    WRITE_REG(TIM6->ARR, 0xFFFFU);
+    WRITE_REG(TIM6->EGR, TIM_EGR_UG);
     WRITE_REG(TIM6->SR, 0U);
+    SET_BIT(TIM6->CR1, TIM_CR1_CEN);
 }
 
 void basic_timer_init(void)
@@ -107,41 +123,134 @@ void basic_timer_init(void)
     /* PSC 寄存器写入的是 (div-1) */
     WRITE_REG(TIM6->PSC, psc_div - 1U);
 
-    /* 4) 单次计数模式（OPM=1），向上计数（DIR=0，默认） */
-    MODIFY_REG(TIM6->CR1,
-               TIM_CR1_OPM,
-               TIM_CR1_OPM);
+    /* 4) 自由运行，向上计数（DIR=0，默认） */
+    basic_timer_start_free_run();
 
-    /* 5) 默认 ARR 给一个最大值；实际延时会按需改写 */
-    WRITE_REG(TIM6->ARR, 0xFFFFU);
-    WRITE_REG(TIM6->CNT, 0U);
+    /* 5) DWT 周期计数：与 timebase 共用 CYCCNT，只读差值 */
+    time_init();
+    basic_timer_hclk_mhz = SystemCoreClock / 1000000U;
 
-    /* 6) 产生一次更新事件装载预分频 */
-    WRITE_REG(TIM6->EGR, TIM_EGR_UG);
-    WRITE_REG(TIM6->SR, 0U);
+    /* 6) 实测固定开销：开销清零后延时 1 个周期，减去一对 CYCCNT 读取本身的耗时；
+     *    各取 8 次最小值（首次调用含取指等待） */
+    basic_timer_dwt_overhead = 0U;
+    uint32_t best = 0xFFFFFFFFU;
+    uint32_t empty = 0xFFFFFFFFU;
+    for (uint32_t i = 0U; i < 8U; i++)
+    {
+        uint32_t t0 = READ_REG(DWT->CYCCNT);
+        uint32_t d = READ_REG(DWT->CYCCNT) - t0;
+        if (d < empty)
+        {
+            empty = d;
+        }
+
+        t0 = READ_REG(DWT->CYCCNT);
+        basic_timer_delay_cycles(1U);
+        d = READ_REG(DWT->CYCCNT) - t0;
+        if (d < best)
+        {
+            best = d;
+        }
+    }
+    basic_timer_dwt_overhead = (best > (empty + 1U)) ? (best - empty - 1U) : 0U;
+}
+
+void basic_timer_delay_cycles(uint32_t cycles)
+{
+    basic_timer_spin_from(READ_REG(DWT->CYCCNT), cycles);
+}
+
+void basic_timer_delay_ns(uint32_t ns)
+{
+    const uint32_t t0 = READ_REG(DWT->CYCCNT);
+
+    /* 拆成 us 与余数两部分换算，32-bit 不溢出（4.29s 内 cycles 不超过 2^32） */
+    const uint32_t cycles = ((ns / 1000U) * basic_timer_hclk_mhz) + (((ns % 1000U) * basic_timer_hclk_mhz) / 1000U);
+    basic_timer_spin_from(t0, cycles);
 }
 
 void basic_timer_delay_us(uint32_t us)
 {
-    /* TIM6 ARR 为 16-bit，分段处理 */
-    while (us != 0U)
+    if (us == 0U)
     {
-        uint16_t chunk = (us > 0xFFFFU) ? 0xFFFFU : (uint16_t)us;
-        basic_timer_delay_us_chunk(chunk);
-        us -= (uint32_t)chunk;
+        return;
     }
+
+    if (us <= BASIC_TIMER_DWT_MAX_US)
+    {
+        /* 起点在换算之前取，换算本身也计入延时 */
+        const uint32_t t0 = READ_REG(DWT->CYCCNT);
+        basic_timer_spin_from(t0, us * basic_timer_hclk_mhz);
+        return;
+    }
+
+    basic_timer_wait_ticks(us);
 }
 
 void basic_timer_delay_ms(uint32_t ms)
 {
+    if (ms == 0U)
+    {
+        return;
+    }
+
     /* 使用 64-bit 防止 ms*1000 溢出 */
-    uint64_t total_us = (uint64_t)ms * 1000ULL;
+    basic_timer_wait_ticks((uint64_t)ms * 1000ULL);
+}
+
+uint32_t basic_timer_overhead_cycles(void)
+{
+    return basic_timer_dwt_overhead;
+}
+
+/* ----------------------------- 参考实现（单次计数） ----------------------------- */
 
-    while (total_us != 0ULL)
+static void basic_timer_delay_us_chunk(uint16_t us)
+{
+    if (us == 0U)
     {
-        uint16_t chunk = (total_us > 0xFFFFULL) ? 0xFFFFU : (uint16_t)total_us;
-        basic_timer_delay_us_chunk(chunk);
-        total_us -= (uint64_t)chunk;
+        return;
+    }
+
+    /* 停止并清标志 */
+    CLEAR_BIT(TIM6->CR1, TIM_CR1_CEN);
+    WRITE_REG(TIM6->SR, 0U);
+
+    /* 单次计数：计数 us 个 tick（1 tick = 1us） */
+    WRITE_REG(TIM6->CNT, 0U);
+    WRITE_REG(TIM6->ARR, (uint32_t)us - 1U);
+
+    /* 触发更新事件，将 PSC/ARR 立即装载 */
+    WRITE_REG(TIM6->EGR, TIM_EGR_UG);
+
+    /* UG 会触发一次更新事件并可能置位 UIF，需要清除后再开始计数 */
+    WRITE_REG(TIM6->SR, 0U);
+
+    /* 启动计数 */
+    SET_BIT(TIM6->CR1, TIM_CR1_CEN);
+
+    /* 阻塞等待更新完成 */
+    while ((READ_BIT(TIM6->SR, TIM_SR_UIF)) == 0U)
+    {
+        /* busy wait */
     }
+
+    /* 清除 UIF，避免下次误判 */
+    WRITE_REG(TIM6->SR, 0U);
 }
 
+void basic_timer_delay_us_ref(uint32_t us)
+{
+    /* 单次计数模式（OPM=1）：置位 CEN 后从 0 计数到 ARR，产生更新事件并置 UIF */
+    SET_BIT(TIM6->CR1, TIM_CR1_OPM);
+
+    /* TIM6 ARR 为 16-bit，分段处理 */
+    while (us != 0U)
+    {
+        uint16_t chunk = (us > 0xFFFFU) ? 0xFFFFU : (uint16_t)us;
+        basic_timer_delay_us_chunk(chunk);
+        us -= (uint32_t)chunk;
+    }
+
+    basic_timer_start_free_run();
+}
@@ -8,30 +8,63 @@ extern "C" {
 #include <stdint.h>
 
 /**
- * @brief 初始化 TIM6 作为基本定时器延时源。
+ * @brief 阻塞式 ns / us / ms 延时：TIM6 自由运行 + DWT 周期计数。
  *
- * 设计目标：将 TIM6 配置为 1MHz 计数（1 tick = 1us），并使用单次计数模式（OPM）
- * 实现阻塞式 us/ms 延时。
+ * - TIM6 以 1MHz（1 tick = 1us）、ARR = 0xFFFF 一直计数，初始化后不再改写；
+ *   延时只读 CNT 累加差值，每次调用没有停止 / 装载 / UG 的重配置开销
+ * - 短延时（<= BASIC_TIMER_DWT_MAX_US）与 ns 级延时按 DWT CYCCNT 的周期差值忙等，
+ *   初始化时实测一次调用的固定开销并在每次延时中扣除
  *
- * @note 依赖 SystemCoreClock 已正确更新（例如在时钟初始化后调用）。
+ * 详见: src/timer/basic_timer.md
+ */
+
+/** 不超过该值（us）的 basic_timer_delay_us() 走 DWT 周期计数，更长的走 TIM6。 */
+#ifndef BASIC_TIMER_DWT_MAX_US
+#define BASIC_TIMER_DWT_MAX_US (100U)
+#endif
+
+/**
+ * @brief 初始化 TIM6（1MHz 自由运行）并使能 DWT 周期计数（time_init()），测量 DWT 延时的固定开销。
+ *
+ * @note 依赖 SystemCoreClock 已正确更新（例如在时钟初始化后调用）；修改时钟后需重新调用。
  */
 void basic_timer_init(void);
 
 /**
- * @brief 阻塞式 us 级延时（基于 TIM6）。
- * @param us 延时时长（微秒）。支持大于 65535us，内部会自动分段。
+ * @brief 阻塞式 us 级延时，不短于请求值。
+ * @param us 延时时长（微秒），0 立即返回。
  */
 void basic_timer_delay_us(uint32_t us);
 
 /**
- * @brief 阻塞式 ms 级延时（基于 TIM6）。
+ * @brief 阻塞式 ms 级延时（TIM6）。
  * @param ms 延时时长（毫秒）。
  */
 void basic_timer_delay_ms(uint32_t ms);
 
+/**
+ * @brief 阻塞式 ns 级延时（DWT），分辨率 1 个 HCLK 周期（168MHz 下约 6ns）。
+ *
+ * 请求值小于一次调用的固定开销时立即返回（实际耗时即该开销）。
+ * @param ns 延时时长（纳秒），最大约 4.29s。
+ */
+void basic_timer_delay_ns(uint32_t ns);
+
+/** @brief 阻塞 cycles 个 HCLK 周期（DWT），已扣除调用开销。 */
+void basic_timer_delay_cycles(uint32_t cycles);
+
+/** @brief init 时测得的 DWT 延时固定开销（HCLK 周期）。 */
+uint32_t basic_timer_overhead_cycles(void);
+
+/**
+ * @brief 旧的单次计数实现：每次调用停止 TIM6、写 CNT/ARR、UG 后以 OPM 计数，轮询 UIF。
+ *
+ * 仅作精度对比的参考（bench_timer_delays()）；返回前恢复自由运行配置。
+ */
+void basic_timer_delay_us_ref(uint32_t us);
+
 #ifdef __cplusplus
 }
 #endif
 
 #endif /* TIMER_BASIC_TIMER_H */
-
@@ -0,0 +1,71 @@
+#include "usart.h"
+
+#include "stm32f4xx.h"
+
+void usart_init(uint32_t baud)
+{
+    const uint32_t pclk2 = SystemCoreClock >> APBPrescTable[(RCC->CFGR & RCC_CFGR_PPRE2) >> RCC_CFGR_PPRE2_Pos];
+
+    if (baud == 0U)
+    {
+        baud = USART_DEFAULT_BAUD;
+    }
+
+    /* 1) 使能 GPIOA / USART1 时钟 */
+    SET_BIT(RCC->AHB1ENR, RCC_AHB1ENR_GPIOAEN);
+    SET_BIT(RCC->APB2ENR, RCC_APB2ENR_USART1EN);
+    (void)READ_BIT(RCC->APB2ENR, RCC_APB2ENR_USART1EN);
+
+    /* 2) PA9/PA10 复用功能 AF7，TX 推挽高速，RX 上拉 */
+    MODIFY_REG(GPIOA->MODER,
+               GPIO_MODER_MODER9 | GPIO_MODER_MODER10,
+               GPIO_MODER_MODER9_1 | GPIO_MODER_MODER10_1);
+    CLEAR_BIT(GPIOA->OTYPER, GPIO_OTYPER_OT9);
+    MODIFY_REG(GPIOA->OSPEEDR, GPIO_OSPEEDER_OSPEEDR9, GPIO_OSPEEDER_OSPEEDR9_1);
+    MODIFY_REG(GPIOA->PUPDR,
+               GPIO_PUPDR_PUPDR9 | GPIO_PUPDR_PUPDR10,
+               GPIO_PUPDR_PUPDR10_0);
+    MODIFY_REG(GPIOA->AFR[1],
+               GPIO_AFRH_AFSEL9 | GPIO_AFRH_AFSEL10,
+               (7UL << GPIO_AFRH_AFSEL9_Pos) | (7UL << GPIO_AFRH_AFSEL10_Pos));
+
+    /* 3) 8N1，16 倍过采样：BRR = fck / baud（四舍五入，低 4 位即小数部分） */
+    CLEAR_BIT(USART1->CR1, USART_CR1_UE);
+    WRITE_REG(USART1->CR2, 0U);
+    WRITE_REG(USART1->CR3, 0U);
+    WRITE_REG(USART1->BRR, (pclk2 + (baud / 2U)) / baud);
+    WRITE_REG(USART1->CR1, USART_CR1_TE | USART_CR1_RE);
+    SET_BIT(USART1->CR1, USART_CR1_UE);
+}
+
+void usart_putc(char c)
+{
+    while (READ_BIT(USART1->SR, USART_SR_TXE) == 0U)
+    {
+    }
+    WRITE_REG(USART1->DR, (uint8_t)c);
+}
+
+void usart_puts(const char *str)
+{
+    if (str == 0)
+    {
+        return;
+    }
+
+    for (; *str != '\0'; str++)
+    {
+        if (*str == '\n')
+        {
+            usart_putc('\r');
+        }
+        usart_putc(*str);
+    }
+}
+
+void usart_flush(void)
+{
+    while (READ_BIT(USART1->SR, USART_SR_TC) == 0U)
+    {
+    }
+}
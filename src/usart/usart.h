@@ -0,0 +1,39 @@
+#ifndef USART_USART_H
+#define USART_USART_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief USART1 轮询发送（PA9 = TX，PA10 = RX，8N1），用于输出测试报告与调试信息。
+ *
+ * 只实现阻塞发送；波特率按当前 APB2 时钟（168MHz 配置下为 84MHz）计算。
+ *
+ * 详见: src/usart/usart.md
+ */
+
+/** 默认波特率。 */
+#ifndef USART_DEFAULT_BAUD
+#define USART_DEFAULT_BAUD (115200U)
+#endif
+
+/** 配置 GPIO 与 USART1 并使能发送/接收；需在 clock_init_168mhz_hse8() 之后调用。 */
+void usart_init(uint32_t baud);
+
+/** 发送一个字节（等待 TXE）。 */
+void usart_putc(char c);
+
+/** 发送以 '\0' 结尾的字符串；'\n' 前自动补 '\r'。 */
+void usart_puts(const char *str);
+
+/** 等待最后一个字节移出移位寄存器（TC），切换时钟或进入低功耗前调用。 */
+void usart_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* USART_USART_H */
@@ -0,0 +1,322 @@
+#!/usr/bin/env python3
+"""
+等宽 TrueType 字体 -> src/font 使用的 C 位图表（纯 Python，无第三方依赖）。
+
+用法:
+    python3 tools/fontgen.py <font.ttf> <cell_height> <bpp> <name> > src/font/<name>.c
+
+- cell_height: 单元格高度（像素），按 hhea ascent - descent 缩放；单元格宽度取 advance 四舍五入
+- bpp: 1（覆盖率 >= THRESHOLD_1BPP 置位）或 4（覆盖率 0..15，用于抗锯齿字体）
+- 字符范围固定为可打印 ASCII 0x20..0x7E
+
+每个字形按行优先、MSB 在前连续打包（1bpp 每像素 1 bit，4bpp 每像素半字节），字形之间按字节对齐。
+覆盖率按每像素 SS x SS 个采样点、非零环绕规则计算。
+"""
+
+import struct
+import sys
+
+SS = 8          # 每像素每方向采样数
+THRESHOLD_1BPP = 0.4  # 略低于 50%：小字号下细笔画不断
+FIRST = 0x20
+LAST = 0x7E
+
+
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        num_tables = struct.unpack(">H", self.data[4:6])[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, off, length = struct.unpack(">4sIII", self.data[12 + 16 * i:28 + 16 * i])
+            self.tables[tag.decode("latin-1")] = (off, length)
+
+        head = self.tables["head"][0]
+        self.units_per_em = self.u16(head + 18)
+        self.loca_long = self.s16(head + 50) == 1
+        hhea = self.tables["hhea"][0]
+        self.ascent = self.s16(hhea + 4)
+        self.descent = self.s16(hhea + 6)
+        self.num_hmetrics = self.u16(hhea + 34)
+        self.cmap = self.read_cmap()
+
+    def u16(self, off):
+        return struct.unpack(">H", self.data[off:off + 2])[0]
+
+    def s16(self, off):
+        return struct.unpack(">h", self.data[off:off + 2])[0]
+
+    def u32(self, off):
+        return struct.unpack(">I", self.data[off:off + 4])[0]
+
+    def read_cmap(self):
+        base = self.tables["cmap"][0]
+        n = self.u16(base + 2)
+        for i in range(n):
+            pid, eid, off = struct.unpack(">HHI", self.data[base + 4 + 8 * i:base + 12 + 8 * i])
+            sub = base + off
+            if self.u16(sub) == 4 and pid in (0, 3):
+                return self.read_cmap4(sub)
+        raise ValueError("no format-4 cmap")
+
+    def read_cmap4(self, sub):
+        segs = self.u16(sub + 6) // 2
+        ends = sub + 14
+        starts = ends + 2 * segs + 2
+        deltas = starts + 2 * segs
+        ranges = deltas + 2 * segs
+        table = {}
+        for s in range(segs):
+            end = self.u16(ends + 2 * s)
+            start = self.u16(starts + 2 * s)
+            delta = self.s16(deltas + 2 * s)
+            ro = self.u16(ranges + 2 * s)
+            for c in range(start, end + 1):
+                if c == 0xFFFF:
+                    continue
+                if ro == 0:
+                    g = (c + delta) & 0xFFFF
+                else:
+                    g = self.u16(ranges + 2 * s + ro + 2 * (c - start))
+                    if g != 0:
+                        g = (g + delta) & 0xFFFF
+                table[c] = g
+        return table
+
+    def advance(self, gid):
+        hmtx = self.tables["hmtx"][0]
+        i = min(gid, self.num_hmetrics - 1)
+        return self.u16(hmtx + 4 * i)
+
+    def glyph_offset(self, gid):
+        loca = self.tables["loca"][0]
+        if self.loca_long:
+            a, b = self.u32(loca + 4 * gid), self.u32(loca + 4 * gid + 4)
+        else:
+            a, b = 2 * self.u16(loca + 2 * gid), 2 * self.u16(loca + 2 * gid + 2)
+        return (self.tables["glyf"][0] + a) if b > a else None
+
+    def contours(self, gid, dx=0, dy=0):
+        """返回轮廓列表，每个轮廓为 [(x, y, on_curve), ...]（字体单位）。"""
+        off = self.glyph_offset(gid)
+        if off is None:
+            return []
+        n = self.s16(off)
+        if n < 0:
+            return self.composite(off + 10, dx, dy)
+
+        p = off + 10
+        end_pts = [self.u16(p + 2 * i) for i in range(n)]
+        p += 2 * n
+        p += 2 + self.u16(p)
+        npts = end_pts[-1] + 1 if n else 0
+
+        flags = []
+        while len(flags) < npts:
+            f = self.data[p]
+            p += 1
+            flags.append(f)
+            if f & 8:
+                r = self.data[p]
+                p += 1
+                flags.extend([f] * r)
+
+        def coords(short_bit, same_bit):
+            nonlocal p
+            out, v = [], 0
+            for f in flags:
+                if f & short_bit:
+                    d = self.data[p]
+                    p += 1
+                    v += d if (f & same_bit) else -d
+                elif not (f & same_bit):
+                    v += self.s16(p)
+                    p += 2
+                out.append(v)
+            return out
+
+        xs = coords(2, 16)
+        ys = coords(4, 32)
+        result, start = [], 0
+        for e in end_pts:
+            result.append([(xs[i] + dx, ys[i] + dy, bool(flags[i] & 1)) for i in range(start, e + 1)])
+            start = e + 1
+        return result
+
+    def composite(self, p, dx, dy):
+        result = []
+        while True:
+            flags, gid = self.u16(p), self.u16(p + 2)
+            p += 4
+            if flags & 1:
+                a, b = self.s16(p), self.s16(p + 2)
+                p += 4
+            else:
+                a, b = struct.unpack(">bb", self.data[p:p + 2])
+                p += 2
+            if flags & 8:
+                p += 2
+            elif flags & 0x40:
+                p += 4
+            elif flags & 0x80:
+                p += 8
+            # 仅支持平移（ASCII 范围内足够）
+            result.extend(self.contours(gid, dx + a, dy + b))
+            if not flags & 0x20:
+                return result
+
+
+def flatten(contour, steps=8):
+    """二次 B 样条轮廓 -> 折线。"""
+    pts = contour
+    n = len(pts)
+    # 找到一个在线点作为起点；全是控制点时用首两点中点
+    start = next((i for i in range(n) if pts[i][2]), None)
+    if start is None:
+        x0 = (pts[0][0] + pts[1][0]) / 2.0
+        y0 = (pts[0][1] + pts[1][1]) / 2.0
+        pts = [(x0, y0, True)] + pts[1:] + [pts[0]]
+        start = 0
+        n = len(pts)
+    seq = [pts[(start + i) % n] for i in range(n)] + [pts[start]]
+
+    out = [(seq[0][0], seq[0][1])]
+    cur = (seq[0][0], seq[0][1])
+    ctrl = None
+    for x, y, on in seq[1:]:
+        if on:
+            if ctrl is None:
+                out.append((x, y))
+            else:
+                out.extend(quad(cur, ctrl, (x, y), steps))
+                ctrl = None
+            cur = (x, y)
+        else:
+            if ctrl is not None:
+                mid = ((ctrl[0] + x) / 2.0, (ctrl[1] + y) / 2.0)
+                out.extend(quad(cur, ctrl, mid, steps))
+                cur = mid
+            ctrl = (x, y)
+    return out
+
+
+def quad(p0, p1, p2, steps):
+    pts = []
+    for i in range(1, steps + 1):
+        t = i / float(steps)
+        u = 1.0 - t
+        pts.append((u * u * p0[0] + 2 * u * t * p1[0] + t * t * p2[0],
+                    u * u * p0[1] + 2 * u * t * p1[1] + t * t * p2[1]))
+    return pts
+
+
+def rasterize(polys, w, h):
+    """返回 h x w 的覆盖率（0..1），非零环绕规则，每像素 SS x SS 采样。"""
+    edges = []
+    for poly in polys:
+        for i in range(len(poly) - 1):
+            (x0, y0), (x1, y1) = poly[i], poly[i + 1]
+            if y0 != y1:
+                edges.append((x0, y0, x1, y1))
+
+    cov = [[0] * w for _ in range(h)]
+    for sy in range(h * SS):
+        yc = (sy + 0.5) / SS
+        xs = []
+        for x0, y0, x1, y1 in edges:
+            if (y0 <= yc < y1) or (y1 <= yc < y0):
+                x = x0 + (yc - y0) * (x1 - x0) / (y1 - y0)
+                xs.append((x, 1 if y1 > y0 else -1))
+        xs.sort()
+        row = cov[sy // SS]
+        wind = 0
+        for i in range(len(xs) - 1):
+            wind += xs[i][1]
+            if wind == 0:
+                continue
+            a, b = xs[i][0], xs[i + 1][0]
+            # 采样点 x = (k + 0.5) / SS，落在 [a, b) 内的计数
+            k0 = max(0, int(-(-(a * SS - 0.5) // 1)))
+            k1 = min(w * SS, int(-(-(b * SS - 0.5) // 1)))
+            for k in range(k0, k1):
+                row[k // SS] += 1
+    return [[c / float(SS * SS) for c in r] for r in cov]
+
+
+def main():
+    if len(sys.argv) != 5:
+        sys.stderr.write(__doc__)
+        sys.exit(1)
+    path, cell_h, bpp, name = sys.argv[1], int(sys.argv[2]), int(sys.argv[3]), sys.argv[4]
+    if bpp not in (1, 4):
+        raise SystemExit("bpp must be 1 or 4")
+
+    tt = TrueType(path)
+    scale = cell_h / float(tt.ascent - tt.descent)
+    cell_w = int(round(tt.advance(tt.cmap[ord("M")]) * scale))
+    baseline = tt.ascent * scale
+
+    blob = []
+    offsets = []
+    for c in range(FIRST, LAST + 1):
+        gid = tt.cmap.get(c, 0)
+        polys = []
+        for contour in tt.contours(gid):
+            pts = flatten(contour)
+            # 字体坐标 y 向上 -> 像素坐标 y 向下
+            polys.append([(x * scale, baseline - y * scale) for x, y in pts])
+        cov = rasterize(polys, cell_w, cell_h)
+
+        bits = []
+        for r in cov:
+            for v in r:
+                if bpp == 1:
+                    bits.append(1 if v >= THRESHOLD_1BPP else 0)
+                else:
+                    q = int(round(v * 15))
+                    bits.extend([(q >> 3) & 1, (q >> 2) & 1, (q >> 1) & 1, q & 1])
+        while len(bits) % 8:
+            bits.append(0)
+        offsets.append(len(blob))
+        for i in range(0, len(bits), 8):
+            b = 0
+            for bit in bits[i:i + 8]:
+                b = (b << 1) | bit
+            blob.append(b)
+
+    glyph_bytes = (cell_w * cell_h * bpp + 7) // 8
+    assert all(offsets[i] == i * glyph_bytes for i in range(len(offsets)))
+
+    out = sys.stdout
+    out.write("/*\n")
+    out.write(" * 由 tools/fontgen.py 生成，请勿手工修改。\n")
+    out.write(" *   python3 tools/fontgen.py DejaVuSansMono.ttf %d %d %s\n" % (cell_h, bpp, name))
+    out.write(" *\n")
+    out.write(" * 字形来自 DejaVu Sans Mono（Bitstream Vera / DejaVu 许可，允许嵌入与再分发）。\n")
+    out.write(" * 单元格 %dx%d，%dbpp，字符 0x%02X..0x%02X，每字形 %d 字节。\n"
+              % (cell_w, cell_h, bpp, FIRST, LAST, glyph_bytes))
+    out.write(" */\n\n")
+    out.write('#include "font/font.h"\n\n')
+    out.write("static const uint8_t %s_bitmap[%d] = {\n" % (name, len(blob)))
+    for g in range(LAST - FIRST + 1):
+        chunk = blob[g * glyph_bytes:(g + 1) * glyph_bytes]
+        ch = chr(FIRST + g)
+        label = ch if ch not in "\\*/" else "0x%02X" % (FIRST + g)
+        out.write("    /* '%s' */\n" % label)
+        for i in range(0, len(chunk), 16):
+            out.write("    " + " ".join("0x%02X," % b for b in chunk[i:i + 16]) + "\n")
+    out.write("};\n\n")
+    out.write("const font_t %s = {\n" % name)
+    out.write("    .width = %dU,\n" % cell_w)
+    out.write("    .height = %dU,\n" % cell_h)
+    out.write("    .bpp = %dU,\n" % bpp)
+    out.write("    .first = 0x%02XU,\n" % FIRST)
+    out.write("    .last = 0x%02XU,\n" % LAST)
+    out.write("    .glyph_bytes = %dU,\n" % glyph_bytes)
+    out.write("    .bitmap = %s_bitmap,\n" % name)
+    out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
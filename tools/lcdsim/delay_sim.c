@@ -0,0 +1,28 @@
+#include <stdint.h>
+
+#include "stm32f4xx.h"
+
+#include "delay/delay.h"
+
+/*
+ * lcdsim 目标专用：不编译 clock.c / delay.c / system_stm32f4xx.c，
+ * HCLK 固定为 168MHz，延时没有意义，只推进 SysTick 毫秒计数。
+ */
+uint32_t SystemCoreClock = 168000000U;
+
+static uint32_t lcdsim_tick;
+
+void delay_init(void)
+{
+    lcdsim_tick = 0U;
+}
+
+void delay_ms(uint32_t ms)
+{
+    lcdsim_tick += ms;
+}
+
+uint32_t delay_get_tick(void)
+{
+    return lcdsim_tick;
+}
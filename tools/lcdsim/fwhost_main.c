@@ -0,0 +1,407 @@
+/*
+ * fwhost：src/ 下全部源码在主机上编译（仿真寄存器 + 外设行为模型 + HX8357D 模型），
+ * 按分组跑时钟 / 延时 / 时间基准 / blend / 读回的自检和 bench 微基准，打印结果。
+ *
+ *   fwhost            全部分组依次运行，有失败项时进程返回 1
+ *   fwhost <分组>     只运行一个分组（ctest 每组一条，见 CMakeLists.txt）：
+ *                     clock / delay（含延时精度表）/ timebase / blend / readback / bench / console
+ *   fwhost firmware   直接运行 src/main.c 的 main()（编译时改名为 fw_main，Ctrl-C 退出）
+ *   fwhost selftest   按 main() 的顺序初始化后运行 selftest_run()（报告经仿真 USART1 输出），失败时返回 1
+ *
+ * 周期数来自仿真 DWT->CYCCNT：主机执行时间按当前 HCLK 折算，再加上 FSMC 总线模型的周期。
+ * 只用于同一台主机上前后两次的相对比较，绝对值不代表板上性能。
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hx8357d_sim.h"
+#include "periph_model.h"
+
+#include "bench/bench.h"
+#include "bench/bench_blend.h"
+#include "bench/bench_conv.h"
+#include "bench/bench_font.h"
+#include "bench/bench_gfx.h"
+#include "bench/bench_lcd.h"
+#include "bench/bench_timer.h"
+#include "clock/clock.h"
+#include "delay/delay.h"
+#include "font/font.h"
+#include "lcd/lcd.h"
+#include "lcd/lcd_console.h"
+#include "selftest/selftest.h"
+#include "timebase/timebase.h"
+#include "timer/basic_timer.h"
+
+#include "stm32f4xx.h"
+
+int fw_main(void);
+
+/* 仿真 CYCCNT / 主机时钟每读一次都要调用 clock_gettime()，周期级比较留出这么多抖动 */
+#define FWHOST_JITTER_CYCLES (32U)
+
+/* fwhost selftest 最多整轮运行的次数（见 fwhost_selftest()） */
+#define FWHOST_SELFTEST_TRIES (3U)
+
+static uint32_t fwhost_failures;
+
+static void fwhost_check(bool ok, const char *what)
+{
+    printf("  [%s] %s\n", ok ? " ok " : "FAIL", what);
+    if (!ok)
+    {
+        fwhost_failures++;
+    }
+}
+
+/* 单独运行某个分组时先把时钟树配到 168MHz（clock 分组自己负责这一步） */
+static void fwhost_need_clock(void)
+{
+    if (SystemCoreClock != 168000000U)
+    {
+        fwhost_check(clock_init_168mhz_hse8() == CLOCK_OK, "setup: clock_init_168mhz_hse8()");
+    }
+}
+
+/* 面板只初始化一次：readback / bench / console 分组共用；上电时序用 SysTick 的 delay_ms() */
+static void fwhost_need_lcd(void)
+{
+    static bool ready;
+
+    if (!ready)
+    {
+        delay_init();
+        lcd_panel_init();
+        ready = true;
+    }
+}
+
+/* ----------------------------- 时钟 ----------------------------- */
+
+/* 钩子：HSERDY 永不置位，clock_wait_flag_set() 应当超时 */
+static bool fwhost_no_hse(volatile uint32_t *reg, uint32_t mask)
+{
+    return !((reg == &lcdsim_rcc.CR) && ((mask & RCC_CR_HSERDY) != 0U));
+}
+
+static void fwhost_clock(void)
+{
+    printf("clock\n");
+
+    lcdsim_model_set_hook(fwhost_no_hse);
+    fwhost_check(clock_init_168mhz_hse8() == CLOCK_ERR_HSE_TIMEOUT, "HSE never ready -> CLOCK_ERR_HSE_TIMEOUT");
+    lcdsim_model_set_hook(0);
+
+    CLEAR_BIT(RCC->CR, RCC_CR_HSEON);
+    fwhost_check(clock_init_168mhz_hse8() == CLOCK_OK, "clock_init_168mhz_hse8() == CLOCK_OK");
+    fwhost_check(clock_get_hclk_hz() == 168000000U, "HCLK = 168MHz");
+    fwhost_check((RCC->CFGR & RCC_CFGR_SWS) == RCC_CFGR_SWS_PLL, "SYSCLK source = PLL");
+    fwhost_check((FLASH->ACR & FLASH_ACR_LATENCY) == FLASH_ACR_LATENCY_5WS, "FLASH latency = 5WS");
+}
+
+/* ----------------------------- 延时 ----------------------------- */
+
+/* 延时精度表：DWT 周期（仿真 CYCCNT 按主机时间折算），自由运行实现 vs 单次计数参考实现 */
+static void fwhost_timer_table(void)
+{
+    static bench_timer_row_t rows[BENCH_TIMER_CASES];
+
+    bench_init();
+    bench_timer_delays(rows, bench_timer_cases_ns, BENCH_TIMER_CASES);
+
+    printf("bench_timer (cycles, overhead %lu)   expect     min     max ref_min ref_max\n",
+           (unsigned long)basic_timer_overhead_cycles());
+    for (uint32_t i = 0U; i < BENCH_TIMER_CASES; i++)
+    {
+        const bench_timer_row_t *r = &rows[i];
+        printf("  %9lu ns %21lu %7lu %7lu %7lu %7lu\n", (unsigned long)r->req_ns, (unsigned long)r->expect_cycles,
+               (unsigned long)r->min_cycles, (unsigned long)r->max_cycles, (unsigned long)r->ref_min_cycles,
+               (unsigned long)r->ref_max_cycles);
+        fwhost_check((r->min_cycles + FWHOST_JITTER_CYCLES) >= r->expect_cycles, "min >= expect (host jitter allowed)");
+    }
+}
+
+static void fwhost_delay(void)
+{
+    static const uint32_t us_cases[] = {1U, 5U, 10U, 100U, 1000U, 10000U, 100000U};
+    char what[64];
+
+    printf("delay (host wall clock)\n");
+
+    fwhost_need_clock();
+    delay_init();
+    for (uint32_t ms = 1U; ms <= 100U; ms *= 10U)
+    {
+        const uint64_t t0 = lcdsim_now_ns();
+        delay_ms(ms);
+        const uint64_t ns = lcdsim_now_ns() - t0;
+
+        /* SysTick 计数粒度 1ms：起点落在节拍前沿时最短少 1ms */
+        (void)snprintf(what, sizeof(what), "delay_ms(%lu) = %.3f ms", (unsigned long)ms, (double)ns / 1e6);
+        fwhost_check(ns >= ((uint64_t)(ms - 1U) * 1000000ULL), what);
+    }
+
+    basic_timer_init();
+    for (uint32_t i = 0U; i < (sizeof(us_cases) / sizeof(us_cases[0])); i++)
+    {
+        const uint32_t us = us_cases[i];
+        const uint64_t t0 = lcdsim_now_ns();
+        basic_timer_delay_us(us);
+        const uint64_t ns = lcdsim_now_ns() - t0;
+
+        (void)snprintf(what, sizeof(what), "basic_timer_delay_us(%lu) = %.1f us", (unsigned long)us, (double)ns / 1e3);
+        fwhost_check((ns + ((FWHOST_JITTER_CYCLES * 1000U) / 168U)) >= ((uint64_t)us * 1000ULL), what);
+    }
+
+    fwhost_timer_table();
+}
+
+/* ----------------------------- 时间基准 ----------------------------- */
+
+static void fwhost_timebase(void)
+{
+    char what[80];
+
+    printf("timebase\n");
+
+    fwhost_need_clock();
+    basic_timer_init();
+
+    /* 把仿真 CYCCNT 直接拨到回绕前 4096 个周期，跨过回绕后 64-bit 时间应连续 */
+    time_init();
+    lcdsim_dwt.CYCCNT = 0xFFFFF000U;
+    const uint64_t a = time_now_cycles();
+    basic_timer_delay_us(100U);
+    const uint64_t b = time_now_cycles();
+
+    (void)snprintf(what, sizeof(what), "CYCCNT wrap: 0x%llx -> 0x%llx (+%llu cycles)", (unsigned long long)a,
+                   (unsigned long long)b, (unsigned long long)(b - a));
+    fwhost_check(((a >> 32) == 0U) && ((b >> 32) == 1U) && ((b - a) >= 16800U) && ((b - a) < 168000U), what);
+}
+
+/* ----------------------------- 微基准 ----------------------------- */
+
+static void fwhost_x100(const char *name, uint32_t v, const char *unit)
+{
+    printf("  %-26s %8lu.%02lu %s\n", name, (unsigned long)(v / 100U), (unsigned long)(v % 100U), unit);
+}
+
+static void fwhost_blend_row(const char *name, const bench_blend_item_t *it)
+{
+    printf("  %-26s %8lu.%02lu %8lu.%02lu %6lu\n", name,
+           (unsigned long)(it->simd_cpp_x100 / 100U), (unsigned long)(it->simd_cpp_x100 % 100U),
+           (unsigned long)(it->ref_cpp_x100 / 100U), (unsigned long)(it->ref_cpp_x100 % 100U),
+           (unsigned long)it->mismatches);
+    if (it->mismatches != 0U)
+    {
+        fwhost_failures++;
+    }
+}
+
+/* blend 内核（DSP 路径）与 *_ref 逐像素一致；同时给出 cycles/px */
+static void fwhost_blend(void)
+{
+    bench_blend_result_t blend;
+
+    fwhost_need_clock();
+    bench_init();
+
+    printf("bench_blend (cycles/px)          span        ref  mism\n");
+    bench_blend_kernels(&blend, BENCH_BLEND_MAX_PIXELS);
+    fwhost_blend_row("over", &blend.over);
+    fwhost_blend_row("const", &blend.cnst);
+    fwhost_blend_row("fade", &blend.fade);
+    fwhost_blend_row("add", &blend.add);
+}
+
+/* 经过 HX8357D 模型的读回校验 */
+static void fwhost_readback(void)
+{
+    bench_lcd_read_result_t rd;
+
+    printf("readback\n");
+
+    fwhost_need_clock();
+    bench_init();
+    fwhost_need_lcd();
+
+    bench_lcd_read(&rd, 0U, 0U);
+    fwhost_x100("read_rect", rd.mpix_x100, "MPix/s");
+    fwhost_check(rd.mismatches == 0U, "lcd_read_rect() readback matches");
+}
+
+/* 面板总线事务数（命令 + 数据写 + 读） */
+static uint32_t fwhost_bus_count(void)
+{
+    lcdsim_stats_t st;
+
+    lcdsim_get_stats(&st);
+    return st.cmd_writes + st.data_writes + st.data_reads;
+}
+
+/* 控制台：lcd_console_init() 之前的调用不上总线，之后的调用上总线 */
+static void fwhost_console(void)
+{
+    uint32_t before;
+
+    printf("console\n");
+
+    fwhost_need_clock();
+    fwhost_need_lcd();
+
+    before = fwhost_bus_count();
+    lcd_console_clear();
+    lcd_console_putc('x');
+    lcd_console_write("x\n");
+    fwhost_check(fwhost_bus_count() == before,
+                 "before lcd_console_init(): clear/putc/write issue no bus transactions");
+
+    fwhost_check(lcd_console_init(&font_mono16_aa, 0U, 0U, 0xFFFFU, 0x0000U), "lcd_console_init()");
+    before = fwhost_bus_count();
+    lcd_console_clear();
+    lcd_console_write("x\n");
+    fwhost_check(fwhost_bus_count() != before, "after lcd_console_init(): clear/write reach the panel");
+
+    lcd_scroll_off();
+}
+
+/* 微基准：只打印数值，不做判定（跑完不崩溃即通过） */
+static void fwhost_bench(void)
+{
+    bench_conv_result_t conv;
+    bench_gfx_result_t gfx;
+    bench_font_result_t font;
+    bench_lcd_fill_result_t fill;
+    bench_lcd_window_result_t win;
+
+    fwhost_need_clock();
+    bench_init();
+
+    printf("bench_conv (cycles/px)\n");
+    bench_conv_formats(&conv, BENCH_CONV_MAX_PIXELS);
+    fwhost_x100("rgb888", conv.rgb888.cpp_x100, "");
+    fwhost_x100("rgb888_dither", conv.rgb888_dither.cpp_x100, "");
+    fwhost_x100("argb8888", conv.argb8888.cpp_x100, "");
+    fwhost_x100("argb8888_dither", conv.argb8888_dither.cpp_x100, "");
+    fwhost_x100("gray8", conv.gray8.cpp_x100, "");
+    fwhost_x100("gray8_dither", conv.gray8_dither.cpp_x100, "");
+
+    /* 以下经过 HX8357D 模型，周期中含 FSMC 总线时间 */
+    fwhost_need_lcd();
+
+    printf("bench_gfx (primitives/s)          span      pixel\n");
+    bench_gfx_primitives(&gfx, 64U);
+    printf("  %-26s %10lu %10lu\n", "line", (unsigned long)gfx.line.span_per_s, (unsigned long)gfx.line.pixel_per_s);
+    printf("  %-26s %10lu %10lu\n", "circle", (unsigned long)gfx.circle.span_per_s,
+           (unsigned long)gfx.circle.pixel_per_s);
+    printf("  %-26s %10lu %10lu\n", "fill_circle", (unsigned long)gfx.fill_circle.span_per_s,
+           (unsigned long)gfx.fill_circle.pixel_per_s);
+    printf("  %-26s %10lu %10lu\n", "fill_round_rect", (unsigned long)gfx.fill_round_rect.span_per_s,
+           (unsigned long)gfx.fill_round_rect.pixel_per_s);
+    printf("  %-26s %10lu %10lu\n", "fill_triangle", (unsigned long)gfx.fill_triangle.span_per_s,
+           (unsigned long)gfx.fill_triangle.pixel_per_s);
+
+    printf("bench_font (chars/s, font_mono16_aa)\n");
+    bench_font_text(&font, &font_mono16_aa, 4U);
+    printf("  %-26s %10lu\n", "line_cached", (unsigned long)font.line_cached.chars_per_s);
+    printf("  %-26s %10lu\n", "line_cold", (unsigned long)font.line_cold.chars_per_s);
+    printf("  %-26s %10lu\n", "per_glyph", (unsigned long)font.per_glyph.chars_per_s);
+    printf("  %-26s %10lu\n", "expand_lut", (unsigned long)font.expand_lut.chars_per_s);
+    printf("  %-26s %10lu\n", "expand_blend", (unsigned long)font.expand_blend.chars_per_s);
+
+    printf("bench_lcd\n");
+    bench_lcd_fill(&fill, 0U, 0U, lcd_width(), lcd_height());
+    fwhost_x100("fill cpu", fill.cpu_mpix_x100, "MPix/s");
+    fwhost_x100("fill dma", fill.dma_mpix_x100, "MPix/s");
+    bench_lcd_window(&win, 256U);
+    printf("  %-26s %10lu cycles/call\n", "window changed", (unsigned long)win.changed_cycles);
+    printf("  %-26s %10lu cycles/call\n", "window same", (unsigned long)win.same_cycles);
+}
+
+/* 与 selftest.elf 相同：main() 的初始化顺序 + selftest_run() */
+static int fwhost_selftest(void)
+{
+    if (clock_init_168mhz_hse8() != CLOCK_OK)
+    {
+        printf("clock_init_168mhz_hse8() failed\n");
+        return 1;
+    }
+    delay_init();
+    basic_timer_init();
+    lcd_panel_init();
+
+    /* 仿真时钟取自主机单调时钟：进程被调度走或 SIGALRM 落在短延时里都会让单次测量越界，
+     * 判定逻辑与板上相同，只在主机上整轮重跑，任一轮全部通过即通过 */
+    uint32_t failures = 1U;
+    for (uint32_t i = 0U; (i < FWHOST_SELFTEST_TRIES) && (failures != 0U); i++)
+    {
+        failures = selftest_run();
+    }
+    lcdsim_model_stop();
+    return (failures == 0U) ? 0 : 1;
+}
+
+typedef struct
+{
+    const char *name;
+    void (*run)(void);
+} fwhost_group_t;
+
+static const fwhost_group_t fwhost_groups[] = {
+    {"clock", fwhost_clock},
+    {"delay", fwhost_delay},
+    {"timebase", fwhost_timebase},
+    {"blend", fwhost_blend},
+    {"readback", fwhost_readback},
+    {"bench", fwhost_bench},
+    {"console", fwhost_console},
+};
+
+#define FWHOST_GROUPS (sizeof(fwhost_groups) / sizeof(fwhost_groups[0]))
+
+int main(int argc, char **argv)
+{
+    lcdsim_model_start();
+
+    if ((argc > 1) && (strcmp(argv[1], "firmware") == 0))
+    {
+        return fw_main();
+    }
+    if ((argc > 1) && (strcmp(argv[1], "selftest") == 0))
+    {
+        return fwhost_selftest();
+    }
+
+    if (argc > 1)
+    {
+        uint32_t g = 0U;
+        while ((g < FWHOST_GROUPS) && (strcmp(argv[1], fwhost_groups[g].name) != 0))
+        {
+            g++;
+        }
+        if (g == FWHOST_GROUPS)
+        {
+            printf("usage: fwhost [firmware | selftest");
+            for (uint32_t i = 0U; i < FWHOST_GROUPS; i++)
+            {
+                printf(" | %s", fwhost_groups[i].name);
+            }
+            printf("]\n");
+            return 2;
+        }
+        fwhost_groups[g].run();
+    }
+    else
+    {
+        for (uint32_t i = 0U; i < FWHOST_GROUPS; i++)
+        {
+            fwhost_groups[i].run();
+        }
+    }
+
+    lcdsim_model_stop();
+
+    printf("%lu failure(s)\n", (unsigned long)fwhost_failures);
+    return (fwhost_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+#ifndef LCDSIM_HOST_STM32F4XX_H
+#define LCDSIM_HOST_STM32F4XX_H
+
+/**
+ * @brief 主机仿真用的 stm32f4xx.h：沿用真实的寄存器结构体与位定义，
+ *        外设实例改为普通内存（tools/lcdsim/periph.c），src/ 下的驱动无需修改即可编译。
+ *
+ * 覆盖 src/ 用到的全部外设（DMA2 除外：lcd_dma.c 由 lcd_dma_sim.c 代替），
+ * 以及 gfx 用到的 DSP 指令（__SMLAD / __UQADD16 / __UQADD8）。
+ *
+ * 定义 LCDSIM_MODEL 时（fwhost 目标），RCC / TIM6 / USART1 / DWT 的实例宏改为调用
+ * periph_model.c 的 lcdsim_*_sync()：每次访问寄存器前先按主机时间推进该外设的状态位，
+ * 驱动里的忙等循环因此能正常退出。否则（lcdsim 目标）寄存器只是内存，
+ * 只有 FSMC 总线模型推进 DWT->CYCCNT。
+ */
+
+/* CMSIS 的 SysTick_Config() 在头文件内联展开时就绑定了真实 SysTick 地址，先改名让出位置 */
+#define SysTick_Config lcdsim_cmsis_SysTick_Config
+
+/* 真实的 stm32f4xx.h（include 路径中 host/ 之后的 drivers/stm32f4xx/include） */
+#include_next <stm32f4xx.h>
+
+#undef SysTick_Config
+
+/* Cortex-M 屏障指令在主机上只保留编译器屏障 */
+#undef __DSB
+#undef __ISB
+#undef __DMB
+#define __DSB() __asm volatile("" ::: "memory")
+#define __ISB() __asm volatile("" ::: "memory")
+#define __DMB() __asm volatile("" ::: "memory")
+
+/*
+ * DSP 扩展指令的 C 仿真（语义按 ARMv7E-M 手册），主机以 GFX_BLEND_DSP=1 编译 gfx/blend 与 gfx/convert，
+ * 与 *_ref 参考实现的等价性校验覆盖的就是固件实际使用的 SIMD 路径。
+ */
+static inline uint32_t lcdsim_smlad(uint32_t x, uint32_t y, uint32_t acc)
+{
+    const int32_t lo = (int32_t)(int16_t)(x & 0xFFFFU) * (int32_t)(int16_t)(y & 0xFFFFU);
+    const int32_t hi = (int32_t)(int16_t)(x >> 16) * (int32_t)(int16_t)(y >> 16);
+    return acc + (uint32_t)lo + (uint32_t)hi;
+}
+
+static inline uint32_t lcdsim_uqadd16(uint32_t a, uint32_t b)
+{
+    uint32_t r = 0U;
+    for (uint32_t sh = 0U; sh < 32U; sh += 16U)
+    {
+        const uint32_t s = ((a >> sh) & 0xFFFFU) + ((b >> sh) & 0xFFFFU);
+        r |= ((s > 0xFFFFU) ? 0xFFFFU : s) << sh;
+    }
+    return r;
+}
+
+static inline uint32_t lcdsim_uqadd8(uint32_t a, uint32_t b)
+{
+    uint32_t r = 0U;
+    for (uint32_t sh = 0U; sh < 32U; sh += 8U)
+    {
+        const uint32_t s = ((a >> sh) & 0xFFU) + ((b >> sh) & 0xFFU);
+        r |= ((s > 0xFFU) ? 0xFFU : s) << sh;
+    }
+    return r;
+}
+
+#undef __SMLAD
+#undef __UQADD16
+#undef __UQADD8
+#define __SMLAD(x, y, acc) lcdsim_smlad((x), (y), (acc))
+#define __UQADD16(a, b)    lcdsim_uqadd16((a), (b))
+#define __UQADD8(a, b)     lcdsim_uqadd8((a), (b))
+
+/* PRIMASK 只是一个变量：主机上没有真正的中断嵌套，临界区仍按原样成对调用 */
+extern volatile uint32_t lcdsim_primask;
+
+#define __get_PRIMASK()  (lcdsim_primask)
+#define __set_PRIMASK(v) ((void)(lcdsim_primask = (uint32_t)(v)))
+#define __disable_irq()  ((void)(lcdsim_primask = 1U))
+#define __enable_irq()   ((void)(lcdsim_primask = 0U))
+
+extern RCC_TypeDef lcdsim_rcc;
+extern GPIO_TypeDef lcdsim_gpio[9];
+extern FSMC_Bank1_TypeDef lcdsim_fsmc_bank1;
+extern FSMC_Bank1E_TypeDef lcdsim_fsmc_bank1e;
+extern TIM_TypeDef lcdsim_tim6;
+extern USART_TypeDef lcdsim_usart1;
+extern PWR_TypeDef lcdsim_pwr;
+extern FLASH_TypeDef lcdsim_flash_if;
+extern EXTI_TypeDef lcdsim_exti;
+extern SYSCFG_TypeDef lcdsim_syscfg;
+extern DWT_Type lcdsim_dwt;
+extern CoreDebug_Type lcdsim_coredebug;
+extern SysTick_Type lcdsim_systick;
+extern NVIC_Type lcdsim_nvic;
+extern SCB_Type lcdsim_scb;
+
+/* FLASH 起始地址处的只读数据（bench_lcd 以它作 FLASH 源） */
+extern const uint8_t lcdsim_flash_mem[];
+
+#undef RCC
+#undef GPIOA
+#undef GPIOB
+#undef GPIOC
+#undef GPIOD
+#undef GPIOE
+#undef GPIOF
+#undef GPIOG
+#undef GPIOH
+#undef GPIOI
+#undef FSMC_Bank1
+#undef FSMC_Bank1E
+#undef TIM6
+#undef USART1
+#undef PWR
+#undef FLASH
+#undef EXTI
+#undef SYSCFG
+#undef DWT
+#undef CoreDebug
+#undef SysTick
+#undef NVIC
+#undef SCB
+#undef FLASH_BASE
+
+#if defined(LCDSIM_MODEL)
+RCC_TypeDef *lcdsim_rcc_sync(void);
+TIM_TypeDef *lcdsim_tim6_sync(void);
+USART_TypeDef *lcdsim_usart1_sync(void);
+DWT_Type *lcdsim_dwt_sync(void);
+
+#define RCC         (lcdsim_rcc_sync())
+#define TIM6        (lcdsim_tim6_sync())
+#define USART1      (lcdsim_usart1_sync())
+#define DWT         (lcdsim_dwt_sync())
+#else
+#define RCC         (&lcdsim_rcc)
+#define TIM6        (&lcdsim_tim6)
+#define USART1      (&lcdsim_usart1)
+#define DWT         (&lcdsim_dwt)
+#endif
+
+#define GPIOA       (&lcdsim_gpio[0])
+#define GPIOB       (&lcdsim_gpio[1])
+#define GPIOC       (&lcdsim_gpio[2])
+#define GPIOD       (&lcdsim_gpio[3])
+#define GPIOE       (&lcdsim_gpio[4])
+#define GPIOF       (&lcdsim_gpio[5])
+#define GPIOG       (&lcdsim_gpio[6])
+#define GPIOH       (&lcdsim_gpio[7])
+#define GPIOI       (&lcdsim_gpio[8])
+#define FSMC_Bank1  (&lcdsim_fsmc_bank1)
+#define FSMC_Bank1E (&lcdsim_fsmc_bank1e)
+#define PWR         (&lcdsim_pwr)
+#define FLASH       (&lcdsim_flash_if)
+#define EXTI        (&lcdsim_exti)
+#define SYSCFG      (&lcdsim_syscfg)
+#define CoreDebug   (&lcdsim_coredebug)
+#define SysTick     (&lcdsim_systick)
+#define NVIC        (&lcdsim_nvic)
+#define SCB         (&lcdsim_scb)
+#define FLASH_BASE  ((uintptr_t)lcdsim_flash_mem)
+
+/* NVIC / SysTick 配置函数改为操作上面的仿真实例（periph.c） */
+uint32_t lcdsim_systick_config(uint32_t ticks);
+void lcdsim_nvic_enable_irq(IRQn_Type irqn);
+void lcdsim_nvic_disable_irq(IRQn_Type irqn);
+void lcdsim_nvic_set_priority(IRQn_Type irqn, uint32_t priority);
+
+#undef NVIC_EnableIRQ
+#undef NVIC_DisableIRQ
+#undef NVIC_SetPriority
+
+#define SysTick_Config   lcdsim_systick_config
+#define NVIC_EnableIRQ   lcdsim_nvic_enable_irq
+#define NVIC_DisableIRQ  lcdsim_nvic_disable_irq
+#define NVIC_SetPriority lcdsim_nvic_set_priority
+
+#endif /* LCDSIM_HOST_STM32F4XX_H */
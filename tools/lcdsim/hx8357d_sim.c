@@ -0,0 +1,358 @@
+#include "hx8357d_sim.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32f4xx.h"
+
+volatile uint16_t lcdsim_cmd_port;
+volatile uint16_t lcdsim_data_port;
+
+static uint16_t lcdsim_gram[LCDSIM_HEIGHT][LCDSIM_WIDTH];
+static lcdsim_stats_t lcdsim_stats;
+
+static struct
+{
+    uint8_t cmd;            /* 当前命令 */
+    uint32_t param;         /* 本命令已收到的参数 / 已读出的字数 */
+    uint8_t buf[6];         /* 参数缓存 */
+
+    uint8_t madctl;
+    uint16_t sc;
+    uint16_t ec;
+    uint16_t sp;
+    uint16_t ep;
+    uint16_t col;           /* GRAM 读写光标（逻辑地址） */
+    uint16_t page;
+
+    uint8_t rd_bytes[4];    /* 0x2E：RGB888 字节流 */
+    uint32_t rd_count;
+
+    bool scroll;
+    uint16_t tfa;
+    uint16_t vsa;
+    uint16_t bfa;
+    uint16_t vsp;
+} lcdsim;
+
+/* ----------------------------- 总线周期 ----------------------------- */
+
+/*
+ * FSMC 模式 A 的近似开销（HCLK 周期）：写 ADDSET + DATAST + 1，读 ADDSET + DATAST + 3。
+ * 直接读仿真 FSMC 寄存器，lcd_fsmc_set_timing() 改时序后立即生效；同时推进 DWT->CYCCNT，
+ * 让 bench / 校准代码在主机上得到“只含总线时间”的计时。
+ */
+static void lcdsim_bus(bool write)
+{
+    const uint32_t btr = write ? FSMC_Bank1E->BWTR[6] : FSMC_Bank1->BTCR[7];
+    const uint32_t addset = (btr & FSMC_BTR1_ADDSET_Msk) >> FSMC_BTR1_ADDSET_Pos;
+    const uint32_t datast = (btr & FSMC_BTR1_DATAST_Msk) >> FSMC_BTR1_DATAST_Pos;
+    const uint32_t cycles = addset + datast + (write ? 1U : 3U);
+
+    lcdsim_stats.bus_cycles += cycles;
+    DWT->CYCCNT += cycles;
+}
+
+/* ----------------------------- 地址映射 ----------------------------- */
+
+/*
+ * 逻辑 (col, page) -> 观看坐标：MV 交换行列，MX=0 时列镜像（本板以 MX=1 为正向），MY 行镜像。
+ */
+static bool lcdsim_map(uint16_t col, uint16_t page, uint32_t *x, uint32_t *y)
+{
+    const uint32_t a = ((lcdsim.madctl & 0x20U) != 0U) ? page : col;
+    const uint32_t b = ((lcdsim.madctl & 0x20U) != 0U) ? col : page;
+
+    if ((a >= LCDSIM_WIDTH) || (b >= LCDSIM_HEIGHT))
+    {
+        return false;
+    }
+    *x = ((lcdsim.madctl & 0x40U) != 0U) ? a : (LCDSIM_WIDTH - 1U - a);
+    *y = ((lcdsim.madctl & 0x80U) != 0U) ? (LCDSIM_HEIGHT - 1U - b) : b;
+    return true;
+}
+
+/* 光标沿列递增，列尾回到 SC 并换页；页尾回到 SP */
+static void lcdsim_advance(void)
+{
+    if (lcdsim.col >= lcdsim.ec)
+    {
+        lcdsim.col = lcdsim.sc;
+        lcdsim.page = (lcdsim.page >= lcdsim.ep) ? lcdsim.sp : (uint16_t)(lcdsim.page + 1U);
+    }
+    else
+    {
+        lcdsim.col++;
+    }
+}
+
+static void lcdsim_gram_write(uint16_t v)
+{
+    uint32_t x;
+    uint32_t y;
+
+    if (lcdsim_map(lcdsim.col, lcdsim.page, &x, &y))
+    {
+        lcdsim_gram[y][x] = v;
+        lcdsim_stats.gram_writes++;
+    }
+    else
+    {
+        lcdsim_stats.clipped++;
+    }
+    lcdsim_advance();
+}
+
+/* 取下一个像素，按 RGB888 读格式追加 3 个字节（分量扩展到 8-bit） */
+static void lcdsim_gram_fetch(void)
+{
+    uint32_t x;
+    uint32_t y;
+    uint16_t v = 0U;
+
+    if (lcdsim_map(lcdsim.col, lcdsim.page, &x, &y))
+    {
+        v = lcdsim_gram[y][x];
+    }
+    lcdsim_advance();
+    lcdsim_stats.gram_reads++;
+
+    const uint32_t r = (v >> 11) & 0x1FU;
+    const uint32_t g = (v >> 5) & 0x3FU;
+    const uint32_t b = v & 0x1FU;
+    lcdsim.rd_bytes[lcdsim.rd_count++] = (uint8_t)((r << 3) | (r >> 2));
+    lcdsim.rd_bytes[lcdsim.rd_count++] = (uint8_t)((g << 2) | (g >> 4));
+    lcdsim.rd_bytes[lcdsim.rd_count++] = (uint8_t)((b << 3) | (b >> 2));
+}
+
+static uint16_t lcdsim_gram_read(void)
+{
+    uint16_t w;
+
+    while (lcdsim.rd_count < 2U)
+    {
+        lcdsim_gram_fetch();
+    }
+    w = (uint16_t)(((uint16_t)lcdsim.rd_bytes[0] << 8) | lcdsim.rd_bytes[1]);
+    lcdsim.rd_count -= 2U;
+    memmove(lcdsim.rd_bytes, &lcdsim.rd_bytes[2], lcdsim.rd_count);
+    return w;
+}
+
+/* ----------------------------- 命令 ----------------------------- */
+
+static void lcdsim_soft_reset(void)
+{
+    lcdsim.madctl = 0U;
+    lcdsim.sc = 0U;
+    lcdsim.ec = LCDSIM_WIDTH - 1U;
+    lcdsim.sp = 0U;
+    lcdsim.ep = LCDSIM_HEIGHT - 1U;
+    lcdsim.col = 0U;
+    lcdsim.page = 0U;
+    lcdsim.scroll = false;
+    lcdsim.tfa = 0U;
+    lcdsim.vsa = LCDSIM_HEIGHT;
+    lcdsim.bfa = 0U;
+    lcdsim.vsp = 0U;
+}
+
+void lcdsim_reset(void)
+{
+    memset(lcdsim_gram, 0, sizeof(lcdsim_gram));
+    memset(&lcdsim, 0, sizeof(lcdsim));
+    lcdsim_soft_reset();
+    lcdsim_reset_stats();
+}
+
+void lcdsim_write_cmd(uint16_t cmd)
+{
+    lcdsim_bus(true);
+    lcdsim_stats.cmd_writes++;
+    lcdsim_stats.cmd_count[cmd & 0xFFU]++;
+
+    lcdsim.cmd = (uint8_t)cmd;
+    lcdsim.param = 0U;
+
+    switch (lcdsim.cmd)
+    {
+    case 0x01U:
+        lcdsim_soft_reset();
+        break;
+    case 0x13U: /* Normal Display Mode On：退出滚动 */
+        lcdsim.scroll = false;
+        break;
+    case 0x2CU:
+        lcdsim.col = lcdsim.sc;
+        lcdsim.page = lcdsim.sp;
+        break;
+    case 0x2EU:
+        lcdsim.col = lcdsim.sc;
+        lcdsim.page = lcdsim.sp;
+        lcdsim.rd_count = 0U;
+        break;
+    default:
+        break;
+    }
+}
+
+void lcdsim_write_data(uint16_t data)
+{
+    const uint8_t b = (uint8_t)data;
+
+    lcdsim_bus(true);
+    lcdsim_stats.data_writes++;
+
+    if ((lcdsim.cmd == 0x2CU) || (lcdsim.cmd == 0x3CU))
+    {
+        lcdsim_gram_write(data);
+        return;
+    }
+
+    if (lcdsim.param < sizeof(lcdsim.buf))
+    {
+        lcdsim.buf[lcdsim.param] = b;
+    }
+    lcdsim.param++;
+
+    switch (lcdsim.cmd)
+    {
+    case 0x2AU:
+        if (lcdsim.param == 4U)
+        {
+            lcdsim.sc = (uint16_t)((lcdsim.buf[0] << 8) | lcdsim.buf[1]);
+            lcdsim.ec = (uint16_t)((lcdsim.buf[2] << 8) | lcdsim.buf[3]);
+        }
+        break;
+    case 0x2BU:
+        if (lcdsim.param == 4U)
+        {
+            lcdsim.sp = (uint16_t)((lcdsim.buf[0] << 8) | lcdsim.buf[1]);
+            lcdsim.ep = (uint16_t)((lcdsim.buf[2] << 8) | lcdsim.buf[3]);
+        }
+        break;
+    case 0x36U:
+        if (lcdsim.param == 1U)
+        {
+            lcdsim.madctl = b;
+        }
+        break;
+    case 0x33U:
+        if (lcdsim.param == 6U)
+        {
+            lcdsim.tfa = (uint16_t)((lcdsim.buf[0] << 8) | lcdsim.buf[1]);
+            lcdsim.vsa = (uint16_t)((lcdsim.buf[2] << 8) | lcdsim.buf[3]);
+            lcdsim.bfa = (uint16_t)((lcdsim.buf[4] << 8) | lcdsim.buf[5]);
+            lcdsim.scroll = true;
+        }
+        break;
+    case 0x37U:
+        if (lcdsim.param == 2U)
+        {
+            lcdsim.vsp = (uint16_t)((lcdsim.buf[0] << 8) | lcdsim.buf[1]);
+            lcdsim.scroll = true;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+uint16_t lcdsim_read_data(void)
+{
+    uint16_t v = 0U;
+
+    lcdsim_bus(false);
+    lcdsim_stats.data_reads++;
+
+    /* 每条读命令的第一个字为 dummy */
+    if (lcdsim.param++ == 0U)
+    {
+        return 0U;
+    }
+
+    switch (lcdsim.cmd)
+    {
+    case 0x2EU:
+    case 0x3EU:
+        v = lcdsim_gram_read();
+        break;
+    case 0x45U:
+        v = (lcdsim.param == 2U) ? (uint16_t)(lcdsim_scanline() >> 8) : (uint16_t)(lcdsim_scanline() & 0xFFU);
+        break;
+    default:
+        break;
+    }
+    return v;
+}
+
+/* ----------------------------- 统计 / 输出 ----------------------------- */
+
+void lcdsim_get_stats(lcdsim_stats_t *out)
+{
+    if (out != 0)
+    {
+        *out = lcdsim_stats;
+    }
+}
+
+void lcdsim_reset_stats(void)
+{
+    memset(&lcdsim_stats, 0, sizeof(lcdsim_stats));
+}
+
+uint16_t lcdsim_pixel(uint16_t x, uint16_t y)
+{
+    if ((x >= LCDSIM_WIDTH) || (y >= LCDSIM_HEIGHT))
+    {
+        return 0U;
+    }
+    return lcdsim_gram[y][x];
+}
+
+uint16_t lcdsim_scanline(void)
+{
+    return (uint16_t)((lcdsim_stats.bus_cycles / LCDSIM_LINE_CYCLES) % LCDSIM_HEIGHT);
+}
+
+/* 显示第 row 行时实际取的 GRAM 行：滚动区内按 VSP 循环偏移 */
+static uint32_t lcdsim_display_row(uint32_t row)
+{
+    if (!lcdsim.scroll || (lcdsim.vsa == 0U) || (row < lcdsim.tfa) || (row >= ((uint32_t)lcdsim.tfa + lcdsim.vsa)))
+    {
+        return row;
+    }
+    const uint32_t off = (lcdsim.vsp >= lcdsim.tfa) ? (uint32_t)(lcdsim.vsp - lcdsim.tfa) : 0U;
+    return lcdsim.tfa + (((row - lcdsim.tfa) + off) % lcdsim.vsa);
+}
+
+bool lcdsim_dump_ppm(const char *path, bool display)
+{
+    FILE *f = fopen(path, "wb");
+
+    if (f == 0)
+    {
+        return false;
+    }
+
+    fprintf(f, "P6\n%u %u\n255\n", LCDSIM_WIDTH, LCDSIM_HEIGHT);
+    for (uint32_t y = 0U; y < LCDSIM_HEIGHT; y++)
+    {
+        const uint32_t sy = display ? lcdsim_display_row(y) : y;
+        uint8_t line[LCDSIM_WIDTH * 3U];
+
+        for (uint32_t x = 0U; x < LCDSIM_WIDTH; x++)
+        {
+            const uint32_t v = lcdsim_gram[sy][x];
+            const uint32_t r = (v >> 11) & 0x1FU;
+            const uint32_t g = (v >> 5) & 0x3FU;
+            const uint32_t b = v & 0x1FU;
+            line[x * 3U] = (uint8_t)((r << 3) | (r >> 2));
+            line[x * 3U + 1U] = (uint8_t)((g << 2) | (g >> 4));
+            line[x * 3U + 2U] = (uint8_t)((b << 3) | (b >> 2));
+        }
+        fwrite(line, 1U, sizeof(line), f);
+    }
+
+    return fclose(f) == 0;
+}
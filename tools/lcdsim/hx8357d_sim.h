@@ -0,0 +1,81 @@
+#ifndef LCDSIM_HX8357D_SIM_H
+#define LCDSIM_HX8357D_SIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief HX8357D 软件模型（主机仿真）：命令解析 + 320×480 GRAM + 总线计数。
+ *
+ * src/lcd/lcd_port.h 在定义 LCD_PORT_HOST 时把 LCD_WR_CMD / LCD_WR_DATA / LCD_RD_DATA
+ * 映射到这里的 lcdsim_write_cmd() / lcdsim_write_data() / lcdsim_read_data()，
+ * lcd.c 原样编译即可在 x86 上驱动模型。
+ *
+ * 建模的命令：0x2A/0x2B（窗口）、0x2C/0x3C（写 GRAM）、0x2E（读 GRAM，RGB888 读格式）、
+ * 0x36（MADCTL：MY/MX/MV）、0x33/0x37/0x13（垂直滚动）、0x45（读扫描行）、0x01（软件复位）；
+ * 其它命令只计数、吞掉参数。
+ *
+ * 坐标约定：GRAM 按“正向观看”的竖屏 320×480 存放，与本板 MADCTL 0x4C（MX）= 0° 一致。
+ *
+ * 详见: tools/lcdsim/lcdsim.md
+ */
+
+#define LCDSIM_WIDTH  (320U)
+#define LCDSIM_HEIGHT (480U)
+
+/** 60Hz 刷新、168MHz HCLK 下每条扫描行对应的周期数（0x45 由总线周期推算）。 */
+#define LCDSIM_LINE_CYCLES (168000000U / 60U / LCDSIM_HEIGHT)
+
+/** 总线统计；bus_cycles 按当前 FSMC BTR4/BWTR4 估算（见 lcdsim.md 第 3 节）。 */
+typedef struct
+{
+    uint32_t cmd_writes;
+    uint32_t data_writes;       /* 含命令参数与像素 */
+    uint32_t data_reads;        /* 含 dummy read */
+    uint32_t gram_writes;       /* 写入 GRAM 的像素数 */
+    uint32_t gram_reads;        /* 从 GRAM 取出的像素数 */
+    uint32_t clipped;           /* 地址落在 GRAM 外被丢弃的像素数 */
+    uint64_t bus_cycles;
+    uint32_t cmd_count[256];    /* 每个命令字的次数 */
+} lcdsim_stats_t;
+
+/** DMA 端点地址：lcd.c 中 &LCD_DATA_REG 在主机上指向这里（值本身不使用）。 */
+extern volatile uint16_t lcdsim_cmd_port;
+extern volatile uint16_t lcdsim_data_port;
+
+/** 上电状态：GRAM 清零，MADCTL = 0，滚动关闭，统计清零。 */
+void lcdsim_reset(void);
+
+void lcdsim_write_cmd(uint16_t cmd);
+void lcdsim_write_data(uint16_t data);
+uint16_t lcdsim_read_data(void);
+
+void lcdsim_get_stats(lcdsim_stats_t *out);
+void lcdsim_reset_stats(void);
+
+/** GRAM 像素（观看坐标）。越界返回 0。 */
+uint16_t lcdsim_pixel(uint16_t x, uint16_t y);
+
+/** 当前扫描行（由累计总线周期推算）。 */
+uint16_t lcdsim_scanline(void);
+
+/** lcd_dma_sim.c 完成的 lcd_dma_start() 次数。 */
+uint32_t lcdsim_dma_transfers(void);
+
+/**
+ * @brief 把画面写成二进制 PPM（P6，RGB565 扩展为 8-bit）。
+ *
+ * @param display false：GRAM 原样；true：按垂直滚动状态（0x33/0x37）重排行，即面板实际显示的画面。
+ * @return 写文件失败返回 false。
+ */
+bool lcdsim_dump_ppm(const char *path, bool display);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCDSIM_HX8357D_SIM_H */
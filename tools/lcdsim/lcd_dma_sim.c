@@ -0,0 +1,87 @@
+#include "lcd/lcd_dma.h"
+
+#include "hx8357d_sim.h"
+
+/*
+ * src/lcd/lcd_dma.c 的主机替身：同一套 API，调用时同步完成搬运。
+ * LCD 端点（&LCD_DATA_REG）逐项经过 HX8357D 模型，因此 DMA 路径的总线事务同样被计数；
+ * 完成回调在 lcd_dma_start() 返回前执行（相当于传输瞬间完成的中断）。
+ */
+
+static uint32_t lcd_dma_transfers;
+
+void lcd_dma_init(void)
+{
+}
+
+bool lcd_dma_start(const volatile void *src,
+                   bool src_inc,
+                   volatile void *dst,
+                   bool dst_inc,
+                   uint32_t count,
+                   lcd_dma_done_cb_t cb,
+                   void *ctx)
+{
+    const volatile uint16_t *s = (const volatile uint16_t *)src;
+    volatile uint16_t *d = (volatile uint16_t *)dst;
+
+    if (count == 0U)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        const uint16_t v = (s == &lcdsim_data_port) ? lcdsim_read_data() : *s;
+
+        if (d == &lcdsim_data_port)
+        {
+            lcdsim_write_data(v);
+        }
+        else
+        {
+            *d = v;
+        }
+
+        if (src_inc)
+        {
+            s++;
+        }
+        if (dst_inc)
+        {
+            d++;
+        }
+    }
+
+    lcd_dma_transfers++;
+    if (cb != 0)
+    {
+        cb(ctx);
+    }
+    return true;
+}
+
+bool lcd_dma_busy(void)
+{
+    return false;
+}
+
+void lcd_dma_wait(void)
+{
+}
+
+bool lcd_dma_addr_ok(const volatile void *p)
+{
+    /* 主机上没有 CCMRAM：全部视为 DMA 可达 */
+    return p != 0;
+}
+
+uint32_t lcd_dma_error_count(void)
+{
+    return 0U;
+}
+
+uint32_t lcdsim_dma_transfers(void)
+{
+    return lcd_dma_transfers;
+}
@@ -0,0 +1,388 @@
+/*
+ * lcdsim：在主机上用 HX8357D 模型跑一遍 src/ 的绘制路径，
+ * 逐步打印总线事务数，结束时导出 GRAM / 实际显示画面（PPM）。
+ *
+ *   lcdsim [选项] [输出前缀]   -> <前缀>_gram.ppm、<前缀>_display.ppm（默认前缀 lcdsim）
+ *
+ *   --golden DIR   与 DIR 下的参考结果比较：lcdsim_gram.ppm / lcdsim_display.ppm 逐字节一致，
+ *                  lcdsim_counts.txt 中每个场景的命令 / 数据写 / 数据读次数一致；不一致时返回 1
+ *   --update       与 --golden 同用：用本次结果覆盖参考文件（驱动有意改变总线行为后执行）
+ *
+ * 未知选项或多余参数时打印用法并返回 2，不写任何文件。
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hx8357d_sim.h"
+
+#include "font/font.h"
+#include "gfx/aa.h"
+#include "gfx/gfx.h"
+#include "lcd/lcd.h"
+#include "lcd/lcd_console.h"
+
+#define LCDSIM_BLIT_W (64U)
+#define LCDSIM_BLIT_H (64U)
+
+static lcd_color565_t lcdsim_img[LCDSIM_BLIT_W * LCDSIM_BLIT_H];
+static lcd_color565_t lcdsim_back[LCDSIM_BLIT_W * LCDSIM_BLIT_H];
+
+/* 场景数上限（main() 中 STEP 的个数） */
+#define LCDSIM_MAX_STEPS (32U)
+
+#define LCDSIM_GOLDEN_COUNTS "lcdsim_counts.txt"
+
+typedef struct
+{
+    const char *name;
+    uint32_t cmd;
+    uint32_t wr;
+    uint32_t rd;
+} lcdsim_step_t;
+
+static lcdsim_stats_t lcdsim_before;
+static lcdsim_step_t lcdsim_steps[LCDSIM_MAX_STEPS];
+static uint32_t lcdsim_step_count;
+
+static void step_begin(void)
+{
+    lcdsim_get_stats(&lcdsim_before);
+}
+
+/* 一行：命令 / 数据写 / 数据读 / GRAM 像素 / 估算总线周期与 168MHz 下的时间 */
+static void step_end(const char *name)
+{
+    lcdsim_stats_t now;
+
+    lcdsim_get_stats(&now);
+    const uint64_t cyc = now.bus_cycles - lcdsim_before.bus_cycles;
+
+    if (lcdsim_step_count < LCDSIM_MAX_STEPS)
+    {
+        lcdsim_step_t *st = &lcdsim_steps[lcdsim_step_count++];
+        st->name = name;
+        st->cmd = now.cmd_writes - lcdsim_before.cmd_writes;
+        st->wr = now.data_writes - lcdsim_before.data_writes;
+        st->rd = now.data_reads - lcdsim_before.data_reads;
+    }
+
+    printf("%-28s %6u %8u %7u %8u %10llu %8.1f\n", name,
+           now.cmd_writes - lcdsim_before.cmd_writes,
+           now.data_writes - lcdsim_before.data_writes,
+           now.data_reads - lcdsim_before.data_reads,
+           (now.gram_writes - lcdsim_before.gram_writes) + (now.gram_reads - lcdsim_before.gram_reads),
+           (unsigned long long)cyc, (double)cyc / 168.0);
+}
+
+#define STEP(name, stmt) \
+    do                   \
+    {                    \
+        step_begin();    \
+        stmt;            \
+        step_end(name);  \
+    } while (0)
+
+/* ----------------------------- 参考结果 ----------------------------- */
+
+/* 读入整个文件；失败返回 0（*len 置 0） */
+static unsigned char *lcdsim_read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    unsigned char *buf = 0;
+    long n;
+
+    *len = 0U;
+    if (f == 0)
+    {
+        return 0;
+    }
+    if ((fseek(f, 0, SEEK_END) == 0) && ((n = ftell(f)) > 0) && (fseek(f, 0, SEEK_SET) == 0))
+    {
+        buf = malloc((size_t)n);
+        if ((buf != 0) && (fread(buf, 1U, (size_t)n, f) == (size_t)n))
+        {
+            *len = (size_t)n;
+        }
+        else
+        {
+            free(buf);
+            buf = 0;
+        }
+    }
+    fclose(f);
+    return buf;
+}
+
+/* 导出的 PPM 与参考图逐字节比较，返回不一致的字节数（文件缺失或尺寸不同计为整个文件） */
+static size_t lcdsim_compare_file(const char *out, const char *ref)
+{
+    size_t na;
+    size_t nb;
+    unsigned char *a = lcdsim_read_file(out, &na);
+    unsigned char *b = lcdsim_read_file(ref, &nb);
+    size_t diff = 0U;
+
+    if ((a == 0) || (b == 0) || (na != nb))
+    {
+        diff = (na > nb) ? na : nb;
+        diff = (diff == 0U) ? 1U : diff;
+    }
+    else
+    {
+        for (size_t i = 0U; i < na; i++)
+        {
+            diff += (a[i] != b[i]) ? 1U : 0U;
+        }
+    }
+    free(a);
+    free(b);
+    return diff;
+}
+
+static bool lcdsim_write_counts(const char *path)
+{
+    FILE *f = fopen(path, "w");
+
+    if (f == 0)
+    {
+        return false;
+    }
+    fprintf(f, "# cmd wr rd step  (lcdsim --golden <dir> --update 生成)\n");
+    for (uint32_t i = 0U; i < lcdsim_step_count; i++)
+    {
+        const lcdsim_step_t *st = &lcdsim_steps[i];
+        fprintf(f, "%u %u %u %s\n", st->cmd, st->wr, st->rd, st->name);
+    }
+    return fclose(f) == 0;
+}
+
+/* 按场景名逐行比较；返回不一致（含缺失 / 多余）的场景数 */
+static uint32_t lcdsim_check_counts(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[160];
+    bool seen[LCDSIM_MAX_STEPS] = {false};
+    uint32_t bad = 0U;
+
+    if (f == 0)
+    {
+        printf("golden: cannot open %s\n", path);
+        return 1U;
+    }
+
+    while (fgets(line, sizeof(line), f) != 0)
+    {
+        unsigned cmd;
+        unsigned wr;
+        unsigned rd;
+        char name[128];
+        uint32_t i;
+
+        if ((line[0] == '#') || (sscanf(line, "%u %u %u %127[^\n]", &cmd, &wr, &rd, name) != 4))
+        {
+            continue;
+        }
+        for (i = 0U; i < lcdsim_step_count; i++)
+        {
+            if (strcmp(lcdsim_steps[i].name, name) == 0)
+            {
+                break;
+            }
+        }
+        if (i == lcdsim_step_count)
+        {
+            printf("golden: step \"%s\" not run\n", name);
+            bad++;
+            continue;
+        }
+
+        const lcdsim_step_t *st = &lcdsim_steps[i];
+        seen[i] = true;
+        if ((st->cmd != cmd) || (st->wr != wr) || (st->rd != rd))
+        {
+            printf("golden: %-28s cmd %u/%u  wr %u/%u  rd %u/%u (got/expected)\n", name, st->cmd, cmd, st->wr, wr,
+                   st->rd, rd);
+            bad++;
+        }
+    }
+    fclose(f);
+
+    for (uint32_t i = 0U; i < lcdsim_step_count; i++)
+    {
+        if (!seen[i])
+        {
+            printf("golden: step \"%s\" has no expected counts\n", lcdsim_steps[i].name);
+            bad++;
+        }
+    }
+    return bad;
+}
+
+/* 与参考结果比较（或 update 时覆盖参考），返回失败项数 */
+static uint32_t lcdsim_golden(const char *dir, const char *prefix, bool update)
+{
+    static const char *const kinds[] = {"gram", "display"};
+    char out[512];
+    char ref[512];
+    uint32_t bad = 0U;
+
+    for (uint32_t k = 0U; k < 2U; k++)
+    {
+        (void)snprintf(out, sizeof(out), "%s_%s.ppm", prefix, kinds[k]);
+        (void)snprintf(ref, sizeof(ref), "%s/lcdsim_%s.ppm", dir, kinds[k]);
+
+        if (update)
+        {
+            size_t n;
+            unsigned char *buf = lcdsim_read_file(out, &n);
+            FILE *f = fopen(ref, "wb");
+            bool ok = (buf != 0) && (f != 0) && (fwrite(buf, 1U, n, f) == n);
+            if (f != 0)
+            {
+                ok = (fclose(f) == 0) && ok;
+            }
+            free(buf);
+            printf("golden: %s %s\n", ok ? "updated" : "cannot write", ref);
+            bad += ok ? 0U : 1U;
+            continue;
+        }
+
+        const size_t diff = lcdsim_compare_file(out, ref);
+        if (diff == 0U)
+        {
+            printf("golden: %-28s match\n", kinds[k]);
+        }
+        else
+        {
+            printf("golden: %-28s DIFFERS (%zu bytes vs %s)\n", kinds[k], diff, ref);
+            bad++;
+        }
+    }
+
+    (void)snprintf(ref, sizeof(ref), "%s/%s", dir, LCDSIM_GOLDEN_COUNTS);
+    if (update)
+    {
+        const bool ok = lcdsim_write_counts(ref);
+        printf("golden: %s %s\n", ok ? "updated" : "cannot write", ref);
+        return bad + (ok ? 0U : 1U);
+    }
+
+    const uint32_t nbad = lcdsim_check_counts(ref);
+    printf("golden: %-28s %s\n", "bus transaction counts", (nbad == 0U) ? "match" : "DIFFER");
+    return bad + nbad;
+}
+
+int main(int argc, char **argv)
+{
+    const char *prefix = "lcdsim";
+    const char *golden = 0;
+    bool update = false;
+    char path[512];
+    uint32_t bad = 0U;
+
+    bool usage = false;
+    bool have_prefix = false;
+    for (int a = 1; a < argc; a++)
+    {
+        if ((strcmp(argv[a], "--golden") == 0) && ((a + 1) < argc))
+        {
+            golden = argv[++a];
+        }
+        else if (strcmp(argv[a], "--update") == 0)
+        {
+            update = true;
+        }
+        else if ((argv[a][0] == '-') || have_prefix)
+        {
+            /* 未知选项、缺参数的 --golden、多余的前缀：不要当成输出前缀去写文件 */
+            usage = true;
+        }
+        else
+        {
+            prefix = argv[a];
+            have_prefix = true;
+        }
+    }
+    if (usage || (update && (golden == 0)))
+    {
+        printf("usage: lcdsim [--golden DIR [--update]] [prefix]\n");
+        return 2;
+    }
+
+    for (uint32_t i = 0U; i < (LCDSIM_BLIT_W * LCDSIM_BLIT_H); i++)
+    {
+        const uint32_t x = i % LCDSIM_BLIT_W;
+        const uint32_t y = i / LCDSIM_BLIT_W;
+        lcdsim_img[i] = (lcd_color565_t)(((x >> 1) << 11) | ((y) << 5) | ((x ^ y) & 0x1FU));
+    }
+
+    lcdsim_reset();
+
+    printf("%-28s %6s %8s %7s %8s %10s %8s\n", "step", "cmd", "wr", "rd", "gram_px", "bus_cyc", "us");
+
+    STEP("lcd_panel_init", lcd_panel_init());
+    STEP("lcd_clear", lcd_clear(0x0000U));
+    STEP("lcd_fill_rect 100x100", lcd_fill_rect(10U, 10U, 100U, 100U, 0xF800U));
+    STEP("lcd_fill_rect 100x100 again", lcd_fill_rect(10U, 10U, 100U, 100U, 0x07E0U));
+    STEP("lcd_draw_pixel x100 (row)", for (uint16_t i = 0U; i < 100U; i++) { lcd_draw_pixel((uint16_t)(120U + i), 20U, 0xFFFFU); });
+    STEP("lcd_draw_pixel x100 (col)", for (uint16_t i = 0U; i < 100U; i++) { lcd_draw_pixel(230U, (uint16_t)(10U + i), 0xFFE0U); });
+    STEP("lcd_blit 64x64", lcd_blit(240U, 10U, LCDSIM_BLIT_W, LCDSIM_BLIT_H, lcdsim_img));
+    STEP("lcd_read_rect 64x64", (void)lcd_read_rect(240U, 10U, LCDSIM_BLIT_W, LCDSIM_BLIT_H, lcdsim_back));
+    STEP("font_draw_string 16px", font_draw_string(10U, 130U, "HX8357D host model", &font_mono16, 0xFFFFU, 0x0000U));
+    STEP("font_draw_string 24px aa", font_draw_string(10U, 150U, "lcdsim 0123", &font_mono24_aa, 0x07FFU, 0x0000U));
+    STEP("gfx_fill_circle r40", gfx_fill_circle(80, 250, 40, 0x001FU));
+    STEP("gfx_fill_triangle", gfx_fill_triangle(160, 210, 300, 230, 200, 290, 0xF81FU));
+    STEP("gfx_aa_line (readback bg)", gfx_aa_line(10, 300, 310, 330, 0xFFFFU, 0));
+    STEP("lcd_set_rotation 90 + text", lcd_set_rotation(LCD_ROTATION_90);
+         font_draw_string(10U, 10U, "rotated 90", &font_mono16, 0xFFE0U, 0x0000U);
+         lcd_set_rotation(LCD_ROTATION_0));
+
+    if (lcd_console_init(&font_mono16, 352U, 0U, 0x07E0U, 0x0000U))
+    {
+        STEP("lcd_console 12 lines", for (uint32_t i = 0U; i < 12U; i++) {
+            char line[32];
+            (void)snprintf(line, sizeof(line), "console line %u\n", (unsigned)i);
+            lcd_console_write(line);
+        });
+    }
+
+    /* 读回与模型 GRAM 逐像素比对 */
+    for (uint32_t i = 0U; i < (LCDSIM_BLIT_W * LCDSIM_BLIT_H); i++)
+    {
+        if (lcdsim_back[i] != lcdsim_img[i])
+        {
+            bad++;
+        }
+    }
+
+    lcdsim_stats_t st;
+    lcdsim_get_stats(&st);
+    printf("\ntotal: %u cmds, %u writes, %u reads, %llu bus cycles, %u DMA transfers, %u clipped px\n",
+           st.cmd_writes, st.data_writes, st.data_reads, (unsigned long long)st.bus_cycles,
+           lcdsim_dma_transfers(), st.clipped);
+    printf("readback mismatches: %u\n", bad);
+
+    (void)snprintf(path, sizeof(path), "%s_gram.ppm", prefix);
+    if (!lcdsim_dump_ppm(path, false))
+    {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+    (void)snprintf(path, sizeof(path), "%s_display.ppm", prefix);
+    if (!lcdsim_dump_ppm(path, true))
+    {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+    printf("wrote %s_gram.ppm / %s_display.ppm\n", prefix, prefix);
+
+    if (golden != 0)
+    {
+        bad += lcdsim_golden(golden, prefix, update);
+    }
+
+    return (bad == 0U) ? 0 : 1;
+}
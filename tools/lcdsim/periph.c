@@ -0,0 +1,71 @@
+#include <stdint.h>
+
+#include "stm32f4xx.h"
+
+/* 仿真外设：全部为普通内存，复位值为 0 */
+RCC_TypeDef lcdsim_rcc;
+GPIO_TypeDef lcdsim_gpio[9];
+FSMC_Bank1_TypeDef lcdsim_fsmc_bank1;
+FSMC_Bank1E_TypeDef lcdsim_fsmc_bank1e;
+TIM_TypeDef lcdsim_tim6;
+USART_TypeDef lcdsim_usart1;
+PWR_TypeDef lcdsim_pwr;
+FLASH_TypeDef lcdsim_flash_if;
+EXTI_TypeDef lcdsim_exti;
+SYSCFG_TypeDef lcdsim_syscfg;
+DWT_Type lcdsim_dwt;
+CoreDebug_Type lcdsim_coredebug;
+SysTick_Type lcdsim_systick;
+NVIC_Type lcdsim_nvic;
+SCB_Type lcdsim_scb;
+
+volatile uint32_t lcdsim_primask;
+
+/* FLASH_BASE 起的 64KB：内容无关紧要，只需可读 */
+const uint8_t lcdsim_flash_mem[64U * 1024U];
+
+/* 与 core_cm4.h 的 SysTick_Config() 相同的寄存器序列 */
+uint32_t lcdsim_systick_config(uint32_t ticks)
+{
+    if ((ticks - 1UL) > SysTick_LOAD_RELOAD_Msk)
+    {
+        return 1UL;
+    }
+
+    SysTick->LOAD = ticks - 1UL;
+    lcdsim_nvic_set_priority(SysTick_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL);
+    SysTick->VAL = 0UL;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    return 0UL;
+}
+
+void lcdsim_nvic_enable_irq(IRQn_Type irqn)
+{
+    if ((int32_t)irqn >= 0)
+    {
+        NVIC->ISER[(uint32_t)irqn >> 5] |= 1UL << ((uint32_t)irqn & 0x1FUL);
+    }
+}
+
+void lcdsim_nvic_disable_irq(IRQn_Type irqn)
+{
+    if ((int32_t)irqn >= 0)
+    {
+        NVIC->ICER[(uint32_t)irqn >> 5] |= 1UL << ((uint32_t)irqn & 0x1FUL);
+        NVIC->ISER[(uint32_t)irqn >> 5] &= ~(1UL << ((uint32_t)irqn & 0x1FUL));
+    }
+}
+
+void lcdsim_nvic_set_priority(IRQn_Type irqn, uint32_t priority)
+{
+    const uint8_t v = (uint8_t)((priority << (8U - __NVIC_PRIO_BITS)) & 0xFFUL);
+
+    if ((int32_t)irqn >= 0)
+    {
+        NVIC->IP[(uint32_t)irqn] = v;
+    }
+    else
+    {
+        SCB->SHP[((uint32_t)irqn & 0xFUL) - 4UL] = v;
+    }
+}
@@ -0,0 +1,256 @@
+#include "periph_model.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include "stm32f4xx.h"
+
+/* USART1 DR 的空闲标记：超出 9 位数据范围，写入任何字节都能区分 */
+#define LCDSIM_MODEL_USART_IDLE (0xFFFFFFFFU)
+
+/* 按频率把经过的 ns 折算成整数个时钟，余数留到下一次 */
+typedef struct
+{
+    uint64_t last_ns;
+    uint64_t rem;
+} lcdsim_model_clk_t;
+
+static lcdsim_flag_hook_t lcdsim_model_hook;
+static bool lcdsim_model_running;
+
+static lcdsim_model_clk_t lcdsim_model_tim6_clk;
+static lcdsim_model_clk_t lcdsim_model_systick_clk;
+static lcdsim_model_clk_t lcdsim_model_dwt_clk;
+static uint32_t lcdsim_model_systick_elapsed;
+
+/* delay.c 提供；未链接时弱引用为 0，不调用 */
+extern void SysTick_Handler(void) __attribute__((weak));
+
+uint64_t lcdsim_now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+void lcdsim_model_set_hook(lcdsim_flag_hook_t hook)
+{
+    lcdsim_model_hook = hook;
+}
+
+/* 距上次调用经过的 hz 时钟数；enabled 为 false 时只更新时间戳（停止期间不计数） */
+static uint32_t lcdsim_model_ticks(lcdsim_model_clk_t *c, uint32_t hz, bool enabled)
+{
+    const uint64_t now = lcdsim_now_ns();
+    const uint64_t dt = now - c->last_ns;
+
+    c->last_ns = now;
+    if (!enabled)
+    {
+        c->rem = 0U;
+        return 0U;
+    }
+
+    const uint64_t acc = c->rem + (dt * hz);
+    c->rem = acc % 1000000000ULL;
+    return (uint32_t)(acc / 1000000000ULL);
+}
+
+/* 置位前先问钩子；钩子拒绝时该位保持为 0 */
+static void lcdsim_model_flag(volatile uint32_t *reg, uint32_t mask, bool on)
+{
+    if (on && ((lcdsim_model_hook == 0) || lcdsim_model_hook(reg, mask)))
+    {
+        *reg |= mask;
+    }
+    else
+    {
+        *reg &= ~mask;
+    }
+}
+
+/* ----------------------------- RCC ----------------------------- */
+
+RCC_TypeDef *lcdsim_rcc_sync(void)
+{
+    RCC_TypeDef *rcc = &lcdsim_rcc;
+    const uint32_t cr = rcc->CR;
+    const uint32_t sws = (rcc->CFGR & RCC_CFGR_SW) << 2;
+
+    lcdsim_model_flag(&rcc->CR, RCC_CR_HSIRDY, (cr & RCC_CR_HSION) != 0U);
+    lcdsim_model_flag(&rcc->CR, RCC_CR_HSERDY, (cr & RCC_CR_HSEON) != 0U);
+    lcdsim_model_flag(&rcc->CR, RCC_CR_PLLRDY, (cr & RCC_CR_PLLON) != 0U);
+
+    /* SWS 是两位编码：钩子拦住时停在原时钟源 */
+    if (((rcc->CFGR & RCC_CFGR_SWS) != sws)
+        && ((lcdsim_model_hook == 0) || lcdsim_model_hook(&rcc->CFGR, RCC_CFGR_SWS)))
+    {
+        rcc->CFGR = (rcc->CFGR & ~RCC_CFGR_SWS) | sws;
+    }
+
+    return rcc;
+}
+
+/* ----------------------------- TIM6 ----------------------------- */
+
+/* APB1 定时器时钟：PPRE1 != /1 时为 PCLK1 的 2 倍 */
+static uint32_t lcdsim_model_apb1_tim_hz(void)
+{
+    const uint32_t shift = APBPrescTable[(lcdsim_rcc.CFGR & RCC_CFGR_PPRE1) >> RCC_CFGR_PPRE1_Pos];
+    const uint32_t pclk1 = SystemCoreClock >> shift;
+
+    return (shift == 0U) ? pclk1 : (2U * pclk1);
+}
+
+TIM_TypeDef *lcdsim_tim6_sync(void)
+{
+    TIM_TypeDef *tim = &lcdsim_tim6;
+
+    if ((tim->EGR & TIM_EGR_UG) != 0U)
+    {
+        tim->CNT = 0U;
+        tim->EGR = 0U;
+    }
+
+    const uint32_t hz = lcdsim_model_apb1_tim_hz() / ((tim->PSC & 0xFFFFU) + 1U);
+    const uint32_t ticks = lcdsim_model_ticks(&lcdsim_model_tim6_clk, hz, (tim->CR1 & TIM_CR1_CEN) != 0U);
+    const uint32_t arr = tim->ARR & 0xFFFFU;
+    const uint64_t cnt = (uint64_t)tim->CNT + ticks;
+
+    if (cnt <= arr)
+    {
+        tim->CNT = (uint32_t)cnt;
+        return tim;
+    }
+
+    if ((tim->CR1 & TIM_CR1_OPM) != 0U)
+    {
+        tim->CNT = 0U;
+        tim->CR1 &= ~TIM_CR1_CEN;
+    }
+    else
+    {
+        tim->CNT = (uint32_t)((cnt - arr - 1U) % ((uint64_t)arr + 1U));
+    }
+    lcdsim_model_flag(&tim->SR, TIM_SR_UIF, true);
+
+    return tim;
+}
+
+/* ----------------------------- USART1 ----------------------------- */
+
+USART_TypeDef *lcdsim_usart1_sync(void)
+{
+    USART_TypeDef *u = &lcdsim_usart1;
+    const bool te = (u->CR1 & USART_CR1_TE) != 0U;
+
+    if (u->DR != LCDSIM_MODEL_USART_IDLE)
+    {
+        if (te)
+        {
+            (void)fputc((int)(u->DR & 0xFFU), stdout);
+        }
+        u->DR = LCDSIM_MODEL_USART_IDLE;
+    }
+    lcdsim_model_flag(&u->SR, USART_SR_TXE | USART_SR_TC, te);
+
+    return u;
+}
+
+/* ----------------------------- DWT ----------------------------- */
+
+DWT_Type *lcdsim_dwt_sync(void)
+{
+    DWT_Type *dwt = &lcdsim_dwt;
+    const bool on = ((lcdsim_coredebug.DEMCR & CoreDebug_DEMCR_TRCENA_Msk) != 0U)
+                    && ((dwt->CTRL & DWT_CTRL_CYCCNTENA_Msk) != 0U);
+
+    dwt->CYCCNT += lcdsim_model_ticks(&lcdsim_model_dwt_clk, SystemCoreClock, on);
+
+    return dwt;
+}
+
+/* ----------------------------- SysTick（中断） ----------------------------- */
+
+static void lcdsim_model_systick_irq(int sig)
+{
+    SysTick_Type *st = &lcdsim_systick;
+    const uint32_t ctrl = st->CTRL;
+    const bool on = (ctrl & SysTick_CTRL_ENABLE_Msk) != 0U;
+    const uint32_t hz = ((ctrl & SysTick_CTRL_CLKSOURCE_Msk) != 0U) ? SystemCoreClock : (SystemCoreClock / 8U);
+    const uint32_t period = (st->LOAD & SysTick_LOAD_RELOAD_Msk) + 1U;
+    uint64_t elapsed = (uint64_t)lcdsim_model_systick_elapsed + lcdsim_model_ticks(&lcdsim_model_systick_clk, hz, on);
+
+    (void)sig;
+
+    if (!on)
+    {
+        lcdsim_model_systick_elapsed = 0U;
+        return;
+    }
+
+    /* 进程被调度出去很久时连续补发节拍，毫秒计数不丢 */
+    while (elapsed >= period)
+    {
+        elapsed -= period;
+        st->CTRL |= SysTick_CTRL_COUNTFLAG_Msk;
+        if (((ctrl & SysTick_CTRL_TICKINT_Msk) != 0U) && (SysTick_Handler != 0))
+        {
+            SysTick_Handler();
+        }
+    }
+
+    lcdsim_model_systick_elapsed = (uint32_t)elapsed;
+    st->VAL = period - 1U - (uint32_t)elapsed;
+}
+
+static void lcdsim_model_set_timer(uint32_t us)
+{
+    struct itimerval it = {
+        .it_interval = {.tv_sec = 0, .tv_usec = (suseconds_t)us},
+        .it_value = {.tv_sec = 0, .tv_usec = (suseconds_t)us},
+    };
+
+    (void)setitimer(ITIMER_REAL, &it, 0);
+}
+
+void lcdsim_model_start(void)
+{
+    struct sigaction sa = {0};
+    const uint64_t now = lcdsim_now_ns();
+
+    if (lcdsim_model_running)
+    {
+        return;
+    }
+
+    lcdsim_rcc.CR |= RCC_CR_HSION;
+    lcdsim_usart1.DR = LCDSIM_MODEL_USART_IDLE;
+    lcdsim_model_tim6_clk.last_ns = now;
+    lcdsim_model_systick_clk.last_ns = now;
+    lcdsim_model_dwt_clk.last_ns = now;
+
+    /* SA_RESTART：被“中断”打断的 printf / write 自动重启 */
+    sa.sa_handler = lcdsim_model_systick_irq;
+    sa.sa_flags = SA_RESTART;
+    (void)sigemptyset(&sa.sa_mask);
+    (void)sigaction(SIGALRM, &sa, 0);
+
+    lcdsim_model_set_timer(LCDSIM_MODEL_IRQ_US);
+    lcdsim_model_running = true;
+}
+
+void lcdsim_model_stop(void)
+{
+    if (!lcdsim_model_running)
+    {
+        return;
+    }
+
+    lcdsim_model_set_timer(0U);
+    (void)fflush(stdout);
+    lcdsim_model_running = false;
+}
@@ -0,0 +1,62 @@
+#ifndef LCDSIM_PERIPH_MODEL_H
+#define LCDSIM_PERIPH_MODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief 仿真外设的“硬件行为”（fwhost 目标，编译时定义 LCDSIM_MODEL）。
+ *
+ * 寄存器仍是 periph.c 里的普通内存，行为分两类推进：
+ * - 访问钩子：host/stm32f4xx.h 把 RCC / TIM6 / USART1 / DWT 映射为 lcdsim_*_sync()，
+ *   每次访问前按主机单调时钟把该外设推进到“现在”。驱动里的忙等循环
+ *   （clock_wait_flag_set()、TIM6 UIF、USART TXE/TC）每轮都会访问寄存器，因此能正常退出
+ * - 中断：SIGALRM 间隔定时器（LCDSIM_MODEL_IRQ_US）在主线程上打断当前代码，
+ *   推进 SysTick 并按到期次数调用 SysTick_Handler()，与板上中断的上下文一致
+ *
+ * 建模范围：
+ * - RCC：HSION/HSEON/PLLON -> 对应 RDY 位；CFGR.SW -> CFGR.SWS
+ * - TIM6：CEN 置位后按 APB1 定时器时钟 / (PSC+1) 计数，CNT > ARR 时置 UIF，OPM 下清 CEN；
+ *   UG 只清零 CNT，不置 UIF（驱动随后总会清 SR）
+ * - SysTick：按 HCLK（或 HCLK/8）计时，到期置 COUNTFLAG，TICKINT 时调用 SysTick_Handler()
+ * - DWT：TRCENA 且 CYCCNTENA 时 CYCCNT 按 HCLK 推进（另加 FSMC 总线模型的周期）
+ * - USART1：TE 置位后 TXE/TC 恒为 1，写入 DR 的字节输出到 stdout
+ *
+ * 时钟取 SystemCoreClock（由 clock_init_168mhz_hse8() / SystemCoreClockUpdate() 更新），
+ * APB1 分频取 RCC->CFGR.PPRE1。单核主机上也不依赖线程调度。
+ *
+ * 详见: tools/lcdsim/lcdsim.md
+ */
+
+/** SysTick “中断”的检查间隔（us），决定 SysTick_Handler() 的最大延迟。 */
+#ifndef LCDSIM_MODEL_IRQ_US
+#define LCDSIM_MODEL_IRQ_US (100U)
+#endif
+
+/**
+ * @brief 状态位钩子：模型每次要置位 reg 中的 mask 前先询问，返回 false 则该位保持为 0。
+ *
+ * 用于构造故障场景，例如让 HSERDY 永不置位以走到 clock_wait_flag_set() 的超时分支。
+ * 钩子在访问钩子内部被调用：reg 要与 &lcdsim_rcc.CR 这类实例地址比较，不能再经过 RCC 等宏。
+ */
+typedef bool (*lcdsim_flag_hook_t)(volatile uint32_t *reg, uint32_t mask);
+
+/** 启动 / 停止中断定时器；启动时 RCC->CR 置 HSION（复位值）。 */
+void lcdsim_model_start(void);
+void lcdsim_model_stop(void);
+
+/** 设置状态位钩子，传 0 恢复默认（全部放行）。 */
+void lcdsim_model_set_hook(lcdsim_flag_hook_t hook);
+
+/** 主机单调时钟（ns）。 */
+uint64_t lcdsim_now_ns(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCDSIM_PERIPH_MODEL_H */